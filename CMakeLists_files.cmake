@@ -36,6 +36,8 @@ list (APPEND MAIN_SOURCE_FILES
       opm/common/utility/FileSystem.cpp
       opm/common/utility/MemPacker.cpp
       opm/common/utility/OpmInputError.cpp
+      opm/common/utility/Profiler.cpp
+      opm/common/utility/SerializerStream.cpp
       opm/common/utility/shmatch.cpp
       opm/common/utility/String.cpp
       opm/common/utility/TimeService.cpp
@@ -238,6 +240,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/Source.cpp
     opm/input/eclipse/Schedule/SummaryState.cpp
     opm/input/eclipse/Schedule/Tuning.cpp
+    opm/input/eclipse/Schedule/VFPEvaluator.cpp
     opm/input/eclipse/Schedule/VFPInjTable.cpp
     opm/input/eclipse/Schedule/VFPProdTable.cpp
     opm/input/eclipse/Schedule/WriteRestartFileEvents.cpp
@@ -392,6 +395,8 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list( APPEND MAIN_SOURCE_FILES
+          opm/io/eclipse/ArrayIndex.cpp
+          opm/io/eclipse/AsyncWriter.cpp
           opm/io/eclipse/EclFile.cpp
           opm/io/eclipse/EclOutput.cpp
           opm/io/eclipse/EclUtil.cpp
@@ -469,6 +474,10 @@ list (APPEND TEST_SOURCE_FILES
       tests/test_OpmInputError_format.cpp
       tests/test_OpmLog.cpp
       tests/test_param.cpp
+      tests/test_ParallelFor.cpp
+      tests/test_PersistentHashMap.cpp
+      tests/test_Profiler.cpp
+      tests/test_SerializerStream.cpp
       tests/test_RootFinders.cpp
       tests/test_SegmentMatcher.cpp
       tests/test_sparsevector.cpp
@@ -515,6 +524,7 @@ if(ENABLE_ECL_INPUT)
     tests/test_PAvgCalculator.cpp
     tests/test_PAvgDynamicSourceData.cpp
     tests/test_Serialization.cpp
+    tests/test_VFPEvaluator.cpp
     tests/material/test_co2brinepvt.cpp
     tests/material/test_h2brinepvt.cpp
     tests/material/test_hysteresis.cpp
@@ -748,6 +758,7 @@ if(ENABLE_ECL_OUTPUT)
 endif()
 
 list (APPEND EXAMPLE_SOURCE_FILES
+  examples/denseadbench.cpp
 )
 if(ENABLE_ECL_INPUT)
   list (APPEND TEST_DATA_FILES
@@ -787,7 +798,13 @@ if(ENABLE_ECL_INPUT)
     examples/wellgraph.cpp
     examples/make_ext_smry.cpp
     examples/co2brinepvt.cpp
+    examples/co2solubilitybench.cpp
     examples/hysteresis.cpp
+    examples/eclarraybench.cpp
+    examples/vfpbench.cpp
+    examples/restartaggbench.cpp
+    examples/satfuncbench.cpp
+    examples/scheduledeltabench.cpp
   )
 endif()
 
@@ -844,6 +861,9 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/numeric/UniformTableLinear.hpp
       opm/common/utility/numeric/VectorOps.hpp
       opm/common/utility/OpmInputError.hpp
+      opm/common/utility/ParallelFor.hpp
+      opm/common/utility/PersistentHashMap.hpp
+      opm/common/utility/Profiler.hpp
       opm/common/utility/parameters/ParameterGroup.hpp
       opm/common/utility/parameters/ParameterGroup_impl.hpp
       opm/common/utility/parameters/Parameter.hpp
@@ -855,6 +875,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/platform_dependent/reenable_warnings.h
       opm/common/utility/shmatch.hpp
       opm/common/utility/Serializer.hpp
+      opm/common/utility/SerializerStream.hpp
       opm/common/utility/String.hpp
       opm/common/utility/TimeService.hpp
       opm/common/utility/Visitor.hpp
@@ -962,6 +983,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/fluidmatrixinteractions/EclTwoPhaseMaterial.hpp
       opm/material/fluidmatrixinteractions/SatCurveMultiplexerParams.hpp
       opm/material/fluidmatrixinteractions/EclTwoPhaseMaterialParams.hpp
+      opm/material/fluidmatrixinteractions/EclBakedTwoPhaseTable.hpp
       opm/material/fluidmatrixinteractions/EclEpsTwoPhaseLawParams.hpp
       opm/material/fluidmatrixinteractions/ParkerLenhardParams.hpp
       opm/material/fluidmatrixinteractions/ThreePhaseParkerVanGenuchtenParams.hpp
@@ -1040,6 +1062,8 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/densead/Evaluation12.hpp
       opm/material/densead/Evaluation2.hpp
       opm/material/densead/EvaluationFormat.hpp
+      opm/material/densead/EvaluationSimd.hpp
+      opm/material/densead/FastMath.hpp
       opm/material/densead/EvaluationSpecializations.hpp
       opm/material/densead/Evaluation10.hpp
       opm/material/densead/Evaluation6.hpp
@@ -1047,6 +1071,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/eos/PengRobinsonParams.hpp
       opm/material/eos/PengRobinsonParamsMixture.hpp
       opm/material/eos/PengRobinsonMixture.hpp
+      opm/material/eos/PengRobinsonMixtureBatch.hpp
       opm/material/thermal/ConstantSolidHeatCapLawParams.hpp
       opm/material/thermal/ConstantSolidHeatCapLaw.hpp
       opm/material/thermal/EclHeatcrLaw.hpp
@@ -1321,6 +1346,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/ResCoup/Slaves.hpp
        opm/input/eclipse/Schedule/ResCoup/MasterMinimumTimeStep.hpp
        opm/input/eclipse/Schedule/ResCoup/CouplingFile.hpp
+       opm/input/eclipse/Schedule/VFPEvaluator.hpp
        opm/input/eclipse/Schedule/VFPInjTable.hpp
        opm/input/eclipse/Schedule/VFPProdTable.hpp
        opm/input/eclipse/Schedule/Well/Connection.hpp
@@ -1430,6 +1456,8 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND PUBLIC_HEADER_FILES
+        opm/io/eclipse/ArrayIndex.hpp
+        opm/io/eclipse/AsyncWriter.hpp
         opm/io/eclipse/EclFile.hpp
         opm/io/eclipse/EclIOdata.hpp
         opm/io/eclipse/EclOutput.hpp
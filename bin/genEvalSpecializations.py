@@ -18,6 +18,13 @@ import sys
 import jinja2
 
 maxDerivs = 12
+
+# Specializations with at least this many derivatives use the SIMD kernels of
+# EvaluationSimd.hpp for the product and quotient rules if OPM_DENSEAD_SIMD is
+# enabled. For fewer derivatives, the unrolled scalar code was as fast or
+# faster in the denseadbench example.
+minSimdDerivs = 8
+
 if len(sys.argv) == 2:
     maxDerivs = int(sys.argv[1])
 
@@ -88,6 +95,9 @@ specializationTemplate = \
 #include <stdexcept>
 
 #include <opm/common/utility/gpuDecorators.hpp>
+{% if numDerivs >= minSimdDerivs %}\
+#include <opm/material/densead/EvaluationSimd.hpp>
+{% endif %}\
 
 namespace Opm {
 namespace DenseAd {
@@ -525,9 +535,19 @@ public:
         for (int i = dstart_(); i < dend_(); ++i)
             data_[i] = data_[i] * v + other.data_[i] * u;
 {% else %}\
+{%   if numDerivs >= minSimdDerivs %}\
+#if OPM_DENSEAD_SIMD
+        const auto productRule = [u, v](const auto& uPrime, const auto& vPrime)
+        { return uPrime * v + vPrime * u; };
+        detail::simdTransform<{{numDerivs}}>(&data_[1], &other.data_[1], productRule);
+#else
+{%   endif %}\
 {%   for i in range(1, numDerivs+1) %}\
         data_[{{i}}] = data_[{{i}}] * v + other.data_[{{i}}] * u;
 {%   endfor %}\
+{%   if numDerivs >= minSimdDerivs %}\
+#endif
+{%   endif %}\
 {% endif %}\
 
         return *this;
@@ -555,20 +575,33 @@ public:
         assert(size() == other.size());
 
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
-        // u'v)/v^2.
+        // u'v)/v^2. the derivatives are computed as u'/v - v'*u/v^2, which needs a single
+        // division instead of one per derivative.
         ValueType& u = data_[valuepos_()];
         const ValueType& v = other.value();
+        const ValueType vInv = 1.0/v;
+        const ValueType uvInv2 = u*vInv*vInv;
 {% if numDerivs <= 0 %}\
         for (int idx = dstart_(); idx < dend_(); ++idx) {
             const ValueType& uPrime = data_[idx];
             const ValueType& vPrime = other.data_[idx];
 
-            data_[idx] = (v*uPrime - u*vPrime)/(v*v);
+            data_[idx] = uPrime*vInv - vPrime*uvInv2;
         }
 {% else %}\
+{%   if numDerivs >= minSimdDerivs %}\
+#if OPM_DENSEAD_SIMD
+        const auto quotientRule = [vInv, uvInv2](const auto& uPrime, const auto& vPrime)
+        { return uPrime*vInv - vPrime*uvInv2; };
+        detail::simdTransform<{{numDerivs}}>(&data_[1], &other.data_[1], quotientRule);
+#else
+{%   endif %}\
 {%   for i in range(1, numDerivs+1) %}\
-        data_[{{i}}] = (v*data_[{{i}}] - u*other.data_[{{i}}])/(v*v);
+        data_[{{i}}] = data_[{{i}}]*vInv - other.data_[{{i}}]*uvInv2;
 {%   endfor %}\
+{%   if numDerivs >= minSimdDerivs %}\
+#endif
+{%   endif %}\
 {% endif %}\
         u /= v;
 
@@ -978,7 +1011,7 @@ includeSpecializationsTemplate = \
 print ("Generating generic template classes")
 fileName = "opm/material/densead/Evaluation.hpp"
 template = jinja2.Template(specializationTemplate)
-fileContents = template.render(numDerivs=0, scriptName=os.path.basename(sys.argv[0]))
+fileContents = template.render(numDerivs=0, scriptName=os.path.basename(sys.argv[0]), minSimdDerivs=minSimdDerivs)
 
 f = open(fileName, "w")
 f.write(fileContents)
@@ -986,7 +1019,7 @@ f.close()
 
 fileName = "opm/material/densead/DynamicEvaluation.hpp"
 specializationFileNames.append(fileName)
-fileContents = template.render(numDerivs=-1, scriptName=os.path.basename(sys.argv[0]))
+fileContents = template.render(numDerivs=-1, scriptName=os.path.basename(sys.argv[0]), minSimdDerivs=minSimdDerivs)
 
 f = open(fileName, "w")
 f.write(fileContents)
@@ -999,14 +1032,14 @@ for numDerivs in range(1, maxDerivs + 1):
     specializationFileNames.append(fileName)
 
     template = jinja2.Template(specializationTemplate)
-    fileContents = template.render(numDerivs=numDerivs, scriptName=os.path.basename(sys.argv[0]))
+    fileContents = template.render(numDerivs=numDerivs, scriptName=os.path.basename(sys.argv[0]), minSimdDerivs=minSimdDerivs)
 
     f = open(fileName, "w")
     f.write(fileContents)
     f.close()
 
 template = jinja2.Template(includeSpecializationsTemplate)
-fileContents = template.render(specializationFileNames=specializationFileNames, scriptName=os.path.basename(sys.argv[0]))
+fileContents = template.render(specializationFileNames=specializationFileNames, scriptName=os.path.basename(sys.argv[0]), minSimdDerivs=minSimdDerivs)
 
 f = open("opm/material/densead/EvaluationSpecializations.hpp", "w")
 f.write(fileContents)
@@ -0,0 +1,173 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Benchmark of the tabulated CO2 solubility of BrineCo2Pvt.
+ *
+ * Usage: co2solubilitybench [NUM_STATES [REPETITIONS]]
+ *
+ * The saturated dissolution factor rsSat() is evaluated for NUM_STATES
+ * states distributed over 310-400 K, 5-40 MPa and salinities between 0
+ * and 0.1, once with the exact mutual solubility model and once after
+ * tabulateSolubility().  The time needed to build the tables, the best
+ * time per evaluation of all repetitions and the largest relative
+ * deviation of the tabulated values from the exact ones are reported.
+ */
+#include "config.h"
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace {
+
+    using Evaluation = Opm::DenseAd::Evaluation<double, 3>;
+    using BrineCo2Pvt = Opm::BrineCo2Pvt<double>;
+
+    constexpr double minTemperature = 310.0;
+    constexpr double maxTemperature = 400.0;
+    constexpr double minPressure = 5.0e6;
+    constexpr double maxPressure = 40.0e6;
+    constexpr double maxSalinity = 0.1;
+
+    struct State
+    {
+        Evaluation temperature;
+        Evaluation pressure;
+        Evaluation salinity;
+    };
+
+    // Quasi-random states from an additive recurrence, which covers the
+    // (T, p, salinity) box evenly without any dependency on <random>.
+    std::vector<State> makeStates(const std::size_t numStates)
+    {
+        auto states = std::vector<State>(numStates);
+
+        auto u = std::array<double, 3>{};
+        const auto a = std::array<double, 3>{ 0.8191725134, 0.6710436067, 0.5497004779 };
+        for (auto& state : states) {
+            for (auto d = 0*u.size(); d < u.size(); ++d) {
+                u[d] += a[d];
+                u[d] -= std::floor(u[d]);
+            }
+
+            state.temperature = Evaluation::createVariable(minTemperature + u[0]*(maxTemperature - minTemperature), 0);
+            state.pressure = Evaluation::createVariable(minPressure + u[1]*(maxPressure - minPressure), 1);
+            state.salinity = Evaluation::createVariable(u[2]*maxSalinity, 2);
+        }
+
+        return states;
+    }
+
+    void evaluate(const BrineCo2Pvt&        pvt,
+                  const std::vector<State>& states,
+                  std::vector<Evaluation>&  rs)
+    {
+        rs.resize(states.size());
+
+        for (auto i = 0*states.size(); i < states.size(); ++i) {
+            rs[i] = pvt.rsSat(/*regionIdx=*/0, states[i].temperature,
+                              states[i].pressure, states[i].salinity);
+        }
+    }
+
+    double maxRelDeviation(const std::vector<Evaluation>& exact,
+                           const std::vector<Evaluation>& tabulated)
+    {
+        auto dev = 0.0;
+        for (auto i = 0*exact.size(); i < exact.size(); ++i) {
+            dev = std::max(dev, std::abs(tabulated[i].value() - exact[i].value())
+                           / std::max(std::abs(exact[i].value()), 1.0e-12));
+        }
+
+        return dev;
+    }
+
+    template <class Operation>
+    double timeMs(const int numRepetitions, Operation&& op)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < numRepetitions; ++rep) {
+            const auto start = std::chrono::steady_clock::now();
+            op();
+            const auto stop = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+
+        return best;
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t numStates = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 100000;
+    const int numRepetitions = (argc > 2) ? std::max(1, std::atoi(argv[2])) : 5;
+
+    const auto salinity = std::vector<double>{ 0.0 };
+    const auto exact = BrineCo2Pvt { salinity };
+    auto tabulated = BrineCo2Pvt { salinity };
+
+    auto tableError = 0.0;
+    const double tBuild = timeMs(1, [&]()
+    {
+        tableError = tabulated.tabulateSolubility(minTemperature, maxTemperature,
+                                                  minPressure, maxPressure,
+                                                  /*salinities=*/{ maxSalinity });
+    });
+
+    const auto states = makeStates(numStates);
+
+    auto rsExact = std::vector<Evaluation>{};
+    auto rsTabulated = std::vector<Evaluation>{};
+
+    const double tExact = timeMs(numRepetitions, [&]() { evaluate(exact, states, rsExact); });
+    const double tTabulated = timeMs(numRepetitions, [&]() { evaluate(tabulated, states, rsTabulated); });
+
+    const auto nsPerState = 1.0e6 / static_cast<double>(numStates);
+
+    std::cout << numStates << " states, " << maxTemperature - minTemperature << " K x "
+              << (maxPressure - minPressure) / 1.0e6 << " MPa x salinity 0-" << maxSalinity << '\n'
+              << std::fixed << std::setprecision(1)
+              << "  table build " << std::setw(9) << tBuild << " ms\n"
+              << "  exact       " << std::setw(9) << tExact * nsPerState << " ns per rsSat()\n"
+              << "  tabulated   " << std::setw(9) << tTabulated * nsPerState << " ns per rsSat()\n"
+              << std::scientific << std::setprecision(2)
+              << "  table error (mole fraction) " << tableError << '\n'
+              << "  max relative deviation in Rs " << maxRelDeviation(rsExact, rsTabulated) << '\n';
+
+    return 0;
+}
@@ -0,0 +1,262 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Microbenchmarks of dense-AD Evaluations for expression chains
+ *        which are typical for PVT and saturation function evaluations.
+ *
+ * Usage: denseadbench [REPETITIONS]
+ *
+ * For every number of derivatives between 3 and 12, each kernel is applied
+ * to a batch of cells and the best time per cell of all repetitions is
+ * reported.  Comparing builds with -DOPM_DENSEAD_SIMD=0 and
+ * -DOPM_DENSEAD_SIMD=1 shows the effect of the SIMD kernels of the
+ * Evaluation specializations.
+ *
+ * Builds with -DOPM_DENSEAD_FAST_MATH=1 use the approximations of
+ * FastMath.hpp for exp(), log() and pow().  To quantify what is traded for
+ * the speed, the maximum relative deviation of the values of each kernel
+ * from the same expression evaluated on plain doubles with the functions of
+ * <cmath> is reported as well.
+ *
+ * All kernels and sizes are instantiated in this translation unit, which
+ * may exhaust the inlining budget of the compiler for the larger sizes.  If
+ * their times jump by an order of magnitude, pass e.g.
+ * "--param inline-unit-growth=200" to GCC.
+ */
+#include "config.h"
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/EvaluationSimd.hpp>
+#include <opm/material/densead/FastMath.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Live oil formation volume factor and viscosity, products and quotients
+// of low order polynomials in pressure, temperature and Rs.
+struct LiveOil
+{
+    static constexpr const char* name = "live oil B/mu";
+
+    template <class Evaluation>
+    static Evaluation eval(const Evaluation& p, const Evaluation& T, const Evaluation& Rs)
+    {
+        const Evaluation Bo = (1.0 + 4.0e-4*Rs)*(1.0 + 1.0e-4*(T - 288.15))/(1.0 + 1.5e-9*(p - 1.0e5));
+        const Evaluation muo = 2.0e-3*(1.0 + 5.0e-9*(p - 1.0e5))/(1.0 + 2.0e-3*Rs);
+        const Evaluation rhoo = (850.0 + 0.9*Rs)/Bo;
+
+        return rhoo/(Bo*muo);
+    }
+};
+
+// Water density and viscosity with exponentials in pressure and
+// temperature, as in the PVTW based water model.
+struct Water
+{
+    static constexpr const char* name = "water exp";
+
+    template <class Evaluation>
+    static Evaluation eval(const Evaluation& p, const Evaluation& T, const Evaluation& /*Rs*/)
+    {
+        const Evaluation X = 4.5e-10*(p - 2.0e7);
+        const Evaluation invB = (1.0 + X*(1.0 + X/2.0))/1.02;
+        const Evaluation muw = 5.0e-4*exp(-1.0e-2*(T - 300.0));
+
+        return 1000.0*invB/muw;
+    }
+};
+
+// Phase mobility from a Corey type relative permeability and the
+// viscosity, including a pow() and a division.
+struct Mobility
+{
+    static constexpr const char* name = "mobility pow";
+
+    template <class Evaluation>
+    static Evaluation eval(const Evaluation& p, const Evaluation& T, const Evaluation& Rs)
+    {
+        const Evaluation Sw = Rs/200.0;
+        const Evaluation kr = pow((Sw - 0.2)/(1.0 - 0.2 - 0.15), 2.5);
+        const Evaluation mu = 1.0e-3*(1.0 + 1.0e-8*p)/(1.0 + 1.0e-3*(T - 300.0));
+
+        return kr/mu;
+    }
+};
+
+// Fugacity coefficient of a component in a Peng-Robinson fluid, a chain of
+// logarithms and an exponential, see PengRobinsonMixture.
+struct Fugacity
+{
+    static constexpr const char* name = "fugacity exp";
+
+    template <class Evaluation>
+    static Evaluation eval(const Evaluation& p, const Evaluation& T, const Evaluation& Rs)
+    {
+        const double sqrt2 = std::sqrt(2.0);
+        const Evaluation Z = 0.8 + 2.0e-9*p;
+        const Evaluation A = 3.0e-7*p/T;
+        const Evaluation B = 1.0e-9*p;
+        const Evaluation bi_b = Rs/80.0;
+
+        const Evaluation alpha = -log(Z - B) + bi_b*(Z - 1.0);
+        const Evaluation beta = log((Z + (1.0 - sqrt2)*B)/(Z + (1.0 + sqrt2)*B))*A/(2.0*sqrt2*B);
+
+        return exp(alpha + beta*(1.5 - bi_b));
+    }
+};
+
+// Power law with an exponent which depends on the primary variables, the
+// most expensive variant of pow().
+struct PowerLaw
+{
+    static constexpr const char* name = "pow(x, y)";
+
+    template <class Evaluation>
+    static Evaluation eval(const Evaluation& /*p*/, const Evaluation& T, const Evaluation& Rs)
+    { return pow(Rs/100.0, 1.5 + 1.0e-2*(T - 300.0)); }
+};
+
+constexpr int numCells = 4096;
+
+template <class Evaluation>
+void initCells(std::vector<Evaluation>& p, std::vector<Evaluation>& T, std::vector<Evaluation>& Rs)
+{
+    p.resize(numCells);
+    T.resize(numCells);
+    Rs.resize(numCells);
+    for (int cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        p[cellIdx] = Evaluation::createVariable(1.0e7 + 1.0e4*cellIdx, 0);
+        T[cellIdx] = Evaluation::createVariable(300.0 + 1.0e-3*cellIdx, 1);
+        Rs[cellIdx] = Evaluation::createVariable(60.0 + 1.0e-2*cellIdx, 2);
+
+        // let all derivatives take part in the computations
+        for (int varIdx = 3; varIdx < Evaluation::numVars; ++varIdx) {
+            Rs[cellIdx].setDerivative(varIdx, 1.0e-3*varIdx);
+        }
+    }
+}
+
+template <class Kernel, int numDerivs>
+double timeKernel(const int numRepetitions)
+{
+    using Evaluation = Opm::DenseAd::Evaluation<double, numDerivs>;
+
+    std::vector<Evaluation> p, T, Rs, result(numCells);
+    initCells(p, T, Rs);
+
+    double best = std::numeric_limits<double>::max();
+    for (int rep = 0; rep < numRepetitions; ++rep) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            result[cellIdx] = Kernel::eval(p[cellIdx], T[cellIdx], Rs[cellIdx]);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+
+        best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count() / numCells);
+    }
+
+    // make sure that the results are used
+    double checksum = 0.0;
+    for (const auto& r : result) {
+        checksum += r.derivative(numDerivs - 1);
+    }
+    if (checksum == std::numeric_limits<double>::infinity()) {
+        std::cout << checksum << '\n';
+    }
+
+    return best;
+}
+
+// Maximum relative deviation of the values of a kernel from the expression
+// evaluated on plain doubles, which always uses the functions of <cmath>.
+template <class Kernel>
+double maxDeviation()
+{
+    using Evaluation = Opm::DenseAd::Evaluation<double, 3>;
+
+    std::vector<Evaluation> p, T, Rs;
+    initCells(p, T, Rs);
+
+    double result = 0.0;
+    for (int cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        const double value = Kernel::eval(p[cellIdx], T[cellIdx], Rs[cellIdx]).value();
+        const double reference = Kernel::eval(p[cellIdx].value(), T[cellIdx].value(), Rs[cellIdx].value());
+
+        result = std::max(result, std::abs(value - reference)/std::abs(reference));
+    }
+
+    return result;
+}
+
+template <class Kernel, int... numDerivs>
+void runKernel(const int numRepetitions)
+{
+    std::cout << std::setw(14) << Kernel::name;
+    ((std::cout << std::setw(8) << std::fixed << std::setprecision(1)
+                << timeKernel<Kernel, numDerivs>(numRepetitions)), ...);
+    std::cout << std::setw(10) << std::scientific << std::setprecision(1)
+              << maxDeviation<Kernel>() << '\n';
+}
+
+template <int... numDerivs>
+void runAll(const int numRepetitions)
+{
+    std::cout << "ns per cell, OPM_DENSEAD_SIMD = " << OPM_DENSEAD_SIMD
+              << ", OPM_DENSEAD_FAST_MATH = " << OPM_DENSEAD_FAST_MATH << "\n";
+    std::cout << std::setw(14) << "derivatives";
+    ((std::cout << std::setw(8) << numDerivs), ...);
+    std::cout << std::setw(10) << "max. dev." << '\n';
+
+    runKernel<LiveOil, numDerivs...>(numRepetitions);
+    runKernel<Water, numDerivs...>(numRepetitions);
+    runKernel<Mobility, numDerivs...>(numRepetitions);
+    runKernel<Fugacity, numDerivs...>(numRepetitions);
+    runKernel<PowerLaw, numDerivs...>(numRepetitions);
+
+    std::cout << "\nbounds of the relative error of the approximations: exp "
+              << Opm::DenseAd::fastExpMaxRelativeError << ", log "
+              << Opm::DenseAd::fastLogMaxRelativeError << '\n';
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const int numRepetitions = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 50;
+
+    runAll<3, 4, 5, 6, 7, 8, 9, 10, 11, 12>(numRepetitions);
+
+    return EXIT_SUCCESS;
+}
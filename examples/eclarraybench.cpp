@@ -0,0 +1,126 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Benchmark of the binary encoding and decoding of ECL arrays.
+
+  Usage: eclarraybench [SIZE_MB [REPETITIONS]]
+
+  One INTE, one REAL and one DOUB array of SIZE_MB megabytes each are
+  written to a temporary unformatted file through EclOutput and read back
+  through EclFile.  The best write and read throughput of all repetitions
+  is reported for each array type, and the arrays read back are compared
+  to the ones written.
+*/
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+
+    template <typename T>
+    std::vector<T> makeArray(const std::size_t sizeBytes)
+    {
+        auto data = std::vector<T>(sizeBytes / sizeof(T));
+
+        auto i = T{0};
+        for (auto& x : data) {
+            x = (i += T{1}) / T{7};
+        }
+
+        return data;
+    }
+
+    template <class Operation>
+    double timeMs(const int numRepetitions, Operation&& op)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < numRepetitions; ++rep) {
+            const auto start = std::chrono::steady_clock::now();
+            op();
+            const auto stop = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+
+        return best;
+    }
+
+    template <typename T>
+    bool benchmark(const std::string&           name,
+                   const std::vector<T>&        data,
+                   const std::filesystem::path& fname,
+                   const int                    numRepetitions)
+    {
+        const double tWrite = timeMs(numRepetitions, [&]()
+        {
+            Opm::EclIO::EclOutput output { fname.string(), false };
+            output.write(name, data);
+        });
+
+        auto identical = true;
+        const double tRead = timeMs(numRepetitions, [&]()
+        {
+            Opm::EclIO::EclFile input { fname.string() };
+            input.loadData();
+            identical = identical && (input.get<T>(0) == data);
+        });
+
+        const auto gigaBytes = static_cast<double>(data.size() * sizeof(T)) / 1.0e9;
+
+        std::cout << "  " << name
+                  << "  write " << std::setw(7) << gigaBytes / (tWrite / 1000.0) << " GB/s"
+                  << "  read " << std::setw(7) << gigaBytes / (tRead / 1000.0) << " GB/s"
+                  << "  identical: " << (identical ? "yes" : "NO") << '\n';
+
+        return identical;
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t sizeMB = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 256;
+    const int numRepetitions = (argc > 2) ? std::max(1, std::atoi(argv[2])) : 3;
+
+    const auto sizeBytes = sizeMB * 1024 * 1024;
+    const auto fname = std::filesystem::temp_directory_path() / "ECLARRAYBENCH.INIT";
+
+    std::cout << sizeMB << " MiB per array, best of " << numRepetitions << " repetitions\n"
+              << std::fixed << std::setprecision(2);
+
+    auto identical = benchmark("INTE", makeArray<int>(sizeBytes), fname, numRepetitions);
+    identical = benchmark("REAL", makeArray<float>(sizeBytes), fname, numRepetitions) && identical;
+    identical = benchmark("DOUB", makeArray<double>(sizeBytes), fname, numRepetitions) && identical;
+
+    std::filesystem::remove(fname);
+
+    return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,314 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Benchmark of the aggregation of the restart file well, connection and
+  group arrays (IWEL/SWEL/XWEL/ZWEL, ICON/SCON/XCON, IGRP/SGRP/XGRP/ZGRP).
+
+  Usage: restartaggbench [NUM_WELLS [CONNECTIONS_PER_WELL]]
+
+  A synthetic model with NUM_WELLS vertical producers, each perforated in
+  every layer of the grid, is created and the arrays of one report step
+  are aggregated repeatedly.  Three variants are timed:
+
+    serial    one thread, new aggregators at every report step
+    parallel  all threads, new aggregators at every report step
+    reused    all threads, aggregators and their arrays reused between
+              report steps, as done by EclipseIO
+
+  The arrays of the serial and the parallel variants are compared as well,
+  and must be identical.
+*/
+
+#include <opm/output/data/Wells.hpp>
+#include <opm/output/eclipse/AggregateConnectionData.hpp>
+#include <opm/output/eclipse/AggregateGroupData.hpp>
+#include <opm/output/eclipse/AggregateWellData.hpp>
+#include <opm/output/eclipse/WriteRestartHelpers.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/Well/Well.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+    std::string wellName(const std::size_t w)
+    {
+        return "W" + std::to_string(w + 1);
+    }
+
+    Opm::Deck makeDeck(const std::size_t numWells, const std::size_t nz)
+    {
+        const auto nxy = static_cast<std::size_t>(std::ceil(std::sqrt(numWells)));
+        const auto numCells = nxy * nxy * nz;
+        const auto numGroups = std::max(numWells / 100, std::size_t{1});
+
+        std::ostringstream deck;
+
+        deck << "RUNSPEC\nOIL\nWATER\nMETRIC\n"
+             << "DIMENS\n" << nxy << ' ' << nxy << ' ' << nz << " /\n"
+             << "WELLDIMS\n" << numWells << ' ' << nz << ' ' << numGroups + 1
+             << ' ' << numWells << " /\n"
+             << "TABDIMS\n/\n"
+             << "START\n1 JAN 2020 /\n"
+             << "GRID\n"
+             << "DXV\n" << nxy << "*100 /\n"
+             << "DYV\n" << nxy << "*100 /\n"
+             << "DZV\n" << nz << "*5 /\n"
+             << "TOPS\n" << nxy*nxy << "*2000 /\n"
+             << "PORO\n" << numCells << "*0.2 /\n"
+             << "PERMX\n" << numCells << "*100 /\n"
+             << "PERMY\n" << numCells << "*100 /\n"
+             << "PERMZ\n" << numCells << "*10 /\n"
+             << "PROPS\n"
+             << "SWOF\n0.1 0 1 0\n1.0 1 0 0 /\n"
+             << "PVDO\n100 1.0 1.0\n500 0.99 1.0 /\n"
+             << "PVTW\n200 1.0 4e-5 0.5 0 /\n"
+             << "DENSITY\n800 1000 1 /\n"
+             << "ROCK\n200 1e-5 /\n"
+             << "SCHEDULE\n";
+
+        deck << "WELSPECS\n";
+        for (auto w = 0*numWells; w < numWells; ++w) {
+            deck << '\'' << wellName(w) << "' 'G" << (w % numGroups) + 1 << "' "
+                 << (w % nxy) + 1 << ' ' << (w / nxy) + 1 << " 1* 'OIL' /\n";
+        }
+        deck << "/\n";
+
+        deck << "COMPDAT\n";
+        for (auto w = 0*numWells; w < numWells; ++w) {
+            deck << '\'' << wellName(w) << "' 2* 1 " << nz << " 'OPEN' 2* 0.2 /\n";
+        }
+        deck << "/\n";
+
+        deck << "WCONPROD\n'W*' 'OPEN' 'ORAT' 100 4* 50 /\n/\n"
+             << "TSTEP\n10 /\n";
+
+        return Opm::Parser{}.parseString(deck.str());
+    }
+
+    Opm::data::Wells makeWellResults(const Opm::Schedule&    sched,
+                                     const Opm::EclipseGrid& grid,
+                                     const std::size_t       simStep)
+    {
+        using rt = Opm::data::Rates::opt;
+
+        auto xw = Opm::data::Wells {};
+        for (const auto& wname : sched.wellNames(simStep)) {
+            auto& well = xw[wname];
+            well.bhp = 150.0e5;
+            well.thp = 50.0e5;
+            well.rates.set(rt::oil, 1.0e-3).set(rt::wat, 2.0e-4);
+
+            for (const auto* conn : sched.getWell(wname, simStep).getConnections().output(grid)) {
+                auto& xc = well.connections.emplace_back();
+                xc.index = conn->global_index();
+                xc.pressure = 160.0e5;
+                xc.trans_factor = conn->CF();
+                xc.rates.set(rt::oil, 1.0e-5).set(rt::wat, 2.0e-6);
+            }
+        }
+
+        return xw;
+    }
+
+    struct Aggregators
+    {
+        std::optional<Opm::RestartIO::Helpers::AggregateWellData>       wellData{};
+        std::optional<Opm::RestartIO::Helpers::AggregateConnectionData> connData{};
+        std::optional<Opm::RestartIO::Helpers::AggregateGroupData>      groupData{};
+    };
+
+    template <class Aggregator>
+    Aggregator& prepare(std::optional<Aggregator>& aggregator,
+                        const std::vector<int>&    ih,
+                        const bool                 reuse)
+    {
+        if (reuse && aggregator.has_value()) {
+            aggregator->reset(ih);
+        }
+        else {
+            aggregator.emplace(ih);
+        }
+
+        return *aggregator;
+    }
+
+    class Model
+    {
+    public:
+        Model(const std::size_t numWells, const std::size_t nz)
+            : deck_  { makeDeck(numWells, nz) }
+            , es_    { deck_ }
+            , sched_ { deck_, es_, std::make_shared<Opm::Python>() }
+            , ih_    { Opm::RestartIO::Helpers::createInteHead(es_, es_.getInputGrid(),
+                                                               sched_, 0.0, 1, 1, simStep) }
+            , xw_    { makeWellResults(sched_, es_.getInputGrid(), simStep) }
+            , smry_  { Opm::TimeService::now(), 0.0 }
+        {}
+
+        void aggregate(Aggregators& agg, const bool reuse) const
+        {
+            const auto& grid = this->es_.getInputGrid();
+
+            auto& wellData = prepare(agg.wellData, this->ih_, reuse);
+            wellData.captureDeclaredWellData(this->sched_, this->es_.tracer(), simStep,
+                                             this->actionState_, this->wtestState_,
+                                             this->smry_, this->ih_);
+            wellData.captureDynamicWellData(this->sched_, this->es_.tracer(), simStep,
+                                            this->xw_, this->smry_);
+
+            auto& connData = prepare(agg.connData, this->ih_, reuse);
+            connData.captureDeclaredConnData(this->sched_, grid, this->sched_.getUnits(),
+                                             this->xw_, this->smry_, simStep);
+
+            auto& groupData = prepare(agg.groupData, this->ih_, reuse);
+            groupData.captureDeclaredGroupData(this->sched_, this->sched_.getUnits(),
+                                               simStep, this->smry_, this->ih_);
+        }
+
+        std::size_t numConnections() const
+        {
+            auto n = std::size_t{0};
+            for (const auto& xw : this->xw_) {
+                n += xw.second.connections.size();
+            }
+
+            return n;
+        }
+
+    private:
+        static constexpr std::size_t simStep = 0;
+
+        Opm::Deck deck_;
+        Opm::EclipseState es_;
+        Opm::Schedule sched_;
+        std::vector<int> ih_;
+        Opm::data::Wells xw_;
+        Opm::SummaryState smry_;
+        Opm::Action::State actionState_{};
+        Opm::WellTestState wtestState_{};
+    };
+
+    bool identical(const Aggregators& a, const Aggregators& b)
+    {
+        return (a.wellData->getIWell() == b.wellData->getIWell())
+            && (a.wellData->getSWell() == b.wellData->getSWell())
+            && (a.wellData->getXWell() == b.wellData->getXWell())
+            && (a.connData->getIConn() == b.connData->getIConn())
+            && (a.connData->getSConn() == b.connData->getSConn())
+            && (a.connData->getXConn() == b.connData->getXConn())
+            && (a.groupData->getIGroup() == b.groupData->getIGroup())
+            && (a.groupData->getSGroup() == b.groupData->getSGroup())
+            && (a.groupData->getXGroup() == b.groupData->getXGroup());
+    }
+
+    void setNumThreads([[maybe_unused]] const int numThreads)
+    {
+#ifdef _OPENMP
+        omp_set_num_threads(numThreads);
+#endif
+    }
+
+    template <class Aggregate>
+    double timeMsPerStep(const int numRepetitions, Aggregate&& aggregate)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < numRepetitions; ++rep) {
+            const auto start = std::chrono::steady_clock::now();
+            aggregate();
+            const auto stop = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+
+        return best;
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t numWells = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 1000;
+    const std::size_t nz = (argc > 2) ? std::max(1, std::atoi(argv[2])) : 50;
+    const int numRepetitions = 10;
+
+#ifdef _OPENMP
+    const int maxThreads = omp_get_max_threads();
+#else
+    const int maxThreads = 1;
+#endif
+
+    const auto model = Model { numWells, nz };
+
+    auto serial = Aggregators{};
+    auto parallel = Aggregators{};
+    auto reused = Aggregators{};
+
+    setNumThreads(1);
+    const double tSerial = timeMsPerStep(numRepetitions,
+                                         [&]() { model.aggregate(serial, false); });
+
+    setNumThreads(maxThreads);
+    const double tParallel = timeMsPerStep(numRepetitions,
+                                           [&]() { model.aggregate(parallel, false); });
+
+    const double tReused = timeMsPerStep(numRepetitions,
+                                         [&]() { model.aggregate(reused, true); });
+
+    std::cout << numWells << " wells, " << model.numConnections() << " connections, "
+              << maxThreads << " threads\n"
+              << std::fixed << std::setprecision(2)
+              << "  serial   " << std::setw(10) << tSerial << " ms per report step\n"
+              << "  parallel " << std::setw(10) << tParallel << " ms per report step\n"
+              << "  reused   " << std::setw(10) << tReused << " ms per report step\n"
+              << "  identical arrays: "
+              << ((identical(serial, parallel) && identical(serial, reused)) ? "yes" : "NO")
+              << '\n';
+
+    return 0;
+}
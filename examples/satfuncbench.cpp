@@ -0,0 +1,290 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Benchmark of the baked saturation function tables of
+ *        EclMaterialLawManager.
+ *
+ * Usage: satfuncbench [NUM_CELLS [REPETITIONS]]
+ *
+ * A three-phase model with SWOF/SGOF tables and cell-wise endpoint scaling
+ * (SWL, SWCR, SGCR) is set up twice.  The saturation functions of one of
+ * the two material law managers are then replaced by baked tables using
+ * bakeSaturationFunctions().  For both managers, the capillary pressures
+ * and relative permeabilities of all cells are evaluated at a number of
+ * saturations with DenseAd derivatives, and the best time per evaluation
+ * of all repetitions is reported together with the largest deviation of
+ * the baked results from the regular ones.
+ */
+#include "config.h"
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
+#include <opm/material/fluidstates/SimpleModularFluidState.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    constexpr int numPhases = 3;
+    constexpr int waterPhaseIdx = 0;
+    constexpr int oilPhaseIdx = 1;
+    constexpr int gasPhaseIdx = 2;
+
+    using MaterialTraits = Opm::ThreePhaseMaterialTraits<double,
+                                                         waterPhaseIdx,
+                                                         oilPhaseIdx,
+                                                         gasPhaseIdx>;
+
+    using MaterialLawManager = Opm::EclMaterialLawManager<MaterialTraits>;
+    using MaterialLaw = MaterialLawManager::MaterialLaw;
+
+    using Evaluation = Opm::DenseAd::Evaluation<double, 3>;
+
+    using FluidState = Opm::SimpleModularFluidState<Evaluation,
+                                                    /*numPhases=*/3,
+                                                    /*numComponents=*/3,
+                                                    void,
+                                                    /*storePressure=*/false,
+                                                    /*storeTemperature=*/false,
+                                                    /*storeComposition=*/false,
+                                                    /*storeFugacity=*/false,
+                                                    /*storeSaturation=*/true,
+                                                    /*storeDensity=*/false,
+                                                    /*storeViscosity=*/false,
+                                                    /*storeEnthalpy=*/false>;
+
+    struct Result
+    {
+        std::array<Evaluation, numPhases> pc{};
+        std::array<Evaluation, numPhases> kr{};
+    };
+
+    std::string makeDeck(const std::size_t numCells)
+    {
+        std::ostringstream deck;
+
+        deck << "RUNSPEC\nOIL\nGAS\nWATER\nMETRIC\nENDSCALE\n/\n"
+             << "DIMENS\n" << numCells << " 1 1 /\n"
+             << "TABDIMS\n/\n"
+             << "GRID\n"
+             << "DX\n" << numCells << "*100 /\n"
+             << "DY\n" << numCells << "*100 /\n"
+             << "DZ\n" << numCells << "*5 /\n"
+             << "TOPS\n" << numCells << "*2000 /\n"
+             << "PORO\n" << numCells << "*0.2 /\n"
+             << "PROPS\n"
+             << "SWOF\n"
+             << "0.10 0.0    1.0  2.0\n"
+             << "0.20 0.02   0.75 1.2\n"
+             << "0.35 0.08   0.45 0.6\n"
+             << "0.50 0.18   0.22 0.3\n"
+             << "0.65 0.32   0.08 0.15\n"
+             << "0.80 0.55   0.01 0.05\n"
+             << "1.00 1.0    0.0  0.0 /\n"
+             << "SGOF\n"
+             << "0.00 0.0    1.0  0.0\n"
+             << "0.05 0.0    0.85 0.01\n"
+             << "0.20 0.07   0.5  0.05\n"
+             << "0.40 0.25   0.2  0.12\n"
+             << "0.60 0.5    0.05 0.2\n"
+             << "0.90 1.0    0.0  0.3 /\n";
+
+        // Eight distinct combinations of scaled endpoints.
+        auto endpoint = [&deck, numCells](const std::string& kw, const double base, const double step)
+        {
+            deck << kw << '\n';
+            for (auto cell = 0*numCells; cell < numCells; ++cell) {
+                deck << base + step*(cell % 8) << ((cell % 10 == 9) ? '\n' : ' ');
+            }
+            deck << "/\n";
+        };
+
+        endpoint("SWL" , 0.10, 0.005);
+        endpoint("SWCR", 0.15, 0.010);
+        endpoint("SGCR", 0.03, 0.002);
+
+        return deck.str();
+    }
+
+    void initManager(const Opm::EclipseState& es,
+                     const std::size_t        numCells,
+                     MaterialLawManager&      manager)
+    {
+        const auto lookup = std::function<std::vector<int>(const Opm::FieldPropsManager&, const std::string&, bool)> {
+            [](const Opm::FieldPropsManager& fp, const std::string& kw, const bool needsTranslation)
+            {
+                auto dest = fp.get_int(kw);
+                for (auto& i : dest) {
+                    i -= needsTranslation;
+                }
+
+                return dest;
+            }
+        };
+
+        const auto sameIdx = std::function<unsigned(unsigned)> {
+            [](const unsigned elemIdx) { return elemIdx; }
+        };
+
+        manager.initFromState(es);
+        manager.initParamsForElements(es, numCells, lookup, sameIdx);
+    }
+
+    std::vector<FluidState> makeFluidStates()
+    {
+        auto states = std::vector<FluidState>{};
+
+        for (int i = 0; i <= 10; ++i) {
+            for (int j = 0; i + j <= 10; j += 2) {
+                const auto sw = 0.05 + 0.09*i;
+                const auto sg = 0.09*j;
+
+                auto& fs = states.emplace_back();
+                fs.setSaturation(waterPhaseIdx, Evaluation::createVariable(sw, 0));
+                fs.setSaturation(gasPhaseIdx, Evaluation::createVariable(sg, 1));
+                fs.setSaturation(oilPhaseIdx, 1.0 - fs.saturation(waterPhaseIdx) - fs.saturation(gasPhaseIdx));
+            }
+        }
+
+        return states;
+    }
+
+    void evaluate(const MaterialLawManager&      manager,
+                  const std::size_t              numCells,
+                  const std::vector<FluidState>& states,
+                  std::vector<Result>&           results)
+    {
+        results.resize(numCells * states.size());
+
+        auto result = results.begin();
+        for (auto cell = 0*numCells; cell < numCells; ++cell) {
+            const auto& params = manager.materialLawParams(cell);
+
+            for (const auto& fs : states) {
+                MaterialLaw::capillaryPressures(result->pc, params, fs);
+                MaterialLaw::relativePermeabilities(result->kr, params, fs);
+                ++result;
+            }
+        }
+    }
+
+    double maxDeviation(const std::vector<Result>& a, const std::vector<Result>& b)
+    {
+        auto dev = 0.0;
+
+        auto update = [&dev](const Evaluation& x, const Evaluation& y, const double scale)
+        {
+            dev = std::max(dev, std::abs(x.value() - y.value()) / scale);
+            for (int d = 0; d < Evaluation::numVars; ++d) {
+                dev = std::max(dev, std::abs(x.derivative(d) - y.derivative(d)) / scale);
+            }
+        };
+
+        for (auto i = 0*a.size(); i < a.size(); ++i) {
+            for (int phase = 0; phase < numPhases; ++phase) {
+                update(a[i].kr[phase], b[i].kr[phase], 1.0);
+                update(a[i].pc[phase], b[i].pc[phase], 1.0 + std::abs(a[i].pc[phase].value()));
+            }
+        }
+
+        return dev;
+    }
+
+    template <class Evaluate>
+    double timeNs(const int numRepetitions, const std::size_t numEvaluations, Evaluate&& eval)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < numRepetitions; ++rep) {
+            const auto start = std::chrono::steady_clock::now();
+            eval();
+            const auto stop = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+        }
+
+        return best / static_cast<double>(numEvaluations);
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t numCells = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 10000;
+    const int numRepetitions = (argc > 2) ? std::max(1, std::atoi(argv[2])) : 5;
+
+    const auto deck = Opm::Parser{}.parseString(makeDeck(numCells));
+    const auto es = Opm::EclipseState { deck };
+
+    auto regular = MaterialLawManager{};
+    initManager(es, numCells, regular);
+
+    auto baked = MaterialLawManager{};
+    initManager(es, numCells, baked);
+    const auto report = baked.bakeSaturationFunctions();
+
+    const auto states = makeFluidStates();
+    const auto numEvaluations = numCells * states.size();
+
+    auto regularResults = std::vector<Result>{};
+    auto bakedResults = std::vector<Result>{};
+
+    const double tRegular = timeNs(numRepetitions, numEvaluations,
+                                   [&]() { evaluate(regular, numCells, states, regularResults); });
+
+    const double tBaked = timeNs(numRepetitions, numEvaluations,
+                                 [&]() { evaluate(baked, numCells, states, bakedResults); });
+
+    std::cout << numCells << " cells, " << states.size() << " saturations per cell, "
+              << report.numTables << " tables, " << report.numBaked << " baked and "
+              << report.numSkipped << " regular two-phase laws\n"
+              << std::fixed << std::setprecision(1)
+              << "  regular " << std::setw(8) << tRegular << " ns per evaluation (pc + kr)\n"
+              << "  baked   " << std::setw(8) << tBaked << " ns per evaluation (pc + kr)\n"
+              << std::scientific << std::setprecision(2)
+              << "  table error    pcnw " << report.maxError.pcnw
+              << "  krw " << report.maxError.krw
+              << "  krn " << report.maxError.krn << '\n'
+              << "  max deviation  " << maxDeviation(regularResults, bakedResults) << '\n';
+
+    return 0;
+}
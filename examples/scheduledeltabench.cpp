@@ -0,0 +1,234 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Benchmark of the re-transfer of a Schedule after it has been modified
+  in the same way as a PYACTION would do.
+
+  Usage: scheduledeltabench [NUM_WELLS [NUM_REPORT_STEPS]]
+
+  A synthetic schedule with NUM_WELLS producers and NUM_REPORT_STEPS
+  report steps, with the rate target of a few wells changed at every step,
+  is created.  WCONPROD for one well is then inserted halfway through the
+  schedule.  Two ways of sending the modified schedule to a process which
+  holds the original are timed:
+
+    full   serialize and deserialize the complete schedule
+    delta  serialize only the changes relative to the original and apply
+           them to the receiver's copy
+
+  The receiver's schedule must equal the modified schedule in both cases.
+*/
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/Action/Actions.hpp>
+#include <opm/input/eclipse/Schedule/Action/SimulatorUpdate.hpp>
+#include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
+#include <opm/input/eclipse/Schedule/Group/GConSale.hpp>
+#include <opm/input/eclipse/Schedule/Group/GConSump.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp>
+#include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
+#include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
+#include <opm/input/eclipse/Schedule/Network/Balance.hpp>
+#include <opm/input/eclipse/Schedule/Network/ExtNetwork.hpp>
+#include <opm/input/eclipse/Schedule/RFTConfig.hpp>
+#include <opm/input/eclipse/Schedule/RPTConfig.hpp>
+#include <opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
+#include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
+#include <opm/input/eclipse/Schedule/Well/PAvg.hpp>
+#include <opm/input/eclipse/Schedule/Well/WDFAC.hpp>
+#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
+#include <opm/input/eclipse/Schedule/Well/WVFPDP.hpp>
+#include <opm/input/eclipse/Schedule/Well/WVFPEXP.hpp>
+#include <opm/input/eclipse/Schedule/Well/Well.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellBrineProperties.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellEconProductionLimits.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellFoamProperties.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellMICPProperties.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellPolymerProperties.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestConfig.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTracerProperties.hpp>
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    std::string wellName(const std::size_t w)
+    {
+        return "W" + std::to_string(w + 1);
+    }
+
+    Opm::Deck makeDeck(const std::size_t numWells, const std::size_t numSteps)
+    {
+        const auto nxy = static_cast<std::size_t>(std::ceil(std::sqrt(numWells)));
+
+        std::ostringstream deck;
+
+        deck << "RUNSPEC\nOIL\nWATER\nMETRIC\n"
+             << "DIMENS\n" << nxy << ' ' << nxy << " 1 /\n"
+             << "WELLDIMS\n" << numWells << " 1 2 " << numWells << " /\n"
+             << "TABDIMS\n/\n"
+             << "START\n1 JAN 2020 /\n"
+             << "GRID\n"
+             << "DXV\n" << nxy << "*100 /\n"
+             << "DYV\n" << nxy << "*100 /\n"
+             << "DZV\n5 /\n"
+             << "TOPS\n" << nxy*nxy << "*2000 /\n"
+             << "PORO\n" << nxy*nxy << "*0.2 /\n"
+             << "PERMX\n" << nxy*nxy << "*100 /\n"
+             << "PERMY\n" << nxy*nxy << "*100 /\n"
+             << "PERMZ\n" << nxy*nxy << "*10 /\n"
+             << "PROPS\n"
+             << "SWOF\n0.1 0 1 0\n1.0 1 0 0 /\n"
+             << "PVDO\n100 1.0 1.0\n500 0.99 1.0 /\n"
+             << "PVTW\n200 1.0 4e-5 0.5 0 /\n"
+             << "DENSITY\n800 1000 1 /\n"
+             << "ROCK\n200 1e-5 /\n"
+             << "SCHEDULE\n";
+
+        deck << "WELSPECS\n";
+        for (auto w = 0*numWells; w < numWells; ++w) {
+            deck << '\'' << wellName(w) << "' 'G1' "
+                 << (w % nxy) + 1 << ' ' << (w / nxy) + 1 << " 1* 'OIL' /\n";
+        }
+        deck << "/\n";
+
+        deck << "COMPDAT\n";
+        for (auto w = 0*numWells; w < numWells; ++w) {
+            deck << '\'' << wellName(w) << "' 2* 1 1 'OPEN' 2* 0.2 /\n";
+        }
+        deck << "/\n";
+
+        deck << "WCONPROD\n'W*' 'OPEN' 'ORAT' 100 4* 50 /\n/\n";
+
+        for (auto step = 0*numSteps; step < numSteps; ++step) {
+            deck << "WCONPROD\n";
+            for (auto w = step % 10; w < numWells; w += numWells / 4 + 1) {
+                deck << '\'' << wellName(w) << "' 'OPEN' 'ORAT' " << 100 + step << " 4* 50 /\n";
+            }
+            deck << "/\nTSTEP\n10 /\n";
+        }
+
+        return Opm::Parser{}.parseString(deck.str());
+    }
+
+    std::vector<std::unique_ptr<Opm::DeckKeyword>> makeUpdate()
+    {
+        const auto deck = Opm::Parser{}.parseString("WCONPROD\n'W1' 'SHUT' 'ORAT' 10 4* 50 /\n/\n");
+
+        std::vector<std::unique_ptr<Opm::DeckKeyword>> keywords;
+        for (const auto& keyword : deck) {
+            keywords.push_back(std::make_unique<Opm::DeckKeyword>(keyword));
+        }
+
+        return keywords;
+    }
+
+    template <class Transfer>
+    double timeMs(const int numRepetitions, Transfer&& transfer)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < numRepetitions; ++rep) {
+            const auto start = std::chrono::steady_clock::now();
+            transfer();
+            const auto stop = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+
+        return best;
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t numWells = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 500;
+    const std::size_t numSteps = (argc > 2) ? std::max(2, std::atoi(argv[2])) : 500;
+    const int numRepetitions = 5;
+
+    const auto deck = makeDeck(numWells, numSteps);
+    const auto es = Opm::EclipseState { deck };
+    const auto original = Opm::Schedule { deck, es, std::make_shared<Opm::Python>() };
+
+    auto sched = original;
+    auto update = makeUpdate();
+    sched.applyKeywords(update, numSteps / 2);
+
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer ser(packer);
+
+    std::size_t fullBytes = 0;
+    auto fullReceiver = Opm::Schedule{};
+    const double tFull = timeMs(numRepetitions, [&]() {
+        ser.pack(sched);
+        fullBytes = ser.position();
+
+        fullReceiver = Opm::Schedule{};
+        ser.unpack(fullReceiver);
+    });
+
+    std::size_t deltaBytes = 0;
+    auto deltaReceiver = original;
+    const double tDelta = timeMs(numRepetitions, [&]() {
+        ser.pack(Opm::Schedule::Delta { sched, original });
+        deltaBytes = ser.position();
+
+        deltaReceiver = original;
+        auto delta = Opm::Schedule::Delta { deltaReceiver };
+        ser.unpack(delta);
+    });
+
+    std::cout << numWells << " wells, " << numSteps << " report steps, update at step "
+              << numSteps / 2 << '\n'
+              << std::fixed << std::setprecision(2)
+              << "  full  " << std::setw(12) << fullBytes << " bytes "
+              << std::setw(10) << tFull << " ms\n"
+              << "  delta " << std::setw(12) << deltaBytes << " bytes "
+              << std::setw(10) << tDelta << " ms\n"
+              << "  identical schedules: "
+              << (((fullReceiver == sched) && (deltaReceiver == sched)) ? "yes" : "NO")
+              << '\n';
+
+    return 0;
+}
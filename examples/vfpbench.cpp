@@ -0,0 +1,274 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Microbenchmark of the evaluation of a VFPPROD table for many wells.
+
+  Usage: vfpbench [NUM_WELLS [NUM_ITERATIONS]]
+
+  Every well is evaluated once per "Newton iteration", with inputs that
+  drift slightly between the iterations, as they do in a converging
+  simulation. Three variants are timed:
+
+    reference  interval search and corner lookup in the 5D table for every
+               evaluation, as done by a straightforward implementation
+    cold       VFPProdEvaluator with a fresh cell for every evaluation
+    cached     VFPProdEvaluator with one cell per well that is kept across
+               the iterations
+
+  The maximum deviation between the reference and the evaluator results
+  is printed as well.
+*/
+
+#include <opm/input/eclipse/Schedule/VFPEvaluator.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+    std::vector<double> linspace(const double a, const double b, const std::size_t n)
+    {
+        std::vector<double> x(n);
+        for (auto i = 0*n; i < n; ++i) {
+            x[i] = a + (b - a) * i / (n - 1);
+        }
+        return x;
+    }
+
+    Opm::VFPProdTable makeTable()
+    {
+        const auto flo = linspace(1.0e-4, 0.1, 20);
+        const auto thp = linspace(1.0e6, 1.0e7, 10);
+        const auto wfr = linspace(0.0, 0.95, 6);
+        const auto gfr = linspace(10.0, 500.0, 6);
+        const auto alq = linspace(0.0, 10.0, 4);
+
+        std::vector<double> data;
+        data.reserve(flo.size() * thp.size() * wfr.size() * gfr.size() * alq.size());
+        for (const auto t : thp) {
+            for (const auto w : wfr) {
+                for (const auto g : gfr) {
+                    for (const auto a : alq) {
+                        for (const auto f : flo) {
+                            data.push_back(t + 1.0e7 * (1.0 + w) * std::sqrt(f)
+                                           + 1.0e4 * g / (1.0 + a) + 1.0e8 * f * f);
+                        }
+                    }
+                }
+            }
+        }
+
+        return { 1, 2000.0,
+                 Opm::VFPProdTable::FLO_TYPE::FLO_LIQ,
+                 Opm::VFPProdTable::WFR_TYPE::WFR_WCT,
+                 Opm::VFPProdTable::GFR_TYPE::GFR_GOR,
+                 Opm::VFPProdTable::ALQ_TYPE::ALQ_GRAT,
+                 flo, thp, wfr, gfr, alq, data };
+    }
+
+    // Straightforward evaluation without any state
+    class Reference
+    {
+    public:
+        explicit Reference(const Opm::VFPProdTable& table)
+            : table_(table)
+        {}
+
+        Opm::VFPEvaluation bhp(const Opm::VFPProdEvaluator::Input& x) const
+        {
+            const std::array<Interval, 5> iv {
+                find(table_.getTHPAxis(), x.thp), find(table_.getWFRAxis(), x.wfr),
+                find(table_.getGFRAxis(), x.gfr), find(table_.getALQAxis(), x.alq),
+                find(table_.getFloAxis(), x.flo)
+            };
+
+            // Corner values, THP is the most significant bit
+            std::array<double, 32> v;
+            for (int c = 0; c < 32; ++c) {
+                std::array<std::size_t, 5> idx;
+                for (int k = 0; k < 5; ++k) {
+                    idx[k] = ((c >> (4 - k)) & 1) ? iv[k].upper : iv[k].lower;
+                }
+                v[c] = table_(idx[0], idx[1], idx[2], idx[3], idx[4]);
+            }
+
+            std::array<std::array<double, 16>, 5> d;
+            int len = 32;
+            for (int k = 0; k < 5; ++k) {
+                const int half = len / 2;
+                for (int j = 0; j < k; ++j) {
+                    for (int i = 0; i < half; ++i) {
+                        d[j][i] += iv[k].factor * (d[j][i + half] - d[j][i]);
+                    }
+                }
+                for (int i = 0; i < half; ++i) {
+                    const double diff = v[i + half] - v[i];
+                    d[k][i] = diff * iv[k].invDist;
+                    v[i] += iv[k].factor * diff;
+                }
+                len = half;
+            }
+
+            return { v[0], d[0][0], d[1][0], d[2][0], d[3][0], d[4][0] };
+        }
+
+    private:
+        struct Interval
+        {
+            std::size_t lower;
+            std::size_t upper;
+            double factor;
+            double invDist;
+        };
+
+        static Interval find(const std::vector<double>& axis, const double x)
+        {
+            if (axis.size() == 1) {
+                return { 0, 0, 0.0, 0.0 };
+            }
+
+            const auto i = static_cast<std::size_t>
+                (std::upper_bound(axis.begin() + 1, axis.end() - 1, x) - axis.begin()) - 1;
+            const double invDist = 1.0 / (axis[i + 1] - axis[i]);
+
+            return { i, i + 1, (x - axis[i]) * invDist, invDist };
+        }
+
+        const Opm::VFPProdTable& table_;
+    };
+
+    using Inputs = std::vector<Opm::VFPProdEvaluator::Input>;
+
+    // Inputs of all wells for all iterations
+    std::vector<Inputs> makeInputs(const std::size_t numWells, const int numIterations)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> u(0.0, 1.0);
+
+        std::vector<Inputs> inputs(numIterations, Inputs(numWells));
+        for (auto w = 0*numWells; w < numWells; ++w) {
+            auto x = Opm::VFPProdEvaluator::Input {
+                1.0e-3 + 0.09 * u(gen), 1.5e6 + 8.0e6 * u(gen), 0.9 * u(gen),
+                20.0 + 450.0 * u(gen), 9.0 * u(gen)
+            };
+
+            for (int it = 0; it < numIterations; ++it) {
+                inputs[it][w] = x;
+
+                // Converging: the changes shrink with every iteration
+                const double scale = std::pow(0.3, it + 1);
+                x.flo *= 1.0 + scale * 0.1 * (u(gen) - 0.5);
+                x.thp *= 1.0 + scale * 0.1 * (u(gen) - 0.5);
+                x.wfr *= 1.0 + scale * 0.05 * (u(gen) - 0.5);
+            }
+        }
+
+        return inputs;
+    }
+
+    template <class Evaluate>
+    double timeNsPerEvaluation(const std::vector<Inputs>& inputs,
+                               const int numRepetitions,
+                               Evaluate&& evaluate)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < numRepetitions; ++rep) {
+            const auto start = std::chrono::steady_clock::now();
+            evaluate();
+            const auto stop = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+        }
+
+        return best / (inputs.size() * inputs.front().size());
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t numWells = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 1000;
+    const int numIterations = (argc > 2) ? std::max(1, std::atoi(argv[2])) : 8;
+    const int numRepetitions = 20;
+
+    const auto table = makeTable();
+    const auto reference = Reference { table };
+    const auto evaluator = Opm::VFPProdEvaluator { table };
+    const auto inputs = makeInputs(numWells, numIterations);
+
+    std::vector<Opm::VFPEvaluation> refResults(numWells), results(numWells);
+    std::vector<Opm::VFPProdEvaluator::Cell> cells;
+    double maxDeviation = 0.0;
+
+    const double tReference = timeNsPerEvaluation(inputs, numRepetitions, [&]() {
+        for (const auto& it : inputs) {
+            for (auto w = 0*numWells; w < numWells; ++w) {
+                refResults[w] = reference.bhp(it[w]);
+            }
+        }
+    });
+
+    const double tCold = timeNsPerEvaluation(inputs, numRepetitions, [&]() {
+        for (const auto& it : inputs) {
+            for (auto w = 0*numWells; w < numWells; ++w) {
+                auto cell = Opm::VFPProdEvaluator::Cell {};
+                results[w] = evaluator.bhp(it[w], cell);
+            }
+        }
+    });
+
+    const double tCached = timeNsPerEvaluation(inputs, numRepetitions, [&]() {
+        cells.clear();
+        for (const auto& it : inputs) {
+            evaluator.bhp(it, cells, results);
+        }
+    });
+
+    for (auto w = 0*numWells; w < numWells; ++w) {
+        const auto& r = refResults[w];
+        const auto& e = results[w];
+        for (const auto& [a, b] : { std::pair { r.value, e.value }, std::pair { r.dthp, e.dthp },
+                                    std::pair { r.dwfr, e.dwfr }, std::pair { r.dgfr, e.dgfr },
+                                    std::pair { r.dalq, e.dalq }, std::pair { r.dflo, e.dflo } }) {
+            maxDeviation = std::max(maxDeviation, std::abs(a - b) / std::max(std::abs(a), 1.0));
+        }
+    }
+
+    std::cout << "VFPPROD table with " << table.getTable().size() << " values, "
+              << numWells << " wells, " << numIterations << " iterations\n"
+              << std::fixed << std::setprecision(1)
+              << "  reference " << std::setw(8) << tReference << " ns per evaluation\n"
+              << "  cold      " << std::setw(8) << tCold << " ns per evaluation\n"
+              << "  cached    " << std::setw(8) << tCached << " ns per evaluation\n"
+              << std::scientific << std::setprecision(1)
+              << "  max. relative deviation " << maxDeviation << '\n';
+
+    return 0;
+}
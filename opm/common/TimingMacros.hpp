@@ -24,6 +24,10 @@
 // OPM_TIMEFUNCTION - time block of main part of codes which do not effect performance with name from function
 // OPM_TIMEBLOCK_LOCAL - detailed timing which may effect performance
 // OPM_TIMEFUNCTION_LOCAL - detailed timing which may effect performance with name from function
+//
+// The macros are implemented by Tracy if USE_TRACY is set, and by the
+// built-in Profiler (opm/common/utility/Profiler.hpp) if
+// HAVE_NATIVE_PROFILING is set. Otherwise they do nothing.
 
 #ifndef DETAILED_PROFILING
 #define DETAILED_PROFILING 0 // set to 1 to enable invasive profiling
@@ -38,6 +42,17 @@
 #define OPM_TIMEBLOCK_LOCAL(blockname) ZoneNamedN(blockname, #blockname, true)
 #define OPM_TIMEFUNCTION_LOCAL() ZoneNamedN(myname, __func__, true)
 #endif
+#elif HAVE_NATIVE_PROFILING
+#include <opm/common/utility/Profiler.hpp>
+#define OPM_PROFILER_SCOPE(var, name, local)                                          \
+    static const ::Opm::Profiler::Site var##_opm_site{name, __FILE__, __LINE__, local}; \
+    const ::Opm::Profiler::ScopedTimer var##_opm_timer{var##_opm_site}
+#define OPM_TIMEBLOCK(blockname) OPM_PROFILER_SCOPE(blockname, #blockname, false)
+#define OPM_TIMEFUNCTION() OPM_PROFILER_SCOPE(myname, __func__, false)
+#if DETAILED_PROFILING
+#define OPM_TIMEBLOCK_LOCAL(blockname) OPM_PROFILER_SCOPE(blockname, #blockname, true)
+#define OPM_TIMEFUNCTION_LOCAL() OPM_PROFILER_SCOPE(myname, __func__, true)
+#endif
 #endif
 
 #ifndef OPM_TIMEBLOCK
@@ -0,0 +1,154 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_UTILITY_PARALLEL_FOR_HPP
+#define OPM_UTILITY_PARALLEL_FOR_HPP
+
+#include <cstddef>
+#include <exception>
+
+/// \file
+///
+/// Exception safe loops over index ranges, run in parallel when OpenMP is
+/// available.  Exceptions must not escape an OpenMP parallel region, so the
+/// loops capture them and rethrow one of them once all iterations are done.
+
+namespace Opm { namespace utility {
+
+    namespace detail {
+
+        /// Exception of the lowest failing iteration of a parallel loop.
+        class ParallelForFailure
+        {
+        public:
+            /// Record the exception currently being handled.  Must be
+            /// called from a catch block.
+            ///
+            /// \param[in] i Index of failing iteration.
+            void record(const std::ptrdiff_t i) noexcept
+            {
+#ifdef _OPENMP
+#pragma omp critical(opm_utility_parallel_for_failure)
+#endif
+                if (! this->error_ || (i < this->index_)) {
+                    this->index_ = i;
+                    this->error_ = std::current_exception();
+                }
+            }
+
+            /// Rethrow the recorded exception, if any.
+            void rethrowIfFailed() const
+            {
+                if (this->error_) {
+                    std::rethrow_exception(this->error_);
+                }
+            }
+
+        private:
+            std::ptrdiff_t index_{0};
+            std::exception_ptr error_{};
+        };
+
+    } // namespace detail
+
+    /// Invoke an operation for all indices in the range [0, n).
+    ///
+    /// The indices are distributed over the OpenMP threads in chunks of
+    /// \p chunkSize consecutive indices, and every iteration runs even if
+    /// others fail.  If any invocation throws, the exception of the lowest
+    /// failing index is rethrown once all have finished, which is the
+    /// exception a serial loop would throw first.
+    ///
+    /// \tparam Index Integer type of the indices.
+    ///
+    /// \param[in] n Number of indices.
+    ///
+    /// \param[in] body Operation.  Called as \code body(i) \endcode and
+    ///    must be safe to call concurrently for distinct indices.
+    ///
+    /// \param[in] chunkSize Number of consecutive indices handed to a
+    ///    thread at a time.
+    template <typename Index, typename Body>
+    void parallelFor(const Index n, Body&& body, const int chunkSize = 1)
+    {
+        const auto num = static_cast<std::ptrdiff_t>(n);
+        auto failure = detail::ParallelForFailure{};
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, chunkSize) if(num > 1)
+#endif
+        for (std::ptrdiff_t i = 0; i < num; ++i) {
+            try {
+                body(static_cast<Index>(i));
+            }
+            catch (...) {
+                failure.record(i);
+            }
+        }
+
+        static_cast<void>(chunkSize);
+
+        failure.rethrowIfFailed();
+    }
+
+    /// Invoke an operation for all indices in the range [0, n), with
+    /// state which is private to each thread.
+    ///
+    /// Like parallelFor(), but every thread first creates a state object,
+    /// e.g., an input stream of its own, which is then passed to all
+    /// invocations of \p body on that thread.
+    ///
+    /// \param[in] makeState Creates the state of a thread.  Called as
+    ///    \code makeState() \endcode once per thread and must not throw.
+    ///
+    /// \param[in] body Operation.  Called as \code body(state, i) \endcode.
+    template <typename Index, typename MakeState, typename Body>
+    void parallelForWithState(const Index n, MakeState&& makeState, Body&& body,
+                              const int chunkSize = 1)
+    {
+        const auto num = static_cast<std::ptrdiff_t>(n);
+        auto failure = detail::ParallelForFailure{};
+
+#ifdef _OPENMP
+#pragma omp parallel if(num > 1)
+#endif
+        {
+            auto state = makeState();
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, chunkSize)
+#endif
+            for (std::ptrdiff_t i = 0; i < num; ++i) {
+                try {
+                    body(state, static_cast<Index>(i));
+                }
+                catch (...) {
+                    failure.record(i);
+                }
+            }
+        }
+
+        static_cast<void>(chunkSize);
+
+        failure.rethrowIfFailed();
+    }
+
+}} // namespace Opm::utility
+
+#endif // OPM_UTILITY_PARALLEL_FOR_HPP
@@ -0,0 +1,488 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_UTILITY_PERSISTENT_HASH_MAP_HPP
+#define OPM_UTILITY_PERSISTENT_HASH_MAP_HPP
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/// \file
+///
+/// Hash array mapped trie (HAMT) with path copying.  Copying a map is O(1)
+/// and inserting into a copy only duplicates the O(log_32 n) nodes on the
+/// path from the root to the modified entry.  All other nodes are shared
+/// between the copies.
+
+namespace Opm { namespace utility {
+
+    /// Persistent associative container with unique keys.
+    ///
+    /// Meant for containers which are copied often and modified rarely,
+    /// such as the per report step collections of the ScheduleState.
+    /// Iteration order is unspecified, like for std::unordered_map<>.
+    ///
+    /// \tparam Key Key type.  Must be hashable by \p Hash and comparable
+    ///    by \p KeyEqual.
+    ///
+    /// \tparam Value Mapped type.
+    template <typename Key, typename Value,
+              typename Hash = std::hash<Key>,
+              typename KeyEqual = std::equal_to<Key>>
+    class PersistentHashMap
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<const Key, Value>;
+        using size_type = std::size_t;
+
+    private:
+        using HashValue = std::size_t;
+        using Bitmap = std::uint32_t;
+
+        /// Number of hash bits consumed at each trie level.
+        static constexpr int BitsPerLevel = 5;
+
+        /// Trie node.  Either an interior node with a bitmap of occupied
+        /// slots and a compact array of children, or a leaf holding all
+        /// entries sharing the same full hash value.
+        struct Node
+        {
+            Bitmap bitmap{0};
+            std::vector<std::shared_ptr<const Node>> children{};
+
+            HashValue hash{0};
+            std::vector<value_type> entries{};
+
+            bool isLeaf() const
+            {
+                return this->children.empty();
+            }
+        };
+
+        using NodePtr = std::shared_ptr<const Node>;
+
+    public:
+        /// Forward iterator over all entries in the map.
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename PersistentHashMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const value_type*;
+            using reference = const value_type&;
+
+            const_iterator() = default;
+
+            reference operator*() const
+            {
+                return this->stack_.back().first->entries[this->entry_];
+            }
+
+            pointer operator->() const
+            {
+                return &**this;
+            }
+
+            const_iterator& operator++()
+            {
+                if (++this->entry_ < this->stack_.back().first->entries.size()) {
+                    return *this;
+                }
+
+                this->entry_ = 0;
+                this->stack_.pop_back();
+                this->advanceToLeaf();
+
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                auto prev = *this;
+                ++*this;
+                return prev;
+            }
+
+            bool operator==(const const_iterator& that) const
+            {
+                if (this->stack_.empty() || that.stack_.empty()) {
+                    return this->stack_.empty() == that.stack_.empty();
+                }
+
+                return (this->stack_.back().first == that.stack_.back().first)
+                    && (this->entry_ == that.entry_);
+            }
+
+            bool operator!=(const const_iterator& that) const
+            {
+                return ! (*this == that);
+            }
+
+        private:
+            friend class PersistentHashMap;
+
+            /// Node being visited and index of next child to visit.
+            std::vector<std::pair<const Node*, std::size_t>> stack_{};
+
+            /// Current entry within leaf node at top of stack.
+            std::size_t entry_{0};
+
+            explicit const_iterator(const Node* root)
+            {
+                if (root != nullptr) {
+                    this->stack_.emplace_back(root, 0);
+                    this->advanceToLeaf();
+                }
+            }
+
+            /// Descend depth-first until the top of the stack is a leaf.
+            void advanceToLeaf()
+            {
+                while (! this->stack_.empty()) {
+                    auto& [node, child] = this->stack_.back();
+                    if (node->isLeaf()) {
+                        return;
+                    }
+
+                    if (child == node->children.size()) {
+                        this->stack_.pop_back();
+                        continue;
+                    }
+
+                    const auto* next = node->children[child++].get();
+                    this->stack_.emplace_back(next, 0);
+                }
+            }
+        };
+
+        using iterator = const_iterator;
+
+        /// Number of entries in map.
+        size_type size() const
+        {
+            return this->size_;
+        }
+
+        /// Whether or not the map is empty.
+        bool empty() const
+        {
+            return this->size_ == 0;
+        }
+
+        /// Remove all entries.  Shared nodes are unaffected.
+        void clear()
+        {
+            this->root_.reset();
+            this->size_ = 0;
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator { this->root_.get() };
+        }
+
+        const_iterator end() const
+        {
+            return {};
+        }
+
+        /// Look up entry by key.
+        ///
+        /// \return Pointer to mapped value, or nullptr if \p key is not
+        ///    in the map.
+        const Value* find(const Key& key) const
+        {
+            const auto hash = Hash{}(key);
+
+            const auto* node = this->root_.get();
+            for (auto shift = 0; node != nullptr; shift += BitsPerLevel) {
+                if (node->isLeaf()) {
+                    if (node->hash != hash) {
+                        return nullptr;
+                    }
+
+                    auto pos = std::find_if(node->entries.begin(), node->entries.end(),
+                                            [&key](const value_type& entry)
+                                            { return KeyEqual{}(entry.first, key); });
+
+                    return (pos == node->entries.end()) ? nullptr : &pos->second;
+                }
+
+                const auto bit = slotBit(hash, shift);
+                if ((node->bitmap & bit) == 0) {
+                    return nullptr;
+                }
+
+                node = node->children[slotIndex(node->bitmap, bit)].get();
+            }
+
+            return nullptr;
+        }
+
+        /// Whether or not map contains entry for \p key.
+        bool contains(const Key& key) const
+        {
+            return this->find(key) != nullptr;
+        }
+
+        /// Checked element access.
+        ///
+        /// Throws std::out_of_range if \p key is not in the map.
+        const Value& at(const Key& key) const
+        {
+            const auto* value = this->find(key);
+            if (value == nullptr) {
+                throw std::out_of_range {
+                    "Key does not exist in PersistentHashMap"
+                };
+            }
+
+            return *value;
+        }
+
+        /// Insert new entry or replace mapped value of existing entry.
+        ///
+        /// Copies the nodes on the path to the modified entry.  Any other
+        /// map sharing structure with this one is unaffected.
+        ///
+        /// \return Whether or not a new entry was inserted.
+        bool insert_or_assign(const Key& key, Value value)
+        {
+            bool inserted = false;
+            this->root_ = insert(this->root_, Hash{}(key), 0,
+                                 key, std::move(value), inserted);
+
+            if (inserted) {
+                ++this->size_;
+            }
+
+            return inserted;
+        }
+
+        /// Number of trie nodes uniquely owned by this map, i.e., not
+        /// shared with any other map.  Intended for memory diagnostics.
+        size_type uniqueNodeCount() const
+        {
+            return countUnique(this->root_);
+        }
+
+        /// Visit all entries which differ from those of an earlier version
+        /// of this map.
+        ///
+        /// Subtrees which are shared with \p base are skipped, so the cost
+        /// is proportional to the number of modified entries when \p base
+        /// is a copy from which this map has been derived.
+        ///
+        /// \param[in] base Map to compare with.
+        ///
+        /// \param[in] visit Called as visit(entry, baseValue) for every
+        ///    entry whose key is not in \p base or whose value does not
+        ///    compare equal to the value in \p base.  The baseValue is
+        ///    nullptr for new keys.  Entries in \p base which are not in
+        ///    this map are not visited.
+        template <typename Visitor>
+        void forEachChanged(const PersistentHashMap& base, Visitor&& visit) const
+        {
+            diff(this->root_, base.root_, base, visit);
+        }
+
+        /// Convert to or from serialized representation.
+        ///
+        /// Same layout as std::unordered_map<Key,Value>: Number of entries
+        /// followed by the key/value pairs.
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            if (serializer.isSerializing()) {
+                serializer(this->size_);
+                for (const auto& entry : *this) {
+                    serializer(entry);
+                }
+            }
+            else {
+                auto size = size_type{0};
+                serializer(size);
+
+                this->clear();
+                for (auto i = 0*size; i < size; ++i) {
+                    std::pair<Key, Value> entry{};
+                    serializer(entry);
+                    this->insert_or_assign(entry.first, std::move(entry.second));
+                }
+            }
+        }
+
+    private:
+        NodePtr root_{};
+        size_type size_{0};
+
+        static Bitmap slotBit(const HashValue hash, const int shift)
+        {
+            return Bitmap{1} << ((hash >> shift) & ((HashValue{1} << BitsPerLevel) - 1));
+        }
+
+        static std::size_t slotIndex(const Bitmap bitmap, const Bitmap bit)
+        {
+            return std::bitset<32>(bitmap & (bit - 1)).count();
+        }
+
+        static NodePtr makeLeaf(const HashValue hash, const Key& key, Value&& value)
+        {
+            auto leaf = std::make_shared<Node>();
+            leaf->hash = hash;
+            leaf->entries.emplace_back(key, std::move(value));
+            return leaf;
+        }
+
+        static NodePtr insert(const NodePtr&  node,
+                              const HashValue hash,
+                              const int       shift,
+                              const Key&      key,
+                              Value&&         value,
+                              bool&           inserted)
+        {
+            if (node == nullptr) {
+                inserted = true;
+                return makeLeaf(hash, key, std::move(value));
+            }
+
+            if (node->isLeaf()) {
+                if (node->hash == hash) {
+                    auto leaf = std::make_shared<Node>(*node);
+                    auto pos = std::find_if(leaf->entries.begin(), leaf->entries.end(),
+                                            [&key](const value_type& entry)
+                                            { return KeyEqual{}(entry.first, key); });
+
+                    if (pos == leaf->entries.end()) {
+                        inserted = true;
+                        leaf->entries.emplace_back(key, std::move(value));
+                    }
+                    else {
+                        pos->second = std::move(value);
+                    }
+
+                    return leaf;
+                }
+
+                // Distinct hash values differ in at least one bit, so the
+                // two leaves separate before we run out of hash bits.
+                auto branch = std::make_shared<Node>();
+                branch->bitmap = slotBit(node->hash, shift);
+                branch->children.push_back(node);
+
+                return insert(branch, hash, shift, key, std::move(value), inserted);
+            }
+
+            auto branch = std::make_shared<Node>(*node);
+
+            const auto bit = slotBit(hash, shift);
+            const auto ix = slotIndex(branch->bitmap, bit);
+
+            if ((branch->bitmap & bit) != 0) {
+                branch->children[ix] = insert(branch->children[ix], hash,
+                                              shift + BitsPerLevel,
+                                              key, std::move(value), inserted);
+            }
+            else {
+                inserted = true;
+                branch->bitmap |= bit;
+                branch->children.insert(branch->children.begin() + ix,
+                                        makeLeaf(hash, key, std::move(value)));
+            }
+
+            return branch;
+        }
+
+        template <typename Visitor>
+        static void diff(const NodePtr&           node,
+                         const NodePtr&           baseNode,
+                         const PersistentHashMap& base,
+                         Visitor&                 visit)
+        {
+            if ((node == nullptr) || (node == baseNode)) {
+                return;
+            }
+
+            if ((baseNode != nullptr) && !node->isLeaf() && !baseNode->isLeaf()) {
+                // Both nodes cover the same hash prefix, compare slotwise.
+                for (auto bits = node->bitmap; bits != 0; bits &= bits - 1) {
+                    const Bitmap bit = bits & (~bits + 1);
+                    const auto baseChild = ((baseNode->bitmap & bit) != 0)
+                        ? baseNode->children[slotIndex(baseNode->bitmap, bit)]
+                        : NodePtr{};
+
+                    diff(node->children[slotIndex(node->bitmap, bit)],
+                         baseChild, base, visit);
+                }
+
+                return;
+            }
+
+            // Trie shapes differ, compare entry by entry.
+            forEachEntry(node, [&base, &visit](const value_type& entry)
+            {
+                const auto* baseValue = base.find(entry.first);
+                if ((baseValue == nullptr) || !(*baseValue == entry.second)) {
+                    visit(entry, baseValue);
+                }
+            });
+        }
+
+        template <typename Op>
+        static void forEachEntry(const NodePtr& node, Op&& op)
+        {
+            if (node->isLeaf()) {
+                std::for_each(node->entries.begin(), node->entries.end(), op);
+                return;
+            }
+
+            for (const auto& child : node->children) {
+                forEachEntry(child, op);
+            }
+        }
+
+        static size_type countUnique(const NodePtr& node)
+        {
+            if ((node == nullptr) || (node.use_count() > 1)) {
+                return 0;
+            }
+
+            auto count = size_type{1};
+            for (const auto& child : node->children) {
+                count += countUnique(child);
+            }
+
+            return count;
+        }
+    };
+
+}} // namespace Opm::utility
+
+#endif // OPM_UTILITY_PERSISTENT_HASH_MAP_HPP
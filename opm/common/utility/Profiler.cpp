@@ -0,0 +1,576 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/common/utility/Profiler.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace {
+
+// Upper limit of the number of distinct sites. Sites beyond it are not
+// timed.
+constexpr int maxNumSites = 1024;
+
+// Site::id of sites which did not fit into the registry
+constexpr int siteOverflow = -2;
+
+// Upper limit of the number of trace events kept from exited threads.
+constexpr std::size_t maxRetiredTraceEvents = std::size_t{1} << 20;
+
+std::int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+        (std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Counters are only modified by the thread owning them, so a relaxed load
+// and store suffices.  Other threads may read them at any time.
+void increment(std::atomic<std::uint64_t>& counter, const std::uint64_t amount)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + amount,
+                  std::memory_order_relaxed);
+}
+
+struct SiteCounters
+{
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> timedCalls{0};
+    std::atomic<std::uint64_t> inclusiveNs{0};
+    std::atomic<std::uint64_t> exclusiveNs{0};
+};
+
+struct Frame
+{
+    int site;
+    std::int64_t start;
+    std::int64_t childNs;
+};
+
+struct TraceEvent
+{
+    int site;
+    std::int64_t start;
+    std::int64_t duration;
+};
+
+struct ThreadData
+{
+    ThreadData(const int idx, const std::size_t maxTraceEvents)
+        : threadIdx(idx)
+        , counters(std::make_unique<SiteCounters[]>(maxNumSites))
+        , traceCapacity(maxTraceEvents)
+        , trace(std::make_unique<TraceEvent[]>(maxTraceEvents))
+    {
+        this->stack.reserve(64);
+    }
+
+    int threadIdx;
+    std::unique_ptr<SiteCounters[]> counters;
+    std::vector<Frame> stack{};
+
+    std::size_t traceCapacity;
+    std::unique_ptr<TraceEvent[]> trace;
+    std::atomic<std::size_t> numTraceEvents{0};
+};
+
+// Counters and trace events of threads which have exited.  They are only
+// accessed while holding the registry mutex.
+struct RetiredCounters
+{
+    std::uint64_t calls{0};
+    std::uint64_t timedCalls{0};
+    std::uint64_t inclusiveNs{0};
+    std::uint64_t exclusiveNs{0};
+};
+
+struct RetiredTraceEvent
+{
+    int threadIdx;
+    TraceEvent event;
+};
+
+struct Registry
+{
+    std::mutex mutex{};
+    std::vector<const Opm::Profiler::Site*> sites{};
+    std::vector<std::unique_ptr<ThreadData>> threads{};
+    int nextThreadIdx{0};
+
+    std::vector<RetiredCounters> retiredCounters{};
+    std::vector<RetiredTraceEvent> retiredTrace{};
+
+    std::atomic<unsigned> localSamplingInterval{1};
+    std::atomic<std::size_t> traceEventsPerThread{0};
+    std::int64_t epoch{now()};
+
+    std::string outputPrefix{};
+    bool writeAtExitRegistered{false};
+};
+
+Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+// Fold the counters and trace events of an exiting thread into the
+// registry and release its thread data.
+void retireThread(const ThreadData* data)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> guard { reg.mutex };
+
+    auto pos = std::find_if(reg.threads.begin(), reg.threads.end(),
+                            [data](const auto& thread) { return thread.get() == data; });
+    if (pos == reg.threads.end()) {
+        return;
+    }
+
+    try {
+        reg.retiredCounters.resize(maxNumSites);
+        for (int siteIdx = 0; siteIdx < maxNumSites; ++siteIdx) {
+            const auto& c = data->counters[siteIdx];
+            auto& r = reg.retiredCounters[siteIdx];
+            r.calls += c.calls.load(std::memory_order_relaxed);
+            r.timedCalls += c.timedCalls.load(std::memory_order_relaxed);
+            r.inclusiveNs += c.inclusiveNs.load(std::memory_order_relaxed);
+            r.exclusiveNs += c.exclusiveNs.load(std::memory_order_relaxed);
+        }
+
+        const auto numEvents = std::min(data->numTraceEvents.load(std::memory_order_acquire),
+                                        maxRetiredTraceEvents - reg.retiredTrace.size());
+        for (std::size_t eventIdx = 0; eventIdx < numEvents; ++eventIdx) {
+            reg.retiredTrace.push_back({ data->threadIdx, data->trace[eventIdx] });
+        }
+    }
+    catch (const std::bad_alloc&) {
+        // The counters of this thread are lost, but the thread still exits.
+    }
+
+    reg.threads.erase(pos);
+}
+
+// Owned by each thread which has entered a timed region.  Retires the
+// thread data when the thread exits, so the registry does not grow with
+// the number of threads created over the run.
+struct ThreadHandle
+{
+    ThreadData* data{nullptr};
+
+    ~ThreadHandle()
+    {
+        if (this->data != nullptr) {
+            retireThread(this->data);
+        }
+    }
+};
+
+ThreadData& threadData()
+{
+    thread_local ThreadHandle handle;
+
+    if (handle.data == nullptr) {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> guard { reg.mutex };
+
+        reg.threads.push_back(std::make_unique<ThreadData>
+                              (reg.nextThreadIdx, reg.traceEventsPerThread.load(std::memory_order_relaxed)));
+        ++reg.nextThreadIdx;
+        handle.data = reg.threads.back().get();
+    }
+
+    return *handle.data;
+}
+
+int registerSite(const Opm::Profiler::Site& site)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> guard { reg.mutex };
+
+    // Another thread may have registered the site in the meantime
+    auto id = site.id.load(std::memory_order_acquire);
+    if (id != -1) {
+        return id;
+    }
+
+    id = (reg.sites.size() < static_cast<std::size_t>(maxNumSites))
+        ? static_cast<int>(reg.sites.size())
+        : siteOverflow;
+
+    if (id != siteOverflow) {
+        reg.sites.push_back(&site);
+    }
+
+    site.id.store(id, std::memory_order_release);
+
+    return id;
+}
+
+std::string jsonEscape(std::string_view s)
+{
+    std::string result;
+    result.reserve(s.size());
+
+    for (const char c : s) {
+        switch (c) {
+        case '"':  result += "\\\""; break;
+        case '\\': result += "\\\\"; break;
+        case '\n': result += "\\n"; break;
+        case '\t': result += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                result += fmt::format("\\u{:04x}", static_cast<int>(c));
+            }
+            else {
+                result += c;
+            }
+        }
+    }
+
+    return result;
+}
+
+void writeAtExit()
+{
+    try {
+        const auto& prefix = registry().outputPrefix;
+        if (prefix.empty()) {
+            return;
+        }
+
+        {
+            std::ofstream os { prefix + ".json" };
+            Opm::Profiler::writeJson(os);
+        }
+
+        if (registry().traceEventsPerThread.load() > 0) {
+            std::ofstream os { prefix + ".trace.json" };
+            Opm::Profiler::writeChromeTrace(os);
+        }
+    }
+    catch (const std::exception&) {
+        // Nothing sensible to do at this point.
+    }
+}
+
+// Enable the profiler through the environment, before main() runs.
+[[maybe_unused]] const bool environmentApplied = []()
+{
+    const char* prefix = std::getenv("OPM_PROFILE");
+    if ((prefix == nullptr) || (*prefix == '\0')) {
+        return false;
+    }
+
+    Opm::Profiler::Options options;
+    options.outputPrefix = prefix;
+
+    if (const char* interval = std::getenv("OPM_PROFILE_SAMPLING")) {
+        options.localSamplingInterval =
+            static_cast<unsigned>(std::max(1L, std::strtol(interval, nullptr, 10)));
+    }
+
+    if (const char* events = std::getenv("OPM_PROFILE_TRACE_EVENTS")) {
+        options.traceEventsPerThread =
+            static_cast<std::size_t>(std::max(0L, std::strtol(events, nullptr, 10)));
+    }
+
+    Opm::Profiler::enable(options);
+
+    return true;
+}();
+
+} // Anonymous namespace
+
+namespace Opm {
+
+std::atomic<bool> Profiler::enabled_{false};
+
+void Profiler::enable()
+{
+    enable(Options{});
+}
+
+void Profiler::enable(const Options& options)
+{
+    auto& reg = registry();
+
+    {
+        std::lock_guard<std::mutex> guard { reg.mutex };
+
+        reg.localSamplingInterval.store(std::max(options.localSamplingInterval, 1u));
+        reg.traceEventsPerThread.store(options.traceEventsPerThread);
+
+        if (! options.outputPrefix.empty()) {
+            reg.outputPrefix = options.outputPrefix;
+
+            if (! reg.writeAtExitRegistered) {
+                std::atexit(&writeAtExit);
+                reg.writeAtExitRegistered = true;
+            }
+        }
+    }
+
+    enabled_.store(true);
+}
+
+void Profiler::disable()
+{
+    enabled_.store(false);
+}
+
+void Profiler::reset()
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> guard { reg.mutex };
+
+    const auto traceCapacity = reg.traceEventsPerThread.load();
+    for (auto& thread : reg.threads) {
+        for (int siteIdx = 0; siteIdx < maxNumSites; ++siteIdx) {
+            auto& c = thread->counters[siteIdx];
+            c.calls.store(0);
+            c.timedCalls.store(0);
+            c.inclusiveNs.store(0);
+            c.exclusiveNs.store(0);
+        }
+
+        thread->numTraceEvents.store(0);
+        if (thread->traceCapacity != traceCapacity) {
+            thread->trace = std::make_unique<TraceEvent[]>(traceCapacity);
+            thread->traceCapacity = traceCapacity;
+        }
+    }
+
+    reg.retiredCounters.clear();
+    reg.retiredTrace.clear();
+    reg.epoch = now();
+}
+
+bool Profiler::begin_(const Site& site) noexcept
+{
+    // Registering the site or the thread, or growing the stack of open
+    // regions, may fail to allocate.  The region is then not timed, which
+    // is preferable to terminating the program from a timer.
+    try {
+        auto id = site.id.load(std::memory_order_acquire);
+        if (id == -1) {
+            id = registerSite(site);
+        }
+
+        if (id == siteOverflow) {
+            return false;
+        }
+
+        auto& data = threadData();
+        auto& calls = data.counters[id].calls;
+        const auto previousCalls = calls.load(std::memory_order_relaxed);
+        increment(calls, 1);
+
+        if (site.local) {
+            // Time the first and then every n-th call of the site
+            const auto interval = registry().localSamplingInterval.load(std::memory_order_relaxed);
+            if ((interval > 1) && ((previousCalls % interval) != 0)) {
+                return false;
+            }
+        }
+
+        data.stack.push_back({ id, now(), 0 });
+
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+void Profiler::end_() noexcept
+{
+    const auto stop = now();
+
+    auto& data = threadData();
+    const auto frame = data.stack.back();
+    data.stack.pop_back();
+
+    const auto inclusive = stop - frame.start;
+
+    auto& c = data.counters[frame.site];
+    increment(c.timedCalls, 1);
+    increment(c.inclusiveNs, inclusive);
+    increment(c.exclusiveNs, inclusive - frame.childNs);
+
+    if (! data.stack.empty()) {
+        data.stack.back().childNs += inclusive;
+    }
+
+    const auto numEvents = data.numTraceEvents.load(std::memory_order_relaxed);
+    if (numEvents < data.traceCapacity) {
+        data.trace[numEvents] = TraceEvent { frame.site, frame.start, inclusive };
+        data.numTraceEvents.store(numEvents + 1, std::memory_order_release);
+    }
+}
+
+std::vector<Profiler::SiteSummary> Profiler::summary()
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> guard { reg.mutex };
+
+    std::vector<SiteSummary> result;
+    for (std::size_t siteIdx = 0; siteIdx < reg.sites.size(); ++siteIdx) {
+        const auto* site = reg.sites[siteIdx];
+
+        SiteSummary s;
+        s.name = site->name;
+        s.file = site->file;
+        s.line = site->line;
+        s.local = site->local;
+
+        std::uint64_t inclusiveNs = 0;
+        std::uint64_t exclusiveNs = 0;
+        for (const auto& thread : reg.threads) {
+            const auto& c = thread->counters[siteIdx];
+            s.calls += c.calls.load(std::memory_order_relaxed);
+            s.timedCalls += c.timedCalls.load(std::memory_order_relaxed);
+            inclusiveNs += c.inclusiveNs.load(std::memory_order_relaxed);
+            exclusiveNs += c.exclusiveNs.load(std::memory_order_relaxed);
+        }
+
+        if (! reg.retiredCounters.empty()) {
+            const auto& r = reg.retiredCounters[siteIdx];
+            s.calls += r.calls;
+            s.timedCalls += r.timedCalls;
+            inclusiveNs += r.inclusiveNs;
+            exclusiveNs += r.exclusiveNs;
+        }
+
+        if (s.calls == 0) {
+            continue;
+        }
+
+        // Extrapolate the times of sampled sites to all calls
+        const double scale = (s.timedCalls > 0)
+            ? static_cast<double>(s.calls) / s.timedCalls
+            : 0.0;
+
+        s.inclusiveTime = 1.0e-9 * scale * inclusiveNs;
+        s.exclusiveTime = 1.0e-9 * scale * exclusiveNs;
+
+        result.push_back(std::move(s));
+    }
+
+    std::stable_sort(result.begin(), result.end(),
+                     [](const SiteSummary& s1, const SiteSummary& s2)
+                     { return s1.inclusiveTime > s2.inclusiveTime; });
+
+    return result;
+}
+
+void Profiler::writeJson(std::ostream& os)
+{
+    const auto sites = summary();
+
+    os << "{\n  \"sites\": [";
+    for (std::size_t i = 0; i < sites.size(); ++i) {
+        const auto& s = sites[i];
+        os << ((i == 0) ? "\n" : ",\n")
+           << fmt::format("    {{\"name\": \"{}\", \"file\": \"{}\", \"line\": {}, "
+                          "\"local\": {}, \"calls\": {}, \"timedCalls\": {}, "
+                          "\"inclusiveTime\": {:.9g}, \"exclusiveTime\": {:.9g}}}",
+                          jsonEscape(s.name), jsonEscape(s.file), s.line,
+                          s.local, s.calls, s.timedCalls,
+                          s.inclusiveTime, s.exclusiveTime);
+    }
+    os << "\n  ]\n}\n";
+}
+
+void Profiler::writeChromeTrace(std::ostream& os)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> guard { reg.mutex };
+
+    // Timestamps and durations in microseconds
+    os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+
+    bool first = true;
+    auto writeEvent = [&os, &reg, &first](const TraceEvent& event, const int threadIdx)
+    {
+        os << (first ? "\n" : ",\n")
+           << fmt::format("{{\"name\": \"{}\", \"cat\": \"opm\", \"ph\": \"X\", "
+                          "\"ts\": {:.3f}, \"dur\": {:.3f}, \"pid\": 0, \"tid\": {}}}",
+                          jsonEscape(reg.sites[event.site]->name),
+                          1.0e-3 * (event.start - reg.epoch),
+                          1.0e-3 * event.duration,
+                          threadIdx);
+        first = false;
+    };
+
+    for (const auto& retired : reg.retiredTrace) {
+        writeEvent(retired.event, retired.threadIdx);
+    }
+
+    for (const auto& thread : reg.threads) {
+        const auto numEvents = thread->numTraceEvents.load(std::memory_order_acquire);
+        for (std::size_t eventIdx = 0; eventIdx < numEvents; ++eventIdx) {
+            writeEvent(thread->trace[eventIdx], thread->threadIdx);
+        }
+    }
+
+    os << "\n]}\n";
+}
+
+std::string Profiler::formatReport(const std::size_t maxSites)
+{
+    const auto sites = summary();
+
+    std::ostringstream os;
+    os << fmt::format("{:>12} {:>12} {:>12}  {}\n",
+                      "Calls", "Inclusive/s", "Exclusive/s", "Region");
+
+    const auto numSites = std::min(sites.size(), maxSites);
+    for (std::size_t i = 0; i < numSites; ++i) {
+        const auto& s = sites[i];
+        os << fmt::format("{:>12} {:>12.6f} {:>12.6f}  {}{} ({}:{})\n",
+                          s.calls, s.inclusiveTime, s.exclusiveTime,
+                          s.name, (s.timedCalls < s.calls) ? " [sampled]" : "",
+                          s.file, s.line);
+    }
+
+    return os.str();
+}
+
+void Profiler::logReport(const int64_t messageType, const std::size_t maxSites)
+{
+    OpmLog::addMessage(messageType, "Time spent in profiled regions\n" +
+                       formatReport(maxSites));
+}
+
+} // namespace Opm
@@ -0,0 +1,158 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PROFILER_HPP
+#define OPM_PROFILER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <opm/common/OpmLog/LogUtil.hpp>
+
+namespace Opm {
+
+/*
+  The Profiler class is a fully static class which implements the
+  OPM_TIMEBLOCK and OPM_TIMEFUNCTION macros of TimingMacros.hpp when the
+  code is built with HAVE_NATIVE_PROFILING.
+
+  Every macro instance is a Site. While the profiler is enabled, each
+  thread aggregates the number of calls and the inclusive and exclusive
+  time per site in thread local storage, without any locks; the counters
+  of other threads are only read when a report is written. When a thread
+  exits, its counters are added to those of the registry and its thread
+  local storage is released. Sites of the
+  _LOCAL macros may be sampled, i.e., only every n-th entry is timed and
+  the times are extrapolated to all calls. Each timed entry costs two
+  clock readings, which dominate the times of very short regions.
+  Optionally, the first timed regions of every thread are recorded as
+  events for the Chrome trace viewer (chrome://tracing or
+  https://ui.perfetto.dev).
+
+  While the profiler is disabled, which is the default, a timed region
+  costs a single relaxed atomic load. The profiler is enabled either
+  through enable() or by setting the environment variable OPM_PROFILE to
+  an output prefix before the program starts, in which case the reports
+  <prefix>.json and <prefix>.trace.json are written at exit.  The
+  variables OPM_PROFILE_SAMPLING and OPM_PROFILE_TRACE_EVENTS set the
+  corresponding options.
+*/
+class Profiler
+{
+public:
+    struct Options
+    {
+        // Write the reports to <outputPrefix>.json and
+        // <outputPrefix>.trace.json at exit, if not empty.
+        std::string outputPrefix{};
+
+        // Time only every n-th entry of the sites of the _LOCAL macros.
+        unsigned localSamplingInterval{1};
+
+        // Maximum number of trace events recorded per thread.
+        std::size_t traceEventsPerThread{0};
+    };
+
+    struct Site
+    {
+        constexpr Site(const char* siteName, const char* fileName, int lineNumber, bool isLocal) noexcept
+            : name(siteName), file(fileName), line(lineNumber), local(isLocal)
+        {}
+
+        const char* name;
+        const char* file;
+        int line;
+        bool local;
+
+        // Assigned when the site is first timed, -1 before that
+        mutable std::atomic<int> id{-1};
+    };
+
+    struct SiteSummary
+    {
+        std::string name{};
+        std::string file{};
+        int line{0};
+        bool local{false};
+        std::uint64_t calls{0};
+        std::uint64_t timedCalls{0};
+
+        // Extrapolated to all calls for sampled sites [s]
+        double inclusiveTime{0.0};
+        double exclusiveTime{0.0};
+    };
+
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(const Site& site) noexcept
+            : active_(Profiler::enabled() && Profiler::begin_(site))
+        {}
+
+        ~ScopedTimer()
+        {
+            if (active_) {
+                Profiler::end_();
+            }
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        bool active_;
+    };
+
+    static bool enabled() noexcept
+    { return enabled_.load(std::memory_order_relaxed); }
+
+    static void enable();
+    static void enable(const Options& options);
+    static void disable();
+
+    // Drop all counters and trace events. Only to be called while no timed
+    // regions are open in any thread.
+    static void reset();
+
+    // Counters of all sites which have been timed, summed over threads and
+    // sorted by decreasing inclusive time.
+    static std::vector<SiteSummary> summary();
+
+    static void writeJson(std::ostream& os);
+    static void writeChromeTrace(std::ostream& os);
+
+    // Tabular report of the 'maxSites' most expensive sites, sent to
+    // OpmLog with the given message type.
+    static std::string formatReport(std::size_t maxSites = 30);
+    static void logReport(int64_t messageType = Log::MessageType::Info, std::size_t maxSites = 30);
+
+private:
+    static bool begin_(const Site& site) noexcept;
+    static void end_() noexcept;
+
+    static std::atomic<bool> enabled_;
+};
+
+} // namespace Opm
+
+#endif // OPM_PROFILER_HPP
@@ -21,6 +21,8 @@
 #ifndef SERIALIZER_HPP
 #define SERIALIZER_HPP
 
+#include <opm/common/utility/SerializerStream.hpp>
+
 #include <algorithm>
 #include <cstdint>
 #include <functional>
@@ -128,10 +130,18 @@ public:
         } else {
             if (m_op == Operation::PACKSIZE)
                 m_packSize += m_packer.packSize(data);
-            else if (m_op == Operation::PACK)
+            else if (m_op == Operation::PACK) {
+                if (m_writer)
+                    reserveStream(m_packer.packSize(data));
                 m_packer.pack(data, m_buffer, m_position);
-            else if (m_op == Operation::UNPACK)
+                if (m_writer)
+                    flushStream();
+            }
+            else if (m_op == Operation::UNPACK) {
+                if (m_reader)
+                    fillStream();
                 m_packer.unpack(const_cast<T&>(data), m_buffer, m_position);
+            }
         }
     }
 
@@ -197,6 +207,70 @@ public:
         m_ptrmap.clear();
     }
 
+    //! \brief Call this to serialize data to a sink in a single pass.
+    //! \details Unlike pack(), the object graph is traversed only once and
+    //!          the full serialized size is never held in memory. The data
+    //!          is emitted as a sequence of versioned, optionally compressed
+    //!          chunks of roughly options.chunkSize bytes, which must be
+    //!          read back using unpackStream().
+    //! \param sink Destination of the chunks
+    //! \param options Chunk size and compression
+    //! \param data Classes to serialize
+    //! \return Total number of bytes passed to the sink
+    template<class... Args>
+    std::size_t packStream(const Serialization::Sink& sink,
+                           const Serialization::StreamOptions& options,
+                           const Args&... data)
+    {
+        Serialization::ChunkWriter writer { sink, options };
+        if (m_buffer.size() < writer.chunkSize())
+            m_buffer.resize(writer.chunkSize());
+        m_position = 0;
+        m_ptrmap.clear();
+        m_op = Operation::PACK;
+        m_writer = &writer;
+        try {
+            variadic_call(data...);
+        } catch (...) {
+            m_writer = nullptr;
+            throw;
+        }
+        m_writer = nullptr;
+        m_ptrmap.clear();
+        writer.write(m_buffer.data(), m_position, true);
+        m_position = 0;
+        return writer.bytesWritten();
+    }
+
+    //! \brief Call this to de-serialize data written by packStream().
+    //! \param source Origin of the chunks
+    //! \param data Classes to de-serialize
+    //! \throw std::runtime_error if the stream is truncated, corrupt, or
+    //!        does not match the data
+    template<class... Args>
+    void unpackStream(const Serialization::Source& source, Args&... data)
+    {
+        Serialization::ChunkReader reader { source };
+        m_buffer.clear();
+        m_position = 0;
+        m_ptrmap.clear();
+        m_op = Operation::UNPACK;
+        m_reader = &reader;
+        try {
+            variadic_call(data...);
+        } catch (...) {
+            m_reader = nullptr;
+            throw;
+        }
+        m_reader = nullptr;
+        m_ptrmap.clear();
+        // Consume the remaining, empty, chunks up to the final one
+        while (m_position == m_buffer.size() && reader.next(m_buffer))
+            m_position = 0;
+        if (m_position != m_buffer.size())
+            throw std::runtime_error("Serialized stream holds more data than was unpacked");
+    }
+
     //! \brief Returns current position in buffer.
     size_t position() const
     {
@@ -225,7 +299,7 @@ protected:
           } else if (m_op == Operation::PACK) {
               (*this)(data.size());
               if (data.size() > 0) {
-                  m_packer.pack(data.data(), data.size(), m_buffer, m_position);
+                  packArray(data.data(), data.size());
               }
           } else if (m_op == Operation::UNPACK) {
               std::size_t size = 0;
@@ -233,7 +307,7 @@ protected:
               auto& data_mut = const_cast<Vector&>(data);
               data_mut.resize(size);
               if (size > 0) {
-                  m_packer.unpack(data_mut.data(), size, m_buffer, m_position);
+                  unpackArray(data_mut.data(), size);
               }
           }
         } else {
@@ -285,10 +359,10 @@ protected:
             if (m_op == Operation::PACKSIZE)
                 m_packSize += m_packer.packSize(data.data(), data.size());
             else if (m_op == Operation::PACK)
-                m_packer.pack(data.data(), data.size(), m_buffer, m_position);
+                packArray(data.data(), data.size());
             else if (m_op == Operation::UNPACK) {
                 auto& data_mut = const_cast<Array&>(data);
-                m_packer.unpack(data_mut.data(), data_mut.size(), m_buffer, m_position);
+                unpackArray(data_mut.data(), data_mut.size());
             }
         } else {
             std::for_each(data.begin(), data.end(), std::ref(*this));
@@ -354,6 +428,7 @@ protected:
             std::size_t size = 0;
             (*this)(size);
             auto& data_mut = const_cast<Map&>(data);
+            data_mut.clear();
             for (size_t i = 0; i < size; ++i) {
                 typename Map::value_type entry;
                 (*this)(entry);
@@ -375,6 +450,7 @@ protected:
             std::size_t size = 0;
             (*this)(size);
             auto& data_mut = const_cast<Set&>(data);
+            data_mut.clear();
             for (size_t i = 0; i < size; ++i) {
                 typename Set::value_type entry{};
                 (*this)(entry);
@@ -386,6 +462,54 @@ protected:
         }
     }
 
+    //! \brief Pack an array of POD, making room for it in streaming mode.
+    template<class T>
+    void packArray(const T* data, std::size_t n)
+    {
+        if (m_writer)
+            reserveStream(m_packer.packSize(data, n));
+        m_packer.pack(data, n, m_buffer, m_position);
+        if (m_writer)
+            flushStream();
+    }
+
+    //! \brief Unpack an array of POD, reading the next chunk if needed.
+    template<class T>
+    void unpackArray(T* data, std::size_t n)
+    {
+        if (m_reader && n > 0)
+            fillStream();
+        m_packer.unpack(data, n, m_buffer, m_position);
+    }
+
+    //! \brief Make room for \p size more bytes in the streaming buffer.
+    void reserveStream(std::size_t size)
+    {
+        if (m_buffer.size() < m_position + size)
+            m_buffer.resize(std::max(m_position + size, 2 * m_buffer.size()));
+    }
+
+    //! \brief Emit the streaming buffer as a chunk once it is full.
+    //! \details Chunks are only split between values passed to the packer,
+    //!          so every such value is read back from a single chunk.
+    void flushStream()
+    {
+        if (m_position >= m_writer->chunkSize()) {
+            m_writer->write(m_buffer.data(), m_position, false);
+            m_position = 0;
+        }
+    }
+
+    //! \brief Read the next chunk once the current one is exhausted.
+    void fillStream()
+    {
+        while (m_position == m_buffer.size()) {
+            if (!m_reader->next(m_buffer))
+                throw std::runtime_error("Unexpected end of serialized stream");
+            m_position = 0;
+        }
+    }
+
     template<typename T, typename... Args>
     void variadic_call(T& first,
                        Args&&... args)
@@ -603,6 +727,8 @@ protected:
     size_t m_packSize = 0; //!< Required buffer size after PACKSIZE has been done
     size_t m_position = 0; //!< Current position in buffer
     std::vector<char> m_buffer; //!< Buffer for serialized data
+    Serialization::ChunkWriter* m_writer = nullptr; //!< Chunk destination while streaming
+    Serialization::ChunkReader* m_reader = nullptr; //!< Chunk origin while streaming
     std::map<std::uintptr_t, std::shared_ptr<void>> m_ptrmap; //!< Map to keep track of which pointer data has been serialized and actual pointers during unpacking
 };
 
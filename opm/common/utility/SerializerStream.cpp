@@ -0,0 +1,395 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/common/utility/SerializerStream.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+    // Chunk layout
+    //
+    //   char[4]   magic
+    //   uint16    format version
+    //   uint16    flags
+    //   uint64    size of the uncompressed payload
+    //   uint64    size of the stored payload
+    //
+    // followed by the stored payload.  All fields in native byte order,
+    // like the payload written by MemPacker.
+    struct ChunkHeader
+    {
+        char magic[4];
+        std::uint16_t version;
+        std::uint16_t flags;
+        std::uint64_t rawSize;
+        std::uint64_t storedSize;
+    };
+
+    static_assert(sizeof(ChunkHeader) == 24, "Chunk headers must have a fixed layout");
+
+    constexpr char magic[4] = { 'O', 'P', 'M', 'S' };
+    constexpr std::uint16_t version = 1;
+
+    constexpr std::uint16_t flagCompressed = 1 << 0;
+    constexpr std::uint16_t flagLast       = 1 << 1;
+
+    // LZ4 block format parameters
+    constexpr std::size_t minMatch = 4;
+    constexpr std::size_t lastLiterals = 5;   // Stream always ends in literals
+    constexpr std::size_t matchStartLimit = 12; // No match starts in the final bytes
+    constexpr std::size_t maxOffset = 65535;
+    constexpr int hashLog = 14;
+
+    using Byte = unsigned char;
+
+    std::uint32_t read32(const Byte* p)
+    {
+        std::uint32_t v;
+        std::memcpy(&v, p, sizeof v);
+        return v;
+    }
+
+    std::uint32_t hash(const std::uint32_t v)
+    {
+        return (v * 2654435761u) >> (32 - hashLog);
+    }
+
+    Byte* writeLength(Byte* op, std::size_t len)
+    {
+        for (; len >= 255; len -= 255) {
+            *op++ = 255;
+        }
+        *op++ = static_cast<Byte>(len);
+
+        return op;
+    }
+
+    Byte* writeLiterals(Byte* op, const Byte* anchor, const std::size_t litLen, Byte*& token)
+    {
+        token = op++;
+        if (litLen >= 15) {
+            *token = 15 << 4;
+            op = writeLength(op, litLen - 15);
+        }
+        else {
+            *token = static_cast<Byte>(litLen << 4);
+        }
+
+        if (litLen > 0) {
+            std::memcpy(op, anchor, litLen);
+        }
+
+        return op + litLen;
+    }
+
+    std::size_t readLength(const Byte*& ip, const Byte* const iend, std::size_t len)
+    {
+        if (len < 15) {
+            return len;
+        }
+
+        Byte b = 255;
+        while (b == 255) {
+            if (ip == iend) {
+                throw std::runtime_error("Compressed data is truncated");
+            }
+            b = *ip++;
+            len += b;
+        }
+
+        return len;
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+namespace Serialization {
+
+std::size_t compressBound(const std::size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+std::size_t compress(const char* src, const std::size_t size, char* dst)
+{
+    const auto* const base = reinterpret_cast<const Byte*>(src);
+    const auto* const iend = base + size;
+    const auto* ip = base;
+    const auto* anchor = base;
+    auto* op = reinterpret_cast<Byte*>(dst);
+    Byte* token = nullptr;
+
+    if (size > matchStartLimit) {
+        const auto* const ilimit = iend - matchStartLimit;
+        const auto* const matchLimit = iend - lastLiterals;
+        std::array<std::uint32_t, 1 << hashLog> table{};
+
+        while (ip <= ilimit) {
+            const auto seq = read32(ip);
+            auto& slot = table[hash(seq)];
+            const auto* ref = base + slot;
+            slot = static_cast<std::uint32_t>(ip - base);
+
+            if ((ref >= ip) || (static_cast<std::size_t>(ip - ref) > maxOffset) ||
+                (read32(ref) != seq))
+            {
+                ++ip;
+                continue;
+            }
+
+            while ((ip > anchor) && (ref > base) && (ip[-1] == ref[-1])) {
+                --ip;
+                --ref;
+            }
+
+            const auto* p = ip + minMatch;
+            const auto* r = ref + minMatch;
+            while ((p < matchLimit) && (*p == *r)) {
+                ++p;
+                ++r;
+            }
+
+            op = writeLiterals(op, anchor, ip - anchor, token);
+
+            const auto offset = static_cast<std::size_t>(ip - ref);
+            *op++ = static_cast<Byte>(offset & 0xff);
+            *op++ = static_cast<Byte>(offset >> 8);
+
+            const auto matchLen = static_cast<std::size_t>(p - ip) - minMatch;
+            if (matchLen >= 15) {
+                *token |= 15;
+                op = writeLength(op, matchLen - 15);
+            }
+            else {
+                *token |= static_cast<Byte>(matchLen);
+            }
+
+            ip = anchor = p;
+        }
+    }
+
+    op = writeLiterals(op, anchor, iend - anchor, token);
+
+    return static_cast<std::size_t>(op - reinterpret_cast<Byte*>(dst));
+}
+
+void decompress(const char* src, const std::size_t size,
+                char* dst, const std::size_t dstSize)
+{
+    const auto* ip = reinterpret_cast<const Byte*>(src);
+    const auto* const iend = ip + size;
+    auto* const obase = reinterpret_cast<Byte*>(dst);
+    auto* const oend = obase + dstSize;
+    auto* op = obase;
+
+    while (true) {
+        if (ip == iend) {
+            throw std::runtime_error("Compressed data is truncated");
+        }
+
+        const Byte token = *ip++;
+
+        const auto litLen = readLength(ip, iend, token >> 4);
+        if ((static_cast<std::size_t>(iend - ip) < litLen) ||
+            (static_cast<std::size_t>(oend - op) < litLen))
+        {
+            throw std::runtime_error("Compressed data is corrupt");
+        }
+
+        if (litLen > 0) {
+            std::memcpy(op, ip, litLen);
+        }
+        ip += litLen;
+        op += litLen;
+
+        if (ip == iend) {
+            break;
+        }
+
+        if (iend - ip < 2) {
+            throw std::runtime_error("Compressed data is truncated");
+        }
+
+        const auto offset = static_cast<std::size_t>(ip[0]) | (static_cast<std::size_t>(ip[1]) << 8);
+        ip += 2;
+
+        const auto matchLen = readLength(ip, iend, token & 15) + minMatch;
+        if ((offset == 0) || (offset > static_cast<std::size_t>(op - obase)) ||
+            (static_cast<std::size_t>(oend - op) < matchLen))
+        {
+            throw std::runtime_error("Compressed data is corrupt");
+        }
+
+        const auto* ref = op - offset;
+        if (offset >= matchLen) {
+            std::memcpy(op, ref, matchLen);
+            op += matchLen;
+        }
+        else {
+            // Byte by byte, since the match overlaps the output
+            for (auto i = 0*matchLen; i < matchLen; ++i) {
+                *op++ = *ref++;
+            }
+        }
+    }
+
+    if (op != oend) {
+        throw std::runtime_error("Compressed data does not match its stated size");
+    }
+}
+
+ChunkWriter::ChunkWriter(Sink sink, const StreamOptions& options)
+    : sink_   { std::move(sink) }
+    , options_{ options }
+{
+    this->options_.chunkSize = std::max(this->options_.chunkSize, std::size_t{1});
+}
+
+void ChunkWriter::write(const char* data, const std::size_t size, const bool last)
+{
+    auto header = ChunkHeader {};
+    std::memcpy(header.magic, magic, sizeof magic);
+    header.version = version;
+    header.flags = last ? flagLast : 0;
+    header.rawSize = size;
+    header.storedSize = size;
+
+    const char* payload = data;
+
+    if (this->options_.compress && (size > 0)) {
+        this->scratch_.resize(compressBound(size));
+        const auto compressedSize = compress(data, size, this->scratch_.data());
+
+        // Incompressible chunks are stored as is
+        if (compressedSize < size) {
+            header.flags |= flagCompressed;
+            header.storedSize = compressedSize;
+            payload = this->scratch_.data();
+        }
+    }
+
+    this->sink_(reinterpret_cast<const char*>(&header), sizeof header);
+    if (header.storedSize > 0) {
+        this->sink_(payload, header.storedSize);
+    }
+
+    this->written_ += sizeof header + header.storedSize;
+}
+
+ChunkReader::ChunkReader(Source source)
+    : source_{ std::move(source) }
+{}
+
+bool ChunkReader::next(std::vector<char>& buffer)
+{
+    if (this->done_) {
+        return false;
+    }
+
+    auto header = ChunkHeader {};
+    if (this->source_(reinterpret_cast<char*>(&header), sizeof header) != sizeof header) {
+        throw std::runtime_error("Unexpected end of serialized stream");
+    }
+
+    if (std::memcmp(header.magic, magic, sizeof magic) != 0) {
+        throw std::runtime_error("Serialized stream chunk has invalid header");
+    }
+
+    if (header.version != version) {
+        throw std::runtime_error("Serialized stream chunk has unsupported format version "
+                                 + std::to_string(header.version));
+    }
+
+    const auto compressed = (header.flags & flagCompressed) != 0;
+    if (!compressed && (header.storedSize != header.rawSize)) {
+        throw std::runtime_error("Serialized stream chunk has inconsistent sizes");
+    }
+
+    buffer.resize(header.rawSize);
+
+    auto& target = compressed ? this->scratch_ : buffer;
+    target.resize(header.storedSize);
+
+    if ((header.storedSize > 0) &&
+        (this->source_(target.data(), target.size()) != target.size()))
+    {
+        throw std::runtime_error("Unexpected end of serialized stream");
+    }
+
+    if (compressed) {
+        decompress(this->scratch_.data(), this->scratch_.size(),
+                   buffer.data(), buffer.size());
+    }
+
+    this->done_ = (header.flags & flagLast) != 0;
+
+    return true;
+}
+
+Sink bufferSink(std::vector<char>& buffer)
+{
+    return [&buffer](const char* data, const std::size_t size)
+    {
+        buffer.insert(buffer.end(), data, data + size);
+    };
+}
+
+Source bufferSource(const std::vector<char>& buffer)
+{
+    return [&buffer, position = std::size_t{0}](char* data, const std::size_t size) mutable
+    {
+        const auto n = std::min(size, buffer.size() - position);
+        std::copy_n(buffer.begin() + position, n, data);
+        position += n;
+
+        return n;
+    };
+}
+
+Sink streamSink(std::ostream& os)
+{
+    return [&os](const char* data, const std::size_t size)
+    {
+        if (! os.write(data, static_cast<std::streamsize>(size))) {
+            throw std::runtime_error("Failed to write serialized stream");
+        }
+    };
+}
+
+Source streamSource(std::istream& is)
+{
+    return [&is](char* data, const std::size_t size)
+    {
+        is.read(data, static_cast<std::streamsize>(size));
+        return static_cast<std::size_t>(is.gcount());
+    };
+}
+
+} // end namespace Serialization
+} // end namespace Opm
@@ -0,0 +1,143 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef SERIALIZER_STREAM_HPP
+#define SERIALIZER_STREAM_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <vector>
+
+namespace Opm {
+namespace Serialization {
+
+//! \brief Destination of a serialized stream.
+//! \details Called with consecutive pieces of the stream.
+using Sink = std::function<void(const char* data, std::size_t size)>;
+
+//! \brief Origin of a serialized stream.
+//! \details Called to fill \c size bytes at \c data, returns the number
+//!          of bytes actually provided. Fewer bytes signal end of input.
+using Source = std::function<std::size_t(char* data, std::size_t size)>;
+
+//! \brief Options for streaming serialization.
+struct StreamOptions
+{
+    //! \brief Number of bytes collected before a chunk is emitted.
+    //! \details Chunks are only split between values, whence a single
+    //!          large value may give a larger chunk.
+    std::size_t chunkSize = std::size_t{1} << 20;
+
+    //! \brief Whether or not to compress the chunks.
+    bool compress = false;
+};
+
+//! \brief Upper bound of the compressed size of \p size bytes.
+std::size_t compressBound(std::size_t size);
+
+//! \brief Compress a block of data.
+//! \details LZ77 compression in the LZ4 block format, tuned for speed
+//!          rather than ratio.
+//! \param src Data to compress
+//! \param size Number of bytes at \p src
+//! \param dst Output, at least compressBound(size) bytes
+//! \return Number of bytes written to \p dst
+std::size_t compress(const char* src, std::size_t size, char* dst);
+
+//! \brief Decompress a block of data created by compress().
+//! \param src Compressed data
+//! \param size Number of bytes at \p src
+//! \param dst Output
+//! \param dstSize Size of the uncompressed data
+//! \throw std::runtime_error if the data is corrupt
+void decompress(const char* src, std::size_t size, char* dst, std::size_t dstSize);
+
+//! \brief Writes a serialized stream as a sequence of chunks.
+//! \details Every chunk has a header holding a magic number, the format
+//!          version, flags and the sizes of the chunk payload.
+class ChunkWriter
+{
+public:
+    //! \brief Constructor.
+    //! \param sink Destination of the chunks
+    //! \param options Chunk size and compression
+    ChunkWriter(Sink sink, const StreamOptions& options);
+
+    //! \brief Number of bytes collected before a chunk is emitted.
+    std::size_t chunkSize() const
+    {
+        return options_.chunkSize;
+    }
+
+    //! \brief Emit a chunk.
+    //! \param data Uncompressed payload
+    //! \param size Number of bytes at \p data
+    //! \param last Whether or not this is the final chunk of the stream
+    void write(const char* data, std::size_t size, bool last);
+
+    //! \brief Total number of bytes passed to the sink.
+    std::size_t bytesWritten() const
+    {
+        return written_;
+    }
+
+private:
+    Sink sink_;
+    StreamOptions options_;
+    std::vector<char> scratch_{};
+    std::size_t written_{0};
+};
+
+//! \brief Reads a serialized stream written by ChunkWriter.
+class ChunkReader
+{
+public:
+    //! \brief Constructor.
+    //! \param source Origin of the chunks
+    explicit ChunkReader(Source source);
+
+    //! \brief Read the payload of the next chunk.
+    //! \param buffer Uncompressed payload, resized to fit
+    //! \return False if the final chunk has already been read
+    //! \throw std::runtime_error on truncated or corrupt input
+    bool next(std::vector<char>& buffer);
+
+private:
+    Source source_;
+    std::vector<char> scratch_{};
+    bool done_{false};
+};
+
+//! \brief Sink appending to a buffer.
+Sink bufferSink(std::vector<char>& buffer);
+
+//! \brief Source reading from a buffer, which must outlive the source.
+Source bufferSource(const std::vector<char>& buffer);
+
+//! \brief Sink writing to an output stream.
+//! \throw std::runtime_error if writing fails
+Sink streamSink(std::ostream& os);
+
+//! \brief Source reading from an input stream.
+Source streamSource(std::istream& is);
+
+} // end namespace Serialization
+} // end namespace Opm
+
+#endif // SERIALIZER_STREAM_HPP
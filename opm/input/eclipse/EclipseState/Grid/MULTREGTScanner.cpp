@@ -34,6 +34,8 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <map>
 #include <stdexcept>
 #include <string>
@@ -78,6 +80,23 @@ bool is_adjacent(const Opm::GridDims& gridDims,
         || is_adjacent(ijk1, ijk2, {2, 0, 1}); // (I,J,K) <-> (I,J,K+1)
 }
 
+// Region pairs with no more than this number of combinations are stored
+// in a dense matrix, others in a hash map.
+constexpr std::int64_t maxDenseRegionPairs = std::int64_t{1} << 20;
+
+std::uint64_t regionPairKey(const int offset1, const int offset2)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(offset1)) << 32)
+        | static_cast<std::uint32_t>(offset2);
+}
+
+bool ignoreRecordNNC(const Opm::MULTREGT::NNCBehaviourEnum nnc_behaviour,
+                     const bool is_aqu)
+{
+    return (nnc_behaviour == Opm::MULTREGT::NNCBehaviourEnum::NONNC)
+        || (is_aqu && (nnc_behaviour == Opm::MULTREGT::NNCBehaviourEnum::NOAQUNNC));
+}
+
 } // Anonymous namespace
 
 namespace Opm {
@@ -154,6 +173,8 @@ namespace Opm {
 
         this->template fillSearchMap<0>(m_records);
         this->template fillSearchMap<1>(m_records_same);
+
+        this->buildLookup();
     }
 
     template<int index>
@@ -237,6 +258,8 @@ namespace Opm {
         this->regions = data.regions;
         this->aquifer_cells = data.aquifer_cells;
 
+        this->buildLookup();
+
         return *this;
     }
 
@@ -281,71 +304,66 @@ namespace Opm {
         // multiplier value is the product of the values from each record.
         auto multiplier = 1.0;
 
-        if (this->m_searchMap.empty()) {
+        if (this->m_lookup.empty()) {
             return multiplier;
         }
 
-        auto regPairFoundDifferent = [faceDir, this](const auto& regMap, const auto& regPairPos)
-        {
-            return (regPairPos != regMap.end())
-                && ((this->m_records[regPairPos->second].directions & faceDir) != 0);
-        };
+        const auto is_adj = is_adjacent(this->gridDims, globalIndex1, globalIndex2);
+        const auto is_aqu = this->isAquNNC(globalIndex1, globalIndex2);
 
-        auto regPairFoundSame = [faceDir, this](const auto& regMap, const auto& regPairPos)
+        const auto applyMultiplier = [is_adj, is_aqu, faceDir](const MULTREGTRecord& record)
         {
-            return (regPairPos != regMap.end())
-                && ((this->m_records_same[regPairPos->second].directions & faceDir) != 0);
-        };
+            if ((record.directions & faceDir) == 0) {
+                return false;
+            }
 
-        auto ignoreMultiplierRecord =
-            [is_adj = is_adjacent(this->gridDims, globalIndex1, globalIndex2),
-             is_aqu = this->isAquNNC(globalIndex1, globalIndex2)]
-            (const MULTREGT::NNCBehaviourEnum nnc_behaviour)
-        {
             // We ignore the record if either of the following conditions hold
             //
             //   1. Cells are adjacent, but record stipulates NNCs only
             //   2. Connection is an NNC, but record stipulates no NNCs
             //   3. Connection is associated to a numerical aquifer, but
             //      record stipulates that no such connections apply.
-            return ((is_adj && !is_aqu) && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NNC))
+            const auto nnc_behaviour = record.nnc_behaviour;
+            const auto ignore =
+                   ((is_adj && !is_aqu) && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NNC))
                 || ((!is_adj || is_aqu) && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NONNC))
                 || (is_aqu              && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
-        };
 
+            return (nnc_behaviour == MULTREGT::NNCBehaviourEnum::ALL) || !ignore;
+        };
 
-        for (const auto& [regName, regMaps] : this->m_searchMap) {
-            const auto& region_data = this->regions.at(regName);
-
-            auto regionId1 = region_data[globalIndex1];
-            auto regionId2 = region_data[globalIndex2];
+        for (const auto& lookup : this->m_lookup) {
+            auto regionId1 = (*lookup.regions)[globalIndex1];
+            auto regionId2 = (*lookup.regions)[globalIndex2];
 
             if (regionId1 > regionId2) {
                 std::swap(regionId1, regionId2);
             }
 
-            const auto applyMultiplier = [ignoreMultiplierRecord](const MULTREGTRecord& record)
+            if (const auto ix = lookup.pairRecord(regionId1, regionId2);
+                (ix >= 0) && applyMultiplier(this->m_records[ix]))
             {
-                return (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::ALL) ||
-                ! ignoreMultiplierRecord(record.nnc_behaviour);
-            };
+                multiplier *= this->m_records[ix].trans_mult;
+            }
 
-            multiplier = this->applyMultiplierDifferentRegion(regMaps,
-                                                              multiplier,
-                                                              regionId1,
-                                                              regionId2,
-                                                              applyMultiplier,
-                                                              regPairFoundDifferent);
-            // same region. Note that a pair where both region indices are the same is special.
-            // For connections between it and all other regions the multipliers
-            // will not override otherwise explicitly specified (as pairs with
-            // different ids) multipliers, but accumulated to these.
-            multiplier = this->applyMultiplierSameRegion(regMaps,
-                                                         multiplier,
-                                                         regionId1,
-                                                         regionId2,
-                                                         applyMultiplier,
-                                                         regPairFoundSame);
+            // Same region.  Note that a pair where both region indices are
+            // the same is special.  For connections between it and all
+            // other regions the multipliers will not override otherwise
+            // explicitly specified (as pairs with different ids)
+            // multipliers, but accumulated to these.
+            if (const auto ix = lookup.sameRecord(regionId1);
+                (ix >= 0) && applyMultiplier(this->m_records_same[ix]))
+            {
+                multiplier *= this->m_records_same[ix].trans_mult;
+            }
+
+            if (regionId1 != regionId2) {
+                if (const auto ix = lookup.sameRecord(regionId2);
+                    (ix >= 0) && applyMultiplier(this->m_records_same[ix]))
+                {
+                    multiplier *= this->m_records_same[ix].trans_mult;
+                }
+            }
         }
 
         return multiplier;
@@ -360,123 +378,187 @@ namespace Opm {
         // multiplier value is the product of the values from each record.
         auto multiplier = 1.0;
 
-        if (this->m_searchMap.empty()) {
+        if (this->m_lookup.empty()) {
             return multiplier;
         }
 
-        auto ignoreMultiplierRecord =
-            [is_aqu = this->isAquNNC(globalCellIdx1, globalCellIdx2)]
-            (const MULTREGT::NNCBehaviourEnum nnc_behaviour)
-        {
-            return (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NONNC)
-                || (is_aqu && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
-        };
+        // All entries match no matter what FaceDir says.
+        const auto is_aqu = this->isAquNNC(globalCellIdx1, globalCellIdx2);
 
-        for (const auto& [regName, regMaps] : this->m_searchMap) {
-            const auto& region_data = this->regions.at(regName);
+        for (const auto& lookup : this->m_lookup) {
+            auto regionId1 = (*lookup.regions)[globalCellIdx1];
+            auto regionId2 = (*lookup.regions)[globalCellIdx2];
 
-            auto regionId1 = region_data[globalCellIdx1];
-            auto regionId2 = region_data[globalCellIdx2];
-
-            if (regionId1> regionId2) {
+            if (regionId1 > regionId2) {
                 std::swap(regionId1, regionId2);
             }
 
-            const auto applyMultiplier = [ignoreMultiplierRecord](const auto& record){
-                return ! ignoreMultiplierRecord(record.nnc_behaviour);
-            };
-
-            const auto regPairFound = [](const auto& regMap, const auto& regPairPos)
+            // Same region first, see getRegionMultiplier().
+            if (const auto ix = lookup.sameRecord(regionId1);
+                (ix >= 0) && !ignoreRecordNNC(this->m_records_same[ix].nnc_behaviour, is_aqu))
             {
-                // all entries match no matter what FaceDir says.
-                return (regPairPos != regMap.end());
-            };
+                multiplier *= this->m_records_same[ix].trans_mult;
+            }
+
+            if (regionId1 != regionId2) {
+                if (const auto ix = lookup.sameRecord(regionId2);
+                    (ix >= 0) && !ignoreRecordNNC(this->m_records_same[ix].nnc_behaviour, is_aqu))
+                {
+                    multiplier *= this->m_records_same[ix].trans_mult;
+                }
+            }
 
-            multiplier = this->applyMultiplierSameRegion(regMaps,
-                                                         multiplier,
-                                                         regionId1,
-                                                         regionId2,
-                                                         applyMultiplier,
-                                                         regPairFound);
-            // same region. Note that a pair where both region indices are the same is special.
-            // For connections between it and all other regions the multipliers
-            // will not override otherwise explicitly specified (as pairs with
-            // different ids) multipliers, but accumulated to these.
-            multiplier = this->applyMultiplierDifferentRegion(regMaps,
-                                                              multiplier,
-                                                              regionId1,
-                                                              regionId2,
-                                                              applyMultiplier,
-                                                              regPairFound);
+            if (const auto ix = lookup.pairRecord(regionId1, regionId2);
+                (ix >= 0) && !ignoreRecordNNC(this->m_records[ix].nnc_behaviour, is_aqu))
+            {
+                multiplier *= this->m_records[ix].trans_mult;
+            }
         }
 
         return multiplier;
     }
 
-    template<typename ApplyDecision, typename RegPairFound>
-    double MULTREGTScanner::applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
-                                                           double multiplier,
-                                                           std::size_t regionId1,
-                                                           std::size_t regionId2,
-                                                           const ApplyDecision& applyMultiplier,
-                                                           const RegPairFound& regPairFound) const
+    std::vector<double>
+    MULTREGTScanner::getRegionMultipliers(const std::vector<Connection>& connections) const
     {
-        const auto& myMap = std::get<0>(regMaps);
-        decltype(myMap.begin()) regPairPos;
-
-        regPairPos = myMap.find({ regionId1, regionId2 });
+        auto multipliers = std::vector<double>(connections.size(), 1.0);
 
-        if (!regPairFound(myMap, regPairPos)) {
-            // Pair not found.
-            return multiplier;
+        if (this->m_lookup.empty()) {
+            return multipliers;
         }
-        const auto& record = this->m_records[regPairPos->second];
 
-        if (applyMultiplier(record)) {
-            multiplier *= record.trans_mult;
+        const auto numConnections = static_cast<std::ptrdiff_t>(connections.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (auto i = 0*numConnections; i < numConnections; ++i) {
+            const auto& conn = connections[i];
+            multipliers[i] = this->getRegionMultiplier(conn.globalCellIdx1,
+                                                       conn.globalCellIdx2,
+                                                       conn.faceDir);
         }
 
-        return multiplier;
+        return multipliers;
     }
 
+    std::vector<double>
+    MULTREGTScanner::getRegionMultipliersNNC(const std::vector<std::pair<std::size_t, std::size_t>>& cellPairs) const
+    {
+        auto multipliers = std::vector<double>(cellPairs.size(), 1.0);
+
+        if (this->m_lookup.empty()) {
+            return multipliers;
+        }
+
+        const auto numPairs = static_cast<std::ptrdiff_t>(cellPairs.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (auto i = 0*numPairs; i < numPairs; ++i) {
+            multipliers[i] = this->getRegionMultiplierNNC(cellPairs[i].first,
+                                                          cellPairs[i].second);
+        }
+
+        return multipliers;
+    }
 
-    template<typename ApplyDecision, typename RegPairFound>
-    double MULTREGTScanner::applyMultiplierSameRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
-                                                      double multiplier,
-                                                      std::size_t regionId1,
-                                                      std::size_t regionId2,
-                                                      const ApplyDecision& applyMultiplier,
-                                                      const RegPairFound& regPairFound) const
+    void MULTREGTScanner::buildLookup()
     {
-        const auto& myMap = std::get<1>(regMaps);
-        decltype(myMap.begin()) regPairPos;
+        this->m_lookup.clear();
+
+        for (const auto& [regName, regMaps] : this->m_searchMap) {
+            const auto regionPos = this->regions.find(regName);
+            if (regionPos == this->regions.end()) {
+                continue;
+            }
+
+            const auto& [pairMap, sameMap] = regMaps;
 
-        // search for entry where the two region ids are the same
-        // where one of those is a region of ours.
-        regPairPos = myMap.find({ regionId1, regionId1 });
+            auto& lookup = this->m_lookup.emplace_back();
+            lookup.regions = &regionPos->second;
 
-        if (regPairFound(myMap, regPairPos)) {
-            const auto& record = this->m_records_same[regPairPos->second];
+            auto minRegion = std::numeric_limits<int>::max();
+            auto maxRegion = std::numeric_limits<int>::min();
+            for (const auto* map : { &pairMap, &sameMap }) {
+                for (const auto& [regPair, recordIx] : *map) {
+                    minRegion = std::min(minRegion, regPair.first);
+                    maxRegion = std::max(maxRegion, regPair.second);
+                }
+            }
 
-            if (applyMultiplier(record)) {
-                multiplier *= record.trans_mult;
+            if (minRegion > maxRegion) {
+                continue;
             }
-        }
-        if (regionId1 != regionId2)
-        {
-            // also try to apply other region multiplier.
-            regPairPos = myMap.find({ regionId2, regionId2 });
 
-            if (regPairFound(myMap, regPairPos)) {
-                const auto& record = this->m_records_same[regPairPos->second];
+            const auto numRegions = std::int64_t{maxRegion} - minRegion + 1;
+            lookup.minRegion = minRegion;
+            lookup.numRegions = static_cast<int>(numRegions);
+
+            // Dense storage of the region pairs implies dense storage of
+            // the regions.  Division avoids overflow of the product.
+            if (numRegions <= maxDenseRegionPairs / numRegions) {
+                lookup.sameDense.assign(numRegions, -1);
+                for (const auto& [regPair, recordIx] : sameMap) {
+                    lookup.sameDense[regPair.first - minRegion] = static_cast<int>(recordIx);
+                }
+
+                lookup.pairsDense.assign(numRegions * numRegions, -1);
+                for (const auto& [regPair, recordIx] : pairMap) {
+                    const auto i = regPair.first - minRegion;
+                    const auto j = regPair.second - minRegion;
+                    lookup.pairsDense[i*numRegions + j] = static_cast<int>(recordIx);
+                }
+            }
+            else {
+                lookup.sameHashed.reserve(sameMap.size());
+                for (const auto& [regPair, recordIx] : sameMap) {
+                    lookup.sameHashed.emplace(regPair.first - minRegion,
+                                              static_cast<int>(recordIx));
+                }
 
-                if (applyMultiplier(record)) {
-                    multiplier *= record.trans_mult;
+                lookup.pairsHashed.reserve(pairMap.size());
+                for (const auto& [regPair, recordIx] : pairMap) {
+                    const auto key = regionPairKey(regPair.first - minRegion,
+                                                   regPair.second - minRegion);
+                    lookup.pairsHashed.emplace(key, static_cast<int>(recordIx));
                 }
             }
         }
+    }
 
-        return multiplier;
+    int MULTREGTScanner::RegionSetLookup::sameRecord(const int regionId) const
+    {
+        const auto i = std::int64_t{regionId} - this->minRegion;
+        if ((i < 0) || (i >= this->numRegions)) {
+            return -1;
+        }
+
+        if (! this->sameDense.empty()) {
+            return this->sameDense[i];
+        }
+
+        const auto pos = this->sameHashed.find(static_cast<int>(i));
+        return (pos == this->sameHashed.end()) ? -1 : pos->second;
+    }
+
+    int MULTREGTScanner::RegionSetLookup::pairRecord(const int regionId1,
+                                                     const int regionId2) const
+    {
+        const auto i = std::int64_t{regionId1} - this->minRegion;
+        const auto j = std::int64_t{regionId2} - this->minRegion;
+        if ((i < 0) || (j < 0) || (i >= this->numRegions) || (j >= this->numRegions)) {
+            return -1;
+        }
+
+        if (! this->pairsDense.empty()) {
+            return this->pairsDense[i*this->numRegions + j];
+        }
+
+        const auto pos = this->pairsHashed.find(regionPairKey(static_cast<int>(i),
+                                                              static_cast<int>(j)));
+        return (pos == this->pairsHashed.end()) ? -1 : pos->second;
     }
 
     void MULTREGTScanner::addKeyword(const DeckKeyword& deckKeyword)
@@ -25,9 +25,11 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -89,6 +91,14 @@ namespace Opm {
     class MULTREGTScanner
     {
     public:
+        /// Connection across a face between two cells of the grid.
+        struct Connection
+        {
+            std::size_t globalCellIdx1;
+            std::size_t globalCellIdx2;
+            FaceDir::DirEnum faceDir;
+        };
+
         MULTREGTScanner() = default;
         MULTREGTScanner(const MULTREGTScanner& data);
         MULTREGTScanner(const GridDims& grid,
@@ -109,6 +119,20 @@ namespace Opm {
         double getRegionMultiplierNNC(std::size_t globalCellIdx1,
                                       std::size_t globalCellIdx2) const;
 
+        /// \brief Region multipliers of many face connections
+        ///
+        /// Equivalent to calling getRegionMultiplier() for every
+        /// connection, but evaluated in parallel if OpenMP is enabled.
+        std::vector<double>
+        getRegionMultipliers(const std::vector<Connection>& connections) const;
+
+        /// \brief Region multipliers of many non-neighbouring connections
+        ///
+        /// Equivalent to calling getRegionMultiplierNNC() for every pair of
+        /// cells, but evaluated in parallel if OpenMP is enabled.
+        std::vector<double>
+        getRegionMultipliersNNC(const std::vector<std::pair<std::size_t, std::size_t>>& cellPairs) const;
+
         template <class Serializer>
         void serializeOp(Serializer& serializer)
         {
@@ -120,6 +144,10 @@ namespace Opm {
 
             serializer(regions);
             serializer(aquifer_cells);
+
+            if (!serializer.isSerializing()) {
+                this->buildLookup();
+            }
         }
 
     private:
@@ -130,43 +158,34 @@ namespace Opm {
             std::vector<MULTREGTRecord>::size_type
         >;
 
-        /// \brief Apply regionMultiplier from entries where source and target region differ
-        ///
-        /// \param regMaps the maps for the region name (FLUXNUM or else)
-        ///        first entry is between regions with different indices
-        ///        second entry is between regions withe the same index
-        /// \param regionId1 Id of egion for first cell
-        /// \param regionId Id of regions for the second cell (not less than regionId1!)
-        /// \param applyMultiplier Functor returning true if multiplier should be applied
-        /// \param regPairFound Functor to check whether there is a entry for region pair.
-        template<typename ApplyDecision, typename RegPairFound>
-        double applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
-                                              double multiplier,
-                                              std::size_t regionId1,
-                                              std::size_t regionId2,
-                                              const ApplyDecision& applyMultiplier,
-                                              const RegPairFound& regPairFound) const;
-
-        /// \brief Apply region multipliers from entries with same source and target region
+        /// \brief Record indices of one region set, keyed on region IDs
         ///
-        /// Note that a pair where both region indices are the same is special.
-        /// For connections between it and all other regions the multipliers
-        /// will not override otherwise explicitly specified (as pairs with
-        /// different ids) multipliers, but accumulated to these.
-        /// \param regMaps the maps for the region name (FLUXNUM or else)
-        ///        first entry is between regions with different indices
-        ///        second entry is between regions withe the same index
-        /// \param regionId1 Id of egion for first cell
-        /// \param regionId Id of regions for the second cell (not less than regionId1!)
-        /// \param applyMultiplier Functor returning true if multiplier should be applied
-        /// \param regPairFound Functor to check whether there is a entry for region pair.
-        template<typename ApplyDecision, typename RegPairFound>
-        double applyMultiplierSameRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
-                                         double multiplier,
-                                         std::size_t regionId1,
-                                         std::size_t regionId2,
-                                         const ApplyDecision& applyMultiplier,
-                                         const RegPairFound& regPairFound) const;
+        /// Derived from m_searchMap so that the multiplier of a connection
+        /// is found by array lookups, rather than by searching the maps,
+        /// when the transmissibilities of all faces are computed.  The
+        /// regions and region pairs are stored in dense arrays unless the
+        /// range of region IDs is too large, in which case both are hashed.
+        struct RegionSetLookup
+        {
+            /// Region IDs of all cells, owned by MULTREGTScanner::regions.
+            const std::vector<int>* regions{nullptr};
+
+            int minRegion{0};
+            int numRegions{0};
+
+            /// Index into m_records_same for region minRegion + i, or -1.
+            std::vector<int> sameDense{};
+            std::unordered_map<int, int> sameHashed{};
+
+            /// Index into m_records for region pair (minRegion + i,
+            /// minRegion + j), stored at i*numRegions + j, or -1.
+            std::vector<int> pairsDense{};
+            std::unordered_map<std::uint64_t, int> pairsHashed{};
+
+            int sameRecord(int regionId) const;
+            int pairRecord(int regionId1, int regionId2) const;
+        };
+
         template<int index>
         void fillSearchMap(const std::vector<MULTREGTRecord>& records);
 
@@ -187,6 +206,11 @@ namespace Opm {
         std::map<std::string, std::vector<int>> regions{};
         std::vector<std::size_t> aquifer_cells{};
 
+        /// One entry for each region set in m_searchMap, in the same order.
+        std::vector<RegionSetLookup> m_lookup{};
+
+        void buildLookup();
+
         void addKeyword(const DeckKeyword& deckKeyword);
 
         bool isAquNNC(std::size_t globalCellIdx1, std::size_t globalCellIdx2) const;
@@ -17,7 +17,10 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <cstddef>
 #include <stdexcept>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -121,6 +124,14 @@ namespace Opm {
         return m_multregtScanner.getRegionMultiplierNNC(globalCellIndex1, globalCellIndex2);
     }
 
+    std::vector<double> TransMult::getRegionMultipliers(const std::vector<MULTREGTScanner::Connection>& connections) const {
+        return m_multregtScanner.getRegionMultipliers(connections);
+    }
+
+    std::vector<double> TransMult::getRegionMultipliersNNC(const std::vector<std::pair<std::size_t, std::size_t>>& cellPairs) const {
+        return m_multregtScanner.getRegionMultipliersNNC(cellPairs);
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
         return m_trans.count(faceDir) == 1;
     }
@@ -138,7 +149,12 @@ namespace Opm {
     void TransMult::applyMULT(const std::vector<double>& srcData, FaceDir::DirEnum faceDir)
     {
         auto& dstProp = this->getDirectionProperty(faceDir);
-        for (size_t i = 0; i < srcData.size(); ++i)
+        const auto size = static_cast<std::ptrdiff_t>(srcData.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (auto i = 0*size; i < size; ++i)
             dstProp[i] *= srcData[i];
     }
 
@@ -157,9 +173,42 @@ namespace Opm {
 
 
     void TransMult::applyMULTFLT(const FaultCollection& faults) {
+        // The faults are applied with one thread per face direction.  Every
+        // thread then updates a separate multiplier array, in the same
+        // fault order as a serial loop.  The arrays are created up front
+        // since that modifies m_trans.
+        std::vector<FaceDir::DirEnum> faceDirs;
         for (size_t faultIndex = 0; faultIndex < faults.size(); faultIndex++) {
-            auto& fault = faults.getFault(faultIndex);
-            this->applyMULTFLT(fault);
+            for (const auto& face : faults.getFault(faultIndex)) {
+                const auto faceDir = face.getDir();
+                if (std::find(faceDirs.begin(), faceDirs.end(), faceDir) == faceDirs.end()) {
+                    faceDirs.push_back(faceDir);
+                    this->getDirectionProperty(faceDir);
+                }
+            }
+        }
+
+        const auto numDirs = static_cast<int>(faceDirs.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (auto d = 0; d < numDirs; ++d) {
+            const auto faceDir = faceDirs[d];
+            auto& multProperty = this->m_trans.at(faceDir);
+
+            for (size_t faultIndex = 0; faultIndex < faults.size(); faultIndex++) {
+                const auto& fault = faults.getFault(faultIndex);
+                const double transMult = fault.getTransMult();
+
+                for (const auto& face : fault) {
+                    if (face.getDir() != faceDir)
+                        continue;
+
+                    for (auto globalIndex : face)
+                        multProperty[globalIndex] *= transMult;
+                }
+            }
         }
     }
 
@@ -33,6 +33,8 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
@@ -61,6 +63,10 @@ namespace Opm {
         double getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplier( size_t globalCellIndex1, size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplierNNC(std::size_t globalCellIndex1, std::size_t globalCellIndex2) const;
+
+        /// \brief Region multipliers of all connections of a batch, see MULTREGTScanner.
+        std::vector<double> getRegionMultipliers(const std::vector<MULTREGTScanner::Connection>& connections) const;
+        std::vector<double> getRegionMultipliersNNC(const std::vector<std::pair<std::size_t, std::size_t>>& cellPairs) const;
         void applyMULT(const std::vector<double>& srcMultProp, FaceDir::DirEnum faceDir);
         void applyMULTFLT(const FaultCollection& faults);
         void applyMULTFLT(const Fault& fault);
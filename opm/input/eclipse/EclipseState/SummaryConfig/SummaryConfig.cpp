@@ -20,6 +20,7 @@
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/TimingMacros.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 #include <opm/common/utility/shmatch.hpp>
 
@@ -1796,6 +1797,8 @@ SummaryConfig::SummaryConfig( const Deck& deck,
                               const ParseContext& parseContext,
                               ErrorGuard& errors,
                               const GridDims& dims) {
+    OPM_TIMEFUNCTION();
+
     try {
         SUMMARYSection section( deck );
         SummaryConfigContext context;
@@ -104,6 +104,7 @@ namespace Opm {
         size_t rows = deckItem.data_size() / numColumns();
         for (size_t colIdx = 0; colIdx < numColumns(); ++colIdx) {
             auto& column = getColumn( colIdx );
+            column.reserve( rows );
             for (size_t rowIdx = 0; rowIdx < rows; rowIdx++) {
                 size_t deckItemIdx = rowIdx*numColumns() + colIdx;
                 if (deckItem.defaultApplied(deckItemIdx))
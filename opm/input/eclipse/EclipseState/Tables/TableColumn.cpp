@@ -71,7 +71,7 @@ namespace Opm {
     {
         size_t nextIndex = index + 1;
         if (nextIndex < m_values.size()) {
-            if (!m_default[nextIndex]) {
+            if (!isDefault(nextIndex)) {
                 double nextValue = m_values[nextIndex];
                 assertOrder( value , nextValue, index, tableName );
             }
@@ -83,7 +83,7 @@ namespace Opm {
     {
         if (index > 0) {
             size_t prevIndex = index - 1;
-            if (!m_default[prevIndex]) {
+            if (!isDefault(prevIndex)) {
                 double prevValue = m_values[prevIndex];
                 assertOrder( prevValue , value, index, tableName );
             }
@@ -98,11 +98,24 @@ namespace Opm {
     }
 
 
+    bool TableColumn::isDefault(size_t index) const
+    {
+        return (m_defaultCount > 0) && m_default[index];
+    }
+
+
+    void TableColumn::reserve(size_t numValues)
+    {
+        m_values.reserve( numValues );
+    }
+
+
     void TableColumn::addValue(double value, const std::string& tableName)
     {
         assertUpdate( tableName, m_values.size() , value );
         m_values.push_back( value );
-        m_default.push_back( false );
+        if (m_defaultCount > 0)
+            m_default.push_back( false );
     }
 
 
@@ -113,6 +126,9 @@ namespace Opm {
         if (defaultAction == Table::DEFAULT_CONST)
             addValue( m_schema.getDefaultValue( ), tableName);
         else if (defaultAction == Table::DEFAULT_LINEAR) {
+            if (m_defaultCount == 0)
+                m_default.assign( m_values.size() , false );
+
             m_values.push_back( -1 ); // Should never even be read.
             m_default.push_back( true );
             m_defaultCount += 1;
@@ -126,9 +142,11 @@ namespace Opm {
     {
         assertUpdate(  tableName,  index , value );
         m_values[index] = value;
-        if (m_default[index]) {
+        if (isDefault(index)) {
             m_default[index] = false;
             m_defaultCount -= 1;
+            if (m_defaultCount == 0)
+                std::vector<bool>().swap( m_default );
         }
     }
 
@@ -136,14 +154,14 @@ namespace Opm {
         if (index >= m_values.size())
             throw std::invalid_argument("Value: " + std::to_string( index ) + " out of range: [0," + std::to_string( m_values.size()) + ")");
 
-        return m_default[index];
+        return isDefault(index);
     }
 
     double TableColumn::operator[](size_t index) const {
         if (index >= m_values.size())
             throw std::invalid_argument("Value: " + std::to_string( index ) + " out of range: [0," + std::to_string( m_values.size()) + ")");
 
-        if (m_default[index])
+        if (isDefault(index))
             throw std::invalid_argument("Value at index " + std::to_string( index ) + " is defaulted - can not ask!");
 
         return m_values[index];
@@ -42,6 +42,7 @@ namespace Opm {
         const std::string& name() const;
         void assertOrder(double value1 , double value2, size_t index,
                          const std::string& tableName) const;
+        void reserve(size_t numValues);
         void addValue(double, const std::string& tableName);
         void addDefault(const std::string& tableName);
         void updateValue(size_t index, double value, const std::string& tableName);
@@ -86,10 +87,14 @@ namespace Opm {
         void assertUpdate(const std::string& tableName, size_t index, double value) const;
         void assertPrevious(const std::string& tableName, size_t index , double value) const;
         void assertNext(const std::string& tableName, size_t index , double value) const;
+        bool isDefault(size_t index) const;
 
         ColumnSchema m_schema;
         std::string m_name;
         std::vector<double> m_values;
+
+        // Flags of the defaulted values, only allocated while the column
+        // has such values, i.e., empty whenever m_defaultCount == 0.
         std::vector<bool> m_default;
         size_t m_defaultCount;
     };
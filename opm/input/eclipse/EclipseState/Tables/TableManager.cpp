@@ -20,11 +20,14 @@
 
 #include <algorithm>
 #include <cmath>
+#include <exception>
+#include <functional>
 #include <iomanip>
 #include <ios>
 #include <iterator>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 
 #include <fmt/format.h>
 
@@ -34,6 +37,7 @@
 #include <opm/common/OpmLog/StreamLog.hpp>
 
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/ParallelFor.hpp>
 
 #include <opm/input/eclipse/Parser/ParserKeywords/A.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/D.hpp>
@@ -127,8 +131,78 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
     return JFunc(deck);
 }
 
+template <typename Function>
+void withInputLocation(const KeywordLocation& location, Function&& function) {
+    try {
+        function();
+    } catch (const std::runtime_error& err) {
+        throw OpmInputError(err, location);
+    } catch (const std::invalid_argument& err) {
+        throw OpmInputError(err, location);
+    }
+}
+
 }
 
+    /*
+      The tables of independent keywords, and the tables of the individual
+      regions of the simple table keywords, are constructed in parallel.
+      The parallel tasks only write to their own results and only read the
+      deck items of their own keyword/record; DeckItem converts its values
+      to SI units lazily on first access, so an item must never be used by
+      two tasks at the same time.  The serial tasks insert the results into
+      the shared containers, and hold all other steps which may fail.
+
+      After the parallel tasks have run, all tasks are visited in the order
+      they were added: the serial tasks are run and the failures of the
+      parallel tasks are rethrown.  The error reported is therefore the one
+      a serial construction of the tables would report.
+    */
+    class TableManager::InitTasks {
+    public:
+        void addParallel(std::function<void()> task) {
+            this->tasks_.push_back({ std::move(task), true });
+        }
+
+        void addSerial(std::function<void()> task) {
+            this->tasks_.push_back({ std::move(task), false });
+        }
+
+        void run() {
+            std::vector<std::exception_ptr> failures(this->tasks_.size());
+            utility::parallelFor(this->tasks_.size(), [this, &failures](const std::size_t i)
+            {
+                if (! this->tasks_[i].parallel)
+                    return;
+
+                try {
+                    this->tasks_[i].task();
+                }
+                catch (...) {
+                    failures[i] = std::current_exception();
+                }
+            });
+
+            for (std::size_t i = 0; i < this->tasks_.size(); ++i) {
+                if (failures[i])
+                    std::rethrow_exception(failures[i]);
+
+                if (! this->tasks_[i].parallel)
+                    this->tasks_[i].task();
+            }
+
+            this->tasks_.clear();
+        }
+
+    private:
+        struct Task {
+            std::function<void()> task;
+            bool parallel;
+        };
+
+        std::vector<Task> tasks_{};
+    };
+
 
 
     TableManager::TableManager( const Deck& deck )
@@ -149,18 +223,23 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
         m_salinity = ParserKeywords::SALINITY::MOLALITY::defaultValue;
 
         initDims( deck );
-        initSimpleTables( deck );
-        initFullTables(deck, "PVTG", m_pvtgTables);
-        initFullTables(deck, "PVTGW", m_pvtgwTables);
-        initFullTables(deck, "PVTGWO", m_pvtgwoTables);
-        initFullTables(deck, "PVTO", m_pvtoTables);
-
-        if (deck.hasKeyword<ParserKeywords::PVTO>()) {
-            this->checkPVTOMonotonicity(deck);
-        }
+        {
+            InitTasks tasks;
+            initSimpleTables( deck, tasks );
 
-        if( deck.hasKeyword( "PVTSOL" ) )
-           initFullTables(deck, "PVTSOL", m_pvtsolTables);
+            tasks.addParallel([this, &deck]() { initFullTables(deck, "PVTG", m_pvtgTables); });
+            tasks.addParallel([this, &deck]() { initFullTables(deck, "PVTGW", m_pvtgwTables); });
+            tasks.addParallel([this, &deck]() { initFullTables(deck, "PVTGWO", m_pvtgwoTables); });
+            tasks.addParallel([this, &deck]() { initFullTables(deck, "PVTO", m_pvtoTables); });
+
+            if (deck.hasKeyword<ParserKeywords::PVTO>()) {
+                tasks.addSerial([this, &deck]() { this->checkPVTOMonotonicity(deck); });
+            }
+
+            tasks.addParallel([this, &deck]() { initFullTables(deck, "PVTSOL", m_pvtsolTables); });
+
+            tasks.run();
+        }
 
         if( deck.hasKeyword( "PVTW" ) )
             this->m_pvtwTable = PvtwTable( deck["PVTW"].back() );
@@ -429,7 +508,7 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
         return getTables(tableName);
     }
 
-    void TableManager::initSimpleTables(const Deck& deck) {
+    void TableManager::initSimpleTables(const Deck& deck, InitTasks& tasks) {
 
         addTables( "SWOF" , m_tabdims.getNumSatTables() );
         addTables( "SGWFN", m_tabdims.getNumSatTables() );
@@ -518,34 +597,34 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
         }
 
 
-        initSimpleTableContainer<SgwfnTable>(deck, "SGWFN", m_tabdims.getNumSatTables());
-        initSimpleTableContainer<Sof2Table>(deck, "SOF2" , m_tabdims.getNumSatTables());
-        initSimpleTableContainer<Sof3Table>(deck, "SOF3" , m_tabdims.getNumSatTables());
+        initSimpleTableContainer<SgwfnTable>(deck, "SGWFN", m_tabdims.getNumSatTables(), tasks);
+        initSimpleTableContainer<Sof2Table>(deck, "SOF2" , m_tabdims.getNumSatTables(), tasks);
+        initSimpleTableContainer<Sof3Table>(deck, "SOF3" , m_tabdims.getNumSatTables(), tasks);
         {
-            initSimpleTableContainerWithJFunc<SwofTable>(deck, "SWOF", m_tabdims.getNumSatTables());
-            initSimpleTableContainerWithJFunc<SgofTable>(deck, "SGOF", m_tabdims.getNumSatTables());
-            initSimpleTableContainerWithJFunc<SwfnTable>(deck, "SWFN", m_tabdims.getNumSatTables());
-            initSimpleTableContainerWithJFunc<SgfnTable>(deck, "SGFN", m_tabdims.getNumSatTables());
-            initSimpleTableContainerWithJFunc<SlgofTable>(deck, "SLGOF", m_tabdims.getNumSatTables());
+            initSimpleTableContainerWithJFunc<SwofTable>(deck, "SWOF", m_tabdims.getNumSatTables(), tasks);
+            initSimpleTableContainerWithJFunc<SgofTable>(deck, "SGOF", m_tabdims.getNumSatTables(), tasks);
+            initSimpleTableContainerWithJFunc<SwfnTable>(deck, "SWFN", m_tabdims.getNumSatTables(), tasks);
+            initSimpleTableContainerWithJFunc<SgfnTable>(deck, "SGFN", m_tabdims.getNumSatTables(), tasks);
+            initSimpleTableContainerWithJFunc<SlgofTable>(deck, "SLGOF", m_tabdims.getNumSatTables(), tasks);
 
         }
-        initSimpleTableContainer<SsfnTable>(deck, "SSFN" , m_tabdims.getNumSatTables());
-        initSimpleTableContainer<MsfnTable>(deck, "MSFN" , m_tabdims.getNumSatTables());
-
-        initSimpleTableContainer<WsfTable>(deck, "WSF" , m_tabdims.getNumSatTables());
-        initSimpleTableContainer<GsfTable>(deck, "GSF" , m_tabdims.getNumSatTables());
-
-        initSimpleTableContainer<RsvdTable>(deck, "RSVD" , m_eqldims.getNumEquilRegions());
-        initSimpleTableContainer<RvvdTable>(deck, "RVVD" , m_eqldims.getNumEquilRegions());
-        initSimpleTableContainer<RvwvdTable>(deck, "RVWVD" , m_eqldims.getNumEquilRegions());
-        initSimpleTableContainer<PbvdTable>(deck, "PBVD" , m_eqldims.getNumEquilRegions());
-        initSimpleTableContainer<PdvdTable>(deck, "PDVD" , m_eqldims.getNumEquilRegions());
-        initSimpleTableContainer<SaltpvdTable>(deck, "SALTPVD" , m_eqldims.getNumEquilRegions());
-        initSimpleTableContainer<SaltvdTable>(deck, "SALTVD" , m_eqldims.getNumEquilRegions());
-        initSimpleTableContainer<SaltsolTable>(deck, "SALTSOL" , m_tabdims.getNumPVTTables());
-        initSimpleTableContainer<PermfactTable>(deck, "PERMFACT" , m_tabdims.getNumPVTTables());
-        initSimpleTableContainer<PcfactTable>(deck, "PCFACT" , m_tabdims.getNumSatTables());
-        initSimpleTableContainer<AqutabTable>(deck, "AQUTAB" , m_aqudims.getNumInfluenceTablesCT());
+        initSimpleTableContainer<SsfnTable>(deck, "SSFN" , m_tabdims.getNumSatTables(), tasks);
+        initSimpleTableContainer<MsfnTable>(deck, "MSFN" , m_tabdims.getNumSatTables(), tasks);
+
+        initSimpleTableContainer<WsfTable>(deck, "WSF" , m_tabdims.getNumSatTables(), tasks);
+        initSimpleTableContainer<GsfTable>(deck, "GSF" , m_tabdims.getNumSatTables(), tasks);
+
+        initSimpleTableContainer<RsvdTable>(deck, "RSVD" , m_eqldims.getNumEquilRegions(), tasks);
+        initSimpleTableContainer<RvvdTable>(deck, "RVVD" , m_eqldims.getNumEquilRegions(), tasks);
+        initSimpleTableContainer<RvwvdTable>(deck, "RVWVD" , m_eqldims.getNumEquilRegions(), tasks);
+        initSimpleTableContainer<PbvdTable>(deck, "PBVD" , m_eqldims.getNumEquilRegions(), tasks);
+        initSimpleTableContainer<PdvdTable>(deck, "PDVD" , m_eqldims.getNumEquilRegions(), tasks);
+        initSimpleTableContainer<SaltpvdTable>(deck, "SALTPVD" , m_eqldims.getNumEquilRegions(), tasks);
+        initSimpleTableContainer<SaltvdTable>(deck, "SALTVD" , m_eqldims.getNumEquilRegions(), tasks);
+        initSimpleTableContainer<SaltsolTable>(deck, "SALTSOL" , m_tabdims.getNumPVTTables(), tasks);
+        initSimpleTableContainer<PermfactTable>(deck, "PERMFACT" , m_tabdims.getNumPVTTables(), tasks);
+        initSimpleTableContainer<PcfactTable>(deck, "PCFACT" , m_tabdims.getNumSatTables(), tasks);
+        initSimpleTableContainer<AqutabTable>(deck, "AQUTAB" , m_aqudims.getNumInfluenceTablesCT(), tasks);
         {
             size_t numEndScaleTables = ParserKeywords::ENDSCALE::NTENDP::defaultValue;
 
@@ -555,10 +634,10 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
                 numEndScaleTables = static_cast<size_t>(record.getItem<ParserKeywords::ENDSCALE::NTENDP>().get< int >(0));
             }
 
-            initSimpleTableContainer<EnkrvdTable>( deck , "ENKRVD", numEndScaleTables);
-            initSimpleTableContainer<EnptvdTable>( deck , "ENPTVD", numEndScaleTables);
-            initSimpleTableContainer<ImkrvdTable>( deck , "IMKRVD", numEndScaleTables);
-            initSimpleTableContainer<ImptvdTable>( deck , "IMPTVD", numEndScaleTables);
+            initSimpleTableContainer<EnkrvdTable>( deck , "ENKRVD", numEndScaleTables, tasks);
+            initSimpleTableContainer<EnptvdTable>( deck , "ENPTVD", numEndScaleTables, tasks);
+            initSimpleTableContainer<ImkrvdTable>( deck , "IMKRVD", numEndScaleTables, tasks);
+            initSimpleTableContainer<ImptvdTable>( deck , "IMPTVD", numEndScaleTables, tasks);
         }
         {
             size_t numMiscibleTables = ParserKeywords::MISCIBLE::NTMISC::defaultValue;
@@ -567,11 +646,11 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
                 const auto& record = keyword.getRecord(0);
                 numMiscibleTables =  static_cast<size_t>(record.getItem<ParserKeywords::MISCIBLE::NTMISC>().get< int >(0));
             }
-            initSimpleTableContainer<SorwmisTable>(deck, "SORWMIS", numMiscibleTables);
-            initSimpleTableContainer<SgcwmisTable>(deck, "SGCWMIS", numMiscibleTables);
-            initSimpleTableContainer<MiscTable>(deck, "MISC", numMiscibleTables);
-            initSimpleTableContainer<PmiscTable>(deck, "PMISC", numMiscibleTables);
-            initSimpleTableContainer<TlpmixpaTable>(deck, "TLPMIXPA", numMiscibleTables);
+            initSimpleTableContainer<SorwmisTable>(deck, "SORWMIS", numMiscibleTables, tasks);
+            initSimpleTableContainer<SgcwmisTable>(deck, "SGCWMIS", numMiscibleTables, tasks);
+            initSimpleTableContainer<MiscTable>(deck, "MISC", numMiscibleTables, tasks);
+            initSimpleTableContainer<PmiscTable>(deck, "PMISC", numMiscibleTables, tasks);
+            initSimpleTableContainer<TlpmixpaTable>(deck, "TLPMIXPA", numMiscibleTables, tasks);
 
         }
         {
@@ -582,38 +661,38 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
                 const auto& record = keyword.getRecord(0);
                 numRocktabTables = static_cast<size_t>(record.getItem<ParserKeywords::ROCKCOMP::NTROCC>().get< int >(0));
             }
-            initSimpleTableContainer<RockwnodTable>(deck, "ROCKWNOD", numRocktabTables);
-            initSimpleTableContainer<OverburdTable>(deck, "OVERBURD", numRocktabTables);
+            initSimpleTableContainer<RockwnodTable>(deck, "ROCKWNOD", numRocktabTables, tasks);
+            initSimpleTableContainer<OverburdTable>(deck, "OVERBURD", numRocktabTables, tasks);
         }
 
-        initSimpleTableContainer<PvdgTable>(deck, "PVDG", m_tabdims.getNumPVTTables());
-        initSimpleTableContainer<PvdoTable>(deck, "PVDO", m_tabdims.getNumPVTTables());
-        initSimpleTableContainer<PvdsTable>(deck, "PVDS", m_tabdims.getNumPVTTables());
-        initSimpleTableContainer<SpecheatTable>(deck, "SPECHEAT", m_tabdims.getNumPVTTables());
-        initSimpleTableContainer<SpecrockTable>(deck, "SPECROCK", m_tabdims.getNumSatTables());
-        initSimpleTableContainer<OilvisctTable>(deck, "OILVISCT", m_tabdims.getNumPVTTables());
-        initSimpleTableContainer<GasvisctTable>(deck, "GASVISCT", m_tabdims.getNumPVTTables());
-        initSimpleTableContainer<WatvisctTable>(deck, "WATVISCT", m_tabdims.getNumPVTTables());
+        initSimpleTableContainer<PvdgTable>(deck, "PVDG", m_tabdims.getNumPVTTables(), tasks);
+        initSimpleTableContainer<PvdoTable>(deck, "PVDO", m_tabdims.getNumPVTTables(), tasks);
+        initSimpleTableContainer<PvdsTable>(deck, "PVDS", m_tabdims.getNumPVTTables(), tasks);
+        initSimpleTableContainer<SpecheatTable>(deck, "SPECHEAT", m_tabdims.getNumPVTTables(), tasks);
+        initSimpleTableContainer<SpecrockTable>(deck, "SPECROCK", m_tabdims.getNumSatTables(), tasks);
+        initSimpleTableContainer<OilvisctTable>(deck, "OILVISCT", m_tabdims.getNumPVTTables(), tasks);
+        initSimpleTableContainer<GasvisctTable>(deck, "GASVISCT", m_tabdims.getNumPVTTables(), tasks);
+        initSimpleTableContainer<WatvisctTable>(deck, "WATVISCT", m_tabdims.getNumPVTTables(), tasks);
 
-        initSimpleTableContainer<PlyadsTable>(deck, "PLYADS", m_tabdims.getNumSatTables());
-        initSimpleTableContainer<PlyviscTable>(deck, "PLYVISC", m_tabdims.getNumPVTTables());
-        initSimpleTableContainer<PlydhflfTable>(deck, "PLYDHFLF", m_tabdims.getNumPVTTables());
+        initSimpleTableContainer<PlyadsTable>(deck, "PLYADS", m_tabdims.getNumSatTables(), tasks);
+        initSimpleTableContainer<PlyviscTable>(deck, "PLYVISC", m_tabdims.getNumPVTTables(), tasks);
+        initSimpleTableContainer<PlydhflfTable>(deck, "PLYDHFLF", m_tabdims.getNumPVTTables(), tasks);
 
-        initSimpleTableContainer<FoamadsTable>(deck, "FOAMADS", m_tabdims.getNumSatTables());
-        initSimpleTableContainer<FoammobTable>(deck, "FOAMMOB", m_tabdims.getNumPVTTables());
+        initSimpleTableContainer<FoamadsTable>(deck, "FOAMADS", m_tabdims.getNumSatTables(), tasks);
+        initSimpleTableContainer<FoammobTable>(deck, "FOAMMOB", m_tabdims.getNumPVTTables(), tasks);
 
-        initPlyrockTables(deck);
-        initPlymaxTables(deck);
-        initRTempTables(deck);
-        initRocktabTables(deck);
-        initPlyshlogTables(deck);
-        initPlymwinjTables(deck);
-        initSkprpolyTables(deck);
-        initSkprwatTables(deck);
+        tasks.addSerial([this, &deck]() { initPlyrockTables(deck); });
+        tasks.addSerial([this, &deck]() { initPlymaxTables(deck); });
+        initRTempTables(deck, tasks);
+        tasks.addSerial([this, &deck]() { initRocktabTables(deck); });
+        tasks.addSerial([this, &deck]() { initPlyshlogTables(deck); });
+        tasks.addSerial([this, &deck]() { initPlymwinjTables(deck); });
+        tasks.addSerial([this, &deck]() { initSkprpolyTables(deck); });
+        tasks.addSerial([this, &deck]() { initSkprwatTables(deck); });
     }
 
 
-    void TableManager::initRTempTables(const Deck& deck) {
+    void TableManager::initRTempTables(const Deck& deck, InitTasks& tasks) {
         // the temperature vs depth table. the problem here is that
         // the TEMPVD (E300) and RTEMPVD (E300 + E100) keywords are
         // synonymous, but we want to provide only a single cannonical
@@ -623,11 +702,13 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
             hasRTEMPVD { deck.hasKeyword<ParserKeywords::RTEMPVD>() } ;
 
         if (hasTEMPVD && hasRTEMPVD) {
-            throw OpmInputError("The TEMPVD and RTEMPVD tables are mutually exclusive.", deck.get<ParserKeywords::TEMPVD>().back().location(), deck.get<ParserKeywords::RTEMPVD>().back().location());
+            tasks.addSerial([&deck]() {
+                throw OpmInputError("The TEMPVD and RTEMPVD tables are mutually exclusive.", deck.get<ParserKeywords::TEMPVD>().back().location(), deck.get<ParserKeywords::RTEMPVD>().back().location());
+            });
         } else if (hasTEMPVD) {
-            initSimpleTableContainer<RtempvdTable>(deck,  "TEMPVD", "RTEMPVD", m_eqldims.getNumEquilRegions());
+            initSimpleTableContainer<RtempvdTable>(deck,  "TEMPVD", "RTEMPVD", m_eqldims.getNumEquilRegions(), tasks);
         } else if (hasRTEMPVD) {
-            initSimpleTableContainer<RtempvdTable>(deck, "RTEMPVD", "RTEMPVD", m_eqldims.getNumEquilRegions());
+            initSimpleTableContainer<RtempvdTable>(deck, "RTEMPVD", "RTEMPVD", m_eqldims.getNumEquilRegions(), tasks);
         }
     }   
 
@@ -1244,11 +1325,17 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
 
 
     void TableManager::complainAboutAmbiguousKeyword(const Deck& deck, const std::string& keywordName) {
-        OpmLog::error("The " + keywordName + " keyword must be unique in the deck. Ignoring all!");
-        const auto& keywords = deck.getKeywordList(keywordName);
-        for (size_t i = 0; i < keywords.size(); ++i) {
-            std::string msg = "Ambiguous keyword "+keywordName+" defined here";
-            OpmLog::error(Log::fileMessage(keywords[i]->location(), msg));
+        // Also called from the parallel tasks of the constructor
+#ifdef _OPENMP
+#pragma omp critical(TableManager_complain)
+#endif
+        {
+            OpmLog::error("The " + keywordName + " keyword must be unique in the deck. Ignoring all!");
+            const auto& keywords = deck.getKeywordList(keywordName);
+            for (size_t i = 0; i < keywords.size(); ++i) {
+                std::string msg = "Ambiguous keyword "+keywordName+" defined here";
+                OpmLog::error(Log::fileMessage(keywords[i]->location(), msg));
+            }
         }
     }
 
@@ -1538,18 +1625,20 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
         }
     }
 
-    template <class TableType>
-    void TableManager::initSimpleTableContainerWithJFunc(const Deck& deck,
-                                                         const std::string& keywordName,
-                                                         const std::string& tableName,
-                                                         size_t numTables) {
+    template <class MakeTable>
+    void TableManager::queueSimpleTables(const Deck& deck,
+                                         const std::string& keywordName,
+                                         const std::string& tableName,
+                                         size_t numTables,
+                                         InitTasks& tasks,
+                                         MakeTable makeTable) {
         if (!deck.hasKeyword(keywordName))
             return; // the table is not featured by the deck...
 
         auto& container = forceGetTables(tableName , numTables);
 
         if (deck.count(keywordName) > 1) {
-            complainAboutAmbiguousKeyword(deck, keywordName);
+            tasks.addSerial([this, &deck, keywordName]() { complainAboutAmbiguousKeyword(deck, keywordName); });
             return;
         }
 
@@ -1558,85 +1647,81 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
         for (size_t tableIdx = 0; tableIdx < tableKeyword.size(); ++tableIdx) {
             const auto& dataItem = tableKeyword.getRecord( tableIdx ).getItem("DATA");
             if (dataItem.data_size() > 0) {
-                try {
-                    std::shared_ptr<TableType> table = std::make_shared<TableType>( dataItem, useJFunc(), tableIdx );
-                    container.addTable( tableIdx , table );
-                    lastComplete = tableIdx;
-                } catch (const std::runtime_error& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                } catch (const std::invalid_argument& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                }
+                auto table = std::make_shared<std::shared_ptr<SimpleTable>>();
+                tasks.addParallel([table, makeTable, &dataItem, &tableKeyword, tableIdx]()
+                {
+                    withInputLocation(tableKeyword.location(), [&]()
+                    { *table = makeTable(dataItem, tableIdx); });
+                });
+
+                tasks.addSerial([table, &container, &tableKeyword, tableIdx]()
+                {
+                    withInputLocation(tableKeyword.location(), [&]()
+                    { container.addTable(tableIdx, std::move(*table)); });
+                });
+
+                lastComplete = tableIdx;
             }
             else if (tableIdx > static_cast<size_t>(0)) {
+                // Built from the same deck item as the last complete
+                // table, so must not run concurrently with that one.
                 const auto& item = tableKeyword.getRecord(lastComplete).getItem("DATA");
-                container.addTable(tableIdx, std::make_shared<TableType>(item, useJFunc(), tableIdx));
+                tasks.addSerial([makeTable, &container, &item, tableIdx]()
+                { container.addTable(tableIdx, makeTable(item, tableIdx)); });
             }
             else {
-                throw OpmInputError {
-                    fmt::format("Cannot default region {}'s table data", tableIdx + 1),
-                    tableKeyword.location()
-                };
+                tasks.addSerial([&tableKeyword, tableIdx]()
+                {
+                    throw OpmInputError {
+                        fmt::format("Cannot default region {}'s table data", tableIdx + 1),
+                        tableKeyword.location()
+                    };
+                });
+                return;
             }
         }
     }
 
+    template <class TableType>
+    void TableManager::initSimpleTableContainerWithJFunc(const Deck& deck,
+                                                         const std::string& keywordName,
+                                                         const std::string& tableName,
+                                                         size_t numTables,
+                                                         InitTasks& tasks) {
+        const bool useJF = useJFunc();
+        queueSimpleTables(deck, keywordName, tableName, numTables, tasks,
+                          [useJF](const DeckItem& item, const size_t tableIdx)
+                          -> std::shared_ptr<SimpleTable>
+                          { return std::make_shared<TableType>(item, useJF, tableIdx); });
+    }
+
     template <class TableType>
     void TableManager::initSimpleTableContainer(const Deck& deck,
                                                 const std::string& keywordName,
                                                 const std::string& tableName,
-                                                size_t numTables) {
-        if (!deck.hasKeyword(keywordName))
-            return; // the table is not featured by the deck...
-
-        auto& container = forceGetTables(tableName , numTables);
-
-        if (deck.count(keywordName) > 1) {
-            complainAboutAmbiguousKeyword(deck, keywordName);
-            return;
-        }
-
-        auto lastComplete = 0 * numTables;
-        const auto& tableKeyword = deck[keywordName].back();
-        for (size_t tableIdx = 0; tableIdx < tableKeyword.size(); ++tableIdx) {
-            const auto& dataItem = tableKeyword.getRecord( tableIdx ).getItem("DATA");
-            if (dataItem.data_size() > 0) {
-                try {
-                    std::shared_ptr<TableType> table = std::make_shared<TableType>( dataItem, tableIdx );
-                    container.addTable( tableIdx , table );
-                    lastComplete = tableIdx;
-                } catch (const std::runtime_error& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                } catch (const std::invalid_argument& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                }
-            }
-            else if (tableIdx > static_cast<size_t>(0)) {
-                const auto& item = tableKeyword.getRecord(lastComplete).getItem("DATA");
-                container.addTable(tableIdx, std::make_shared<TableType>(item, tableIdx));
-            }
-            else {
-                throw OpmInputError {
-                    fmt::format("Cannot default region {}'s table data", tableIdx + 1),
-                    tableKeyword.location()
-                };
-            }
-        }
+                                                size_t numTables,
+                                                InitTasks& tasks) {
+        queueSimpleTables(deck, keywordName, tableName, numTables, tasks,
+                          [](const DeckItem& item, const size_t tableIdx)
+                          -> std::shared_ptr<SimpleTable>
+                          { return std::make_shared<TableType>(item, tableIdx); });
     }
 
     template <class TableType>
     void TableManager::initSimpleTableContainer(const Deck& deck,
                                                 const std::string& keywordName,
-                                                size_t numTables) {
-        initSimpleTableContainer<TableType>(deck , keywordName , keywordName , numTables);
+                                                size_t numTables,
+                                                InitTasks& tasks) {
+        initSimpleTableContainer<TableType>(deck , keywordName , keywordName , numTables, tasks);
     }
 
 
     template <class TableType>
     void TableManager::initSimpleTableContainerWithJFunc(const Deck& deck,
                                                          const std::string& keywordName,
-                                                         size_t numTables) {
-        initSimpleTableContainerWithJFunc<TableType>(deck , keywordName , keywordName , numTables);
+                                                         size_t numTables,
+                                                         InitTasks& tasks) {
+        initSimpleTableContainerWithJFunc<TableType>(deck , keywordName , keywordName , numTables, tasks);
     }
 
     template <class TableType>
@@ -287,13 +287,15 @@ namespace Opm {
         }
 
     private:
+        class InitTasks;
+
         TableContainer& forceGetTables( const std::string& tableName , size_t numTables);
 
         void complainAboutAmbiguousKeyword(const Deck& deck, const std::string& keywordName);
 
         void addTables( const std::string& tableName , size_t numTables);
-        void initSimpleTables(const Deck& deck);
-        void initRTempTables(const Deck& deck);
+        void initSimpleTables(const Deck& deck, InitTasks& tasks);
+        void initRTempTables(const Deck& deck, InitTasks& tasks);
         void initDims(const Deck& deck);
         void initRocktabTables(const Deck& deck);
 
@@ -328,23 +330,39 @@ namespace Opm {
         void initSimpleTableContainerWithJFunc(const Deck& deck,
                                       const std::string& keywordName,
                                       const std::string& tableName,
-                                      size_t numTables);
+                                      size_t numTables,
+                                      InitTasks& tasks);
 
         template <class TableType>
         void initSimpleTableContainer(const Deck& deck,
                                       const std::string& keywordName,
                                       const std::string& tableName,
-                                      size_t numTables);
+                                      size_t numTables,
+                                      InitTasks& tasks);
 
         template <class TableType>
         void initSimpleTableContainer(const Deck& deck,
                                       const std::string& keywordName,
-                                      size_t numTables);
+                                      size_t numTables,
+                                      InitTasks& tasks);
 
         template <class TableType>
         void initSimpleTableContainerWithJFunc(const Deck& deck,
                                                const std::string& keywordName,
-                                               size_t numTables);
+                                               size_t numTables,
+                                               InitTasks& tasks);
+
+        /*
+          Queues the construction of one table per record of the keyword;
+          makeTable(dataItem, tableIdx) creates the table.
+        */
+        template <class MakeTable>
+        void queueSimpleTables(const Deck& deck,
+                               const std::string& keywordName,
+                               const std::string& tableName,
+                               size_t numTables,
+                               InitTasks& tasks,
+                               MakeTable makeTable);
 
         template <class TableType>
         void initSimpleTable(const Deck& deck,
@@ -21,6 +21,7 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
+#include <opm/common/TimingMacros.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
@@ -1550,7 +1551,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
 
     Deck Parser::parseFile(const std::string &dataFileName, const ParseContext& parseContext,
                            ErrorGuard& errors, const std::vector<Opm::Ecl::SectionType>& sections) const {
-
+        OPM_TIMEFUNCTION();
 
         std::set<Opm::Ecl::SectionType> ignore_sections;
 
@@ -1618,6 +1619,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
 
 
     Deck Parser::parseString(const std::string &data, const ParseContext& parseContext, ErrorGuard& errors) const {
+        OPM_TIMEFUNCTION();
         ParserState parserState( this->codeKeywords(), parseContext, errors );
         parserState.loadString( data );
         parseState( parserState, *this );
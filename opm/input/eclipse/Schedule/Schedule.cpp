@@ -23,6 +23,7 @@
 
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/TimingMacros.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 #include <opm/input/eclipse/Parser/InputErrorAction.hpp>
 #include <opm/common/utility/String.hpp>
@@ -101,9 +102,11 @@
 #include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -400,6 +403,8 @@ namespace Opm {
                                  WelSegsSet* welsegs_wells,
                                  std::set<std::string>* compsegs_wells)
     {
+        OPM_TIMEFUNCTION_LOCAL();
+
         HandlerContext handlerContext { *this, block, keyword, grid, currentStep,
                                         matches, actionx_mode,
                                         parseContext, errors, sim_update, target_wellpi,
@@ -580,6 +585,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                       const bool keepKeywords,
                                       const bool log_to_debug)
 {
+        OPM_TIMEFUNCTION();
+
         std::vector<std::pair< const DeckKeyword* , std::size_t> > rftProperties;
         std::string time_unit = this->m_static.m_unit_system.name(UnitSystem::measure::time);
         auto deck_time = [this](double seconds) { return this->m_static.m_unit_system.from_si(UnitSystem::measure::time, seconds); };
@@ -1479,7 +1486,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         // applicable field-wide GCONPROD and/or GCONINJE settings stored in
         // the restart file.  Happens at most once per run.
 
-        auto& field = this->snapshots.back().groups.get("FIELD");
+        auto field = this->snapshots.back().groups.get("FIELD");
         if (new_group.isProductionGroup())
             // Initialise field-wide GCONPROD settings from restart.
             field.updateProduction(new_group.productionProperties());
@@ -1487,6 +1494,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
             if (new_group.hasInjectionControl(phase))
                 // Initialise field-wide GCONINJE settings (phase) from restart.
                 field.updateInjection(new_group.injectionProperties(phase));
+
+        this->snapshots.back().groups.update( std::move(field) );
     }
 
 
@@ -2006,25 +2015,42 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         if (!this->snapshots[reportStep].wells.has(well_name))
             return;
 
-        std::vector<Well *> unique_wells;
-        for (std::size_t step = reportStep; step < this->snapshots.size(); step++) {
-            auto& well = this->snapshots[step].wells.get(well_name);
-            if (unique_wells.empty() || (!(*unique_wells.back() == well)))
-                unique_wells.push_back( &well );
-        }
+        // The wells and their connections are shared between report steps
+        // and with copies of this schedule, e.g., the base of a
+        // Schedule::Delta.  Scale copies of the connections and update the
+        // report steps with new well objects rather than changing the
+        // shared ones.
+        std::vector<const Well*> wells;
+        for (std::size_t step = reportStep; step < this->snapshots.size(); step++)
+            wells.push_back( &this->snapshots[step].wells(well_name) );
 
         std::vector<bool> scalingApplicable;
         const auto targetPI = this->snapshots[reportStep].target_wellpi.at(well_name);
-        auto prev_well = unique_wells[0];
-        auto scalingFactor = prev_well->convertDeckPI(targetPI) / newWellPI;
-        prev_well->applyWellProdIndexScaling(scalingFactor, scalingApplicable);
-
-        for (std::size_t well_index = 1; well_index < unique_wells.size(); well_index++) {
-            auto wellPtr = unique_wells[well_index];
-            if (! wellPtr->hasSameConnectionsPointers(*prev_well)) {
-                wellPtr->applyWellProdIndexScaling(scalingFactor, scalingApplicable);
-                prev_well = wellPtr;
+        const auto scalingFactor = wells.front()->convertDeckPI(targetPI) / newWellPI;
+
+        std::unordered_map<const Well*, std::size_t> scaled_wells;
+        std::unordered_map<const WellConnections*, std::shared_ptr<WellConnections>> scaled_connections;
+        for (std::size_t index = 0; index < wells.size(); index++) {
+            const auto step = reportStep + index;
+
+            const auto scaled_well = scaled_wells.find(wells[index]);
+            if (scaled_well != scaled_wells.end()) {
+                this->snapshots[step].wells.update(well_name, this->snapshots[scaled_well->second].wells);
+                continue;
+            }
+
+            const auto* connections = &wells[index]->getConnections();
+            auto scaled = scaled_connections.find(connections);
+            if (scaled == scaled_connections.end()) {
+                auto new_connections = std::make_shared<WellConnections>(*connections);
+                new_connections->applyWellPIScaling(scalingFactor, scalingApplicable);
+                scaled = scaled_connections.emplace(connections, std::move(new_connections)).first;
             }
+
+            auto well = *wells[index];
+            well.updateConnections(scaled->second, true);
+            this->snapshots[step].wells.update( std::move(well) );
+            scaled_wells.emplace(wells[index], step);
         }
     }
 
@@ -2295,7 +2321,7 @@ namespace {
             this->snapshots.back().update_whistctl(WellProducerCModeFromInt(rst_state.header.histctl_override));
 
         for (const auto& rst_group : rst_state.groups) {
-            auto& group = this->snapshots.back().groups.get( rst_group.name );
+            auto group = this->snapshots.back().groups.get( rst_group.name );
             if (group.isProductionGroup()) {
                 auto new_config = this->snapshots.back().guide_rate();
                 new_config.update_production_group(group);
@@ -2309,6 +2335,7 @@ namespace {
                         inj_prop.voidage_group = rst_group_names[rst_group.voidage_group_index];
                         group.updateInjection(inj_prop);
                     }
+                    this->snapshots.back().groups.update( std::move(group) );
                 }
              }
         }
@@ -2321,7 +2348,7 @@ namespace {
 
             for (const auto& [control, value, wgname, ig_phase] : uda_records) {
                 if (UDQ::well_control(control)) {
-                    auto& well = this->snapshots.back().wells.get(wgname);
+                    auto well = this->snapshots.back().wells.get(wgname);
 
                     if (UDQ::is_well_injection_control(control, well.isInjector())) {
                         auto injection_properties = std::make_shared<Well::WellInjectionProperties>(well.getInjectionProperties());
@@ -2334,8 +2361,10 @@ namespace {
                         production_properties->update_uda(udq_config, udq_active, control, value);
                         well.updateProduction(std::move(production_properties));
                     }
+
+                    this->snapshots.back().wells.update( std::move(well) );
                 } else {
-                    auto& group = this->snapshots.back().groups.get(wgname);
+                    auto group = this->snapshots.back().groups.get(wgname);
                     if (UDQ::is_group_injection_control(control)) {
                         auto injection_properties = group.injectionProperties(ig_phase.value());
                         injection_properties.update_uda(udq_config, udq_active, control, value);
@@ -2347,6 +2376,8 @@ namespace {
                         production_properties.update_uda(udq_config, udq_active, control, value);
                         group.updateProduction(production_properties);
                     }
+
+                    this->snapshots.back().groups.update( std::move(group) );
                 }
             }
             this->snapshots.back().udq_active.update( std::move(udq_active) );
@@ -367,6 +367,49 @@ namespace Opm {
             }
         }
 
+        /*
+          The Delta class is used to send only the changes made to a
+          schedule, e.g. by an ACTIONX or PYACTION, to processes which hold
+          an earlier version of it. The sender keeps a copy of the schedule
+          as of the last transfer, which is cheap since consecutive copies
+          share all unchanged ScheduleState members:
+
+             Schedule::Delta delta(sched, sched_at_last_transfer);
+             serializer.pack(delta);
+
+          while the receivers apply the changes to their own copy:
+
+             Schedule::Delta delta(sched);
+             serializer.unpack(delta);
+
+          The static part of the schedule, which is not affected by actions,
+          is not transferred. Shared ScheduleState members are compared by
+          storage identity, so changes to the schedule must replace those
+          objects rather than modify them in place.
+        */
+        class Delta {
+        public:
+            Delta(const Schedule& sched, const Schedule& base)
+                : m_sched(const_cast<Schedule&>(sched))
+                , m_base(&base)
+            {}
+
+            explicit Delta(Schedule& sched)
+                : m_sched(sched)
+                , m_base(&sched)
+            {}
+
+            template<class Serializer>
+            void serializeOp(Serializer& serializer)
+            {
+                this->m_sched.serializeDelta(serializer, *this->m_base);
+            }
+
+        private:
+            Schedule& m_sched;
+            const Schedule* m_base;
+        };
+
         template <typename T>
         std::vector<std::pair<std::size_t,  T>> unique() const
         {
@@ -386,6 +429,43 @@ namespace Opm {
     private:
         friend class HandlerContext;
 
+        template<class Serializer>
+        void serializeDelta(Serializer& serializer, const Schedule& base)
+        {
+            this->m_sched_deck.serializeDelta(serializer, base.m_sched_deck);
+            serializer(this->action_wgnames);
+            serializer(this->potential_wellopen_patterns);
+            serializer(this->exit_status);
+            serializer(this->restart_output);
+            serializer(this->completed_cells);
+            serializer(this->m_treat_critical_as_non_critical);
+            serializer(this->current_report_step);
+            serializer(this->m_lowActionParsingStrictness);
+            serializer(this->simUpdateFromPython);
+
+            std::size_t num_snapshots = this->snapshots.size();
+            serializer(num_snapshots);
+            if (!serializer.isSerializing())
+                this->snapshots.resize(num_snapshots);
+
+            for (std::size_t index = 0; index < num_snapshots; index++) {
+                bool complete = serializer.isSerializing() && (index >= base.snapshots.size());
+                serializer(complete);
+                if (complete)
+                    serializer(this->snapshots[index]);
+                else
+                    this->snapshots[index].serializeDelta(serializer, base.snapshots[index]);
+            }
+
+            if (!serializer.isSerializing()) {
+                for (auto& snapshot : snapshots) {
+                    for (auto& well : snapshot.wells) {
+                        well.second->updateUnitSystem(&m_static.m_unit_system);
+                    }
+                }
+            }
+        }
+
         // Please update the member functions
         //   - operator==(const Schedule&) const
         //   - serializationTestObject()
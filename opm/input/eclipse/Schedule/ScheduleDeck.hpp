@@ -77,6 +77,35 @@ namespace Opm {
             serializer(m_location);
         }
 
+        /*
+          Serialize only the blocks which differ from those of @base, an
+          earlier version of this deck. The blocks are compared by value,
+          since an action may clear a block and add the same number of
+          other keywords. When deserializing @base is not used.
+        */
+        template<class Serializer>
+        void serializeDelta(Serializer& serializer, const ScheduleDeck& base) {
+            serializer(m_restart_time);
+            serializer(m_restart_offset);
+            serializer(skiprest);
+            serializer(m_location);
+
+            std::size_t num_blocks = m_blocks.size();
+            serializer(num_blocks);
+            if (!serializer.isSerializing())
+                m_blocks.resize(num_blocks);
+
+            for (std::size_t index = 0; index < num_blocks; index++) {
+                bool changed = serializer.isSerializing() &&
+                    ((index >= base.m_blocks.size())
+                     || !(m_blocks[index] == base.m_blocks[index]));
+
+                serializer(changed);
+                if (changed)
+                    serializer(m_blocks[index]);
+            }
+        }
+
         void dump_deck(std::ostream& os, const UnitSystem& usys) const;
 
         void clearKeywords(const std::size_t idx);
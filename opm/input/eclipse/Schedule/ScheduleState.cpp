@@ -320,6 +320,35 @@ bool ScheduleState::operator==(const ScheduleState& other) const {
 
 
 
+bool ScheduleState::equal_values(const ScheduleState& other) const {
+
+    return this->aqufluxs == other.aqufluxs
+        && this->bcprop == other.bcprop
+        && this->target_wellpi == other.target_wellpi
+        && this->next_tstep == other.next_tstep
+        && this->m_start_time == other.m_start_time
+        && this->m_end_time == other.m_end_time
+        && this->m_sim_step == other.m_sim_step
+        && this->m_month_num == other.m_month_num
+        && this->m_year_num == other.m_year_num
+        && this->m_first_in_year == other.m_first_in_year
+        && this->m_first_in_month == other.m_first_in_month
+        && this->m_save_step == other.m_save_step
+        && this->m_tuning == other.m_tuning
+        && this->m_nupcol == other.m_nupcol
+        && this->m_oilvap == other.m_oilvap
+        && this->m_events == other.m_events
+        && this->m_wellgroup_events == other.m_wellgroup_events
+        && this->m_geo_keywords == other.m_geo_keywords
+        && this->m_message_limits == other.m_message_limits
+        && this->m_whistctl_mode == other.m_whistctl_mode
+        && this->m_sumthin == other.m_sumthin
+        && this->m_rptonly == other.m_rptonly
+        ;
+}
+
+
+
 ScheduleState ScheduleState::serializationTestObject() {
     auto t1 = TimeService::now();
     auto t2 = t1 + std::chrono::hours(48);
@@ -21,6 +21,7 @@
 #define SCHEDULE_TSTEP_HPP
 
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/common/utility/PersistentHashMap.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/input/eclipse/EclipseState/Runspec.hpp>
@@ -150,6 +151,19 @@ namespace Opm {
                 serializer(m_data);
             }
 
+            /*
+              Serialize the member only if it no longer shares storage with
+              @base. When deserializing @base is not used.
+            */
+            template<class Serializer>
+            void serializeDelta(Serializer& serializer, const ptr_member<T>& base)
+            {
+                bool changed = serializer.isSerializing() && (this->m_data != base.m_data);
+                serializer(changed);
+                if (changed)
+                    serializer(m_data);
+            }
+
         private:
             std::shared_ptr<T> m_data;
         };
@@ -164,6 +178,13 @@ namespace Opm {
               const K& T::name() const;
 
           Which is used to get the storage key for the objects.
+
+          The key -> object mapping is stored in a persistent hash map, so
+          copying a map_member when creating the ScheduleState for the next
+          report step is O(1), and updating an element only copies the
+          O(log n) trie nodes on the path to that element. Consecutive
+          ScheduleState instances therefore share the storage for all keys
+          which have not changed.
          */
 
         template <typename K, typename T>
@@ -187,9 +208,9 @@ namespace Opm {
 
 
             const std::shared_ptr<T> get_ptr(const K& key) const {
-                auto iter = this->m_data.find(key);
-                if (iter != this->m_data.end())
-                    return iter->second;
+                const auto* ptr = this->m_data.find(key);
+                if (ptr != nullptr)
+                    return *ptr;
 
                 return {};
             }
@@ -203,13 +224,13 @@ namespace Opm {
 
             void update(T object) {
                 auto key = object.name();
-                this->m_data[key] = std::make_shared<T>( std::move(object) );
+                this->m_data.insert_or_assign(key, std::make_shared<T>( std::move(object) ));
             }
 
             void update(const K& key, const map_member<K,T>& other) {
                 auto other_ptr = other.get_ptr(key);
                 if (other_ptr)
-                    this->m_data[key] = other.get_ptr(key);
+                    this->m_data.insert_or_assign(key, std::move(other_ptr));
                 else
                     throw std::logic_error(std::string{"Tried to update member: "} + as_string(key) + std::string{"with uninitialized object"});
             }
@@ -267,20 +288,27 @@ namespace Opm {
                 return this->m_data.size();
             }
 
-            typename std::unordered_map<K, std::shared_ptr<T>>::const_iterator begin() const {
+            typename utility::PersistentHashMap<K, std::shared_ptr<T>>::const_iterator begin() const {
                 return this->m_data.begin();
             }
 
-            typename std::unordered_map<K, std::shared_ptr<T>>::const_iterator end() const {
+            typename utility::PersistentHashMap<K, std::shared_ptr<T>>::const_iterator end() const {
                 return this->m_data.end();
             }
 
+            // Number of storage nodes not shared with any other
+            // map_member instance, e.g., the one of the previous report
+            // step.  Used for memory diagnostics.
+            std::size_t unique_storage_nodes() const {
+                return this->m_data.uniqueNodeCount();
+            }
+
 
             static map_member<K,T> serializationTestObject() {
                 map_member<K,T> map_object;
                 T value_object = T::serializationTestObject();
                 K key = value_object.name();
-                map_object.m_data.emplace( key, std::make_shared<T>( std::move(value_object) ));
+                map_object.m_data.insert_or_assign( key, std::make_shared<T>( std::move(value_object) ));
                 return map_object;
             }
 
@@ -290,8 +318,43 @@ namespace Opm {
                 serializer(m_data);
             }
 
+            /*
+              Serialize only the entries which no longer share storage with
+              the corresponding entries of @base. Should entries have been
+              removed the complete map is serialized. When deserializing
+              @base is not used, and the entries are merged into the map.
+            */
+            template<class Serializer>
+            void serializeDelta(Serializer& serializer, const map_member<K,T>& base)
+            {
+                std::vector<std::pair<K, std::shared_ptr<T>>> changed;
+                bool complete = false;
+
+                if (serializer.isSerializing()) {
+                    std::size_t added = 0;
+                    this->m_data.forEachChanged(base.m_data, [&changed, &added](const auto& entry, const auto* base_value) {
+                        changed.emplace_back(entry.first, entry.second);
+                        if (base_value == nullptr)
+                            ++added;
+                    });
+                    complete = (base.m_data.size() + added != this->m_data.size());
+                }
+
+                serializer(complete);
+                if (complete) {
+                    serializer(m_data);
+                    return;
+                }
+
+                serializer(changed);
+                if (!serializer.isSerializing()) {
+                    for (auto& [key, ptr] : changed)
+                        this->m_data.insert_or_assign(key, std::move(ptr));
+                }
+            }
+
         private:
-            std::unordered_map<K, std::shared_ptr<T>> m_data;
+            utility::PersistentHashMap<K, std::shared_ptr<T>> m_data;
         };
 
         struct BHPDefaults {
@@ -539,6 +602,57 @@ namespace Opm {
             serializer(vfpinj);
             serializer(groups);
             serializer(wells);
+            this->serializeValues(serializer);
+        }
+
+        /*
+          Serialize only what differs from @base, an earlier version of this
+          state, e.g. before an ACTIONX or PYACTION was applied. The
+          ptr_member and map_member members are compared by storage
+          identity, the remaining members by value. When deserializing @base
+          is not used, and the changes are applied to this state.
+        */
+        template<class Serializer>
+        void serializeDelta(Serializer& serializer, const ScheduleState& base)
+        {
+            gconsale.serializeDelta(serializer, base.gconsale);
+            gconsump.serializeDelta(serializer, base.gconsump);
+            gecon.serializeDelta(serializer, base.gecon);
+            guide_rate.serializeDelta(serializer, base.guide_rate);
+            wlist_manager.serializeDelta(serializer, base.wlist_manager);
+            well_order.serializeDelta(serializer, base.well_order);
+            group_order.serializeDelta(serializer, base.group_order);
+            actions.serializeDelta(serializer, base.actions);
+            udq.serializeDelta(serializer, base.udq);
+            udq_active.serializeDelta(serializer, base.udq_active);
+            pavg.serializeDelta(serializer, base.pavg);
+            wtest_config.serializeDelta(serializer, base.wtest_config);
+            glo.serializeDelta(serializer, base.glo);
+            network.serializeDelta(serializer, base.network);
+            network_balance.serializeDelta(serializer, base.network_balance);
+            rescoup.serializeDelta(serializer, base.rescoup);
+            rpt_config.serializeDelta(serializer, base.rpt_config);
+            rft_config.serializeDelta(serializer, base.rft_config);
+            rst_config.serializeDelta(serializer, base.rst_config);
+            bhp_defaults.serializeDelta(serializer, base.bhp_defaults);
+            source.serializeDelta(serializer, base.source);
+            wcycle.serializeDelta(serializer, base.wcycle);
+            vfpprod.serializeDelta(serializer, base.vfpprod);
+            vfpinj.serializeDelta(serializer, base.vfpinj);
+            groups.serializeDelta(serializer, base.groups);
+            wells.serializeDelta(serializer, base.wells);
+
+            bool values_changed = serializer.isSerializing() && !this->equal_values(base);
+            serializer(values_changed);
+            if (values_changed)
+                this->serializeValues(serializer);
+        }
+
+    private:
+        // The members which are not shared between report steps.
+        template<class Serializer>
+        void serializeValues(Serializer& serializer)
+        {
             serializer(aqufluxs);
             serializer(bcprop);
             serializer(target_wellpi);
@@ -563,7 +677,8 @@ namespace Opm {
             serializer(this->m_rptonly);
         }
 
-    private:
+        bool equal_values(const ScheduleState& other) const;
+
         time_point m_start_time{};
         std::optional<time_point> m_end_time{};
 
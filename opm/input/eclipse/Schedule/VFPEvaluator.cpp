@@ -0,0 +1,286 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/VFPEvaluator.hpp>
+
+#include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace {
+
+    // The THP for which the BHP values 'bhpNodes' at the THP nodes
+    // 'thpNodes' give 'bhp'.
+    double invert(const std::vector<double>& thpNodes,
+                  const std::vector<double>& bhpNodes,
+                  const double bhp)
+    {
+        const auto n = thpNodes.size();
+        if (n == 1) {
+            return thpNodes.front();
+        }
+
+        auto i = std::size_t{0};
+        while ((i + 2 < n) && (bhp > bhpNodes[i + 1])) {
+            ++i;
+        }
+
+        const auto dBhp = bhpNodes[i + 1] - bhpNodes[i];
+        const auto t = (dBhp != 0.0) ? (bhp - bhpNodes[i]) / dBhp : 0.0;
+
+        return thpNodes[i] + t*(thpNodes[i + 1] - thpNodes[i]);
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+template <std::size_t N>
+VFPInterpolator<N>::VFPInterpolator(std::array<std::vector<double>, N> axes,
+                                    std::vector<double> data)
+    : m_axes(std::move(axes))
+    , m_data(std::move(data))
+{
+    auto size = std::size_t{1};
+    for (auto k = N; k-- > 0;) {
+        if (m_axes[k].empty()) {
+            throw std::invalid_argument {
+                fmt::format("VFP table axis {} is empty", k)
+            };
+        }
+
+        m_strides[k] = size;
+        size *= m_axes[k].size();
+    }
+
+    if (m_data.size() != size) {
+        throw std::invalid_argument {
+            fmt::format("VFP table has {} values, but the axes define {}",
+                        m_data.size(), size)
+        };
+    }
+}
+
+template <std::size_t N>
+void VFPInterpolator<N>::locate(const std::array<double, N>& x, Cell& cell) const
+{
+    constexpr auto inf = std::numeric_limits<double>::infinity();
+
+    auto offset = std::size_t{0};
+    std::array<std::size_t, N> upperStride{};
+
+    for (auto k = 0*N; k < N; ++k) {
+        const auto& axis = m_axes[k];
+        const auto n = axis.size();
+
+        if (n == 1) {
+            cell.index[k] = 0;
+            cell.start[k] = axis.front();
+            cell.invDist[k] = 0.0;
+            cell.lower[k] = -inf;
+            cell.upper[k] = inf;
+            upperStride[k] = 0;
+            continue;
+        }
+
+        // Lower node in [0, n-2]; points outside the axis belong to the
+        // outermost cells.
+        const auto i = static_cast<std::size_t>
+            (std::upper_bound(axis.begin() + 1, axis.end() - 1, x[k]) - axis.begin()) - 1;
+
+        const auto dist = axis[i + 1] - axis[i];
+
+        cell.index[k] = i;
+        cell.start[k] = axis[i];
+        cell.invDist[k] = (dist > 0.0) ? 1.0 / dist : 0.0;
+        cell.lower[k] = (i == 0) ? -inf : axis[i];
+        cell.upper[k] = (i + 2 == n) ? inf : axis[i + 1];
+
+        offset += i * m_strides[k];
+        upperStride[k] = m_strides[k];
+    }
+
+    for (auto c = 0*numCorners; c < numCorners; ++c) {
+        auto pos = offset;
+        for (auto k = 0*N; k < N; ++k) {
+            if ((c >> (N - 1 - k)) & 1) {
+                pos += upperStride[k];
+            }
+        }
+
+        cell.corners[c] = m_data[pos];
+    }
+
+    cell.valid = true;
+}
+
+template <std::size_t N>
+double VFPInterpolator<N>::evaluate(const std::array<double, N>& x,
+                                    Cell& cell,
+                                    std::array<double, N>& derivatives) const
+{
+    auto inside = cell.valid;
+    for (auto k = 0*N; k < N; ++k) {
+        inside = inside && (cell.lower[k] <= x[k]) && (x[k] < cell.upper[k]);
+    }
+
+    if (!inside) {
+        this->locate(x, cell);
+    }
+
+    // Reduce the corners one axis at a time, starting with axis 0 whose
+    // lower and upper corners are the two contiguous halves of the array.
+    // The derivatives with respect to the axes reduced so far are
+    // interpolated along with the values.
+    alignas(64) std::array<double, numCorners> value = cell.corners;
+    alignas(64) std::array<std::array<double, numCorners / 2>, N> deriv;
+
+    auto len = numCorners;
+    for (auto k = 0*N; k < N; ++k) {
+        const auto half = len / 2;
+        const auto t = (x[k] - cell.start[k]) * cell.invDist[k];
+        const auto invDist = cell.invDist[k];
+
+        for (auto j = 0*N; j < k; ++j) {
+            auto& d = deriv[j];
+            for (auto i = 0*half; i < half; ++i) {
+                d[i] += t * (d[i + half] - d[i]);
+            }
+        }
+
+        auto& dk = deriv[k];
+        for (auto i = 0*half; i < half; ++i) {
+            const auto diff = value[i + half] - value[i];
+            dk[i] = diff * invDist;
+            value[i] += t * diff;
+        }
+
+        len = half;
+    }
+
+    for (auto k = 0*N; k < N; ++k) {
+        derivatives[k] = deriv[k][0];
+    }
+
+    return value[0];
+}
+
+template class VFPInterpolator<2>;
+template class VFPInterpolator<5>;
+
+// ---------------------------------------------------------------------------
+
+VFPProdEvaluator::VFPProdEvaluator(const VFPProdTable& table)
+    : m_interpolator({ table.getTHPAxis(), table.getWFRAxis(), table.getGFRAxis(),
+                       table.getALQAxis(), table.getFloAxis() },
+                     table.getTable())
+{}
+
+VFPEvaluation VFPProdEvaluator::bhp(const Input& input, Cell& cell) const
+{
+    std::array<double, 5> d{};
+    const auto value = m_interpolator.evaluate({ input.thp, input.wfr, input.gfr,
+                                                 input.alq, input.flo }, cell, d);
+
+    return { value, d[0], d[1], d[2], d[3], d[4] };
+}
+
+void VFPProdEvaluator::bhp(const std::vector<Input>& inputs,
+                           std::vector<Cell>& cells,
+                           std::vector<VFPEvaluation>& results) const
+{
+    if (cells.size() != inputs.size()) {
+        cells.assign(inputs.size(), Cell{});
+    }
+
+    results.resize(inputs.size());
+    for (auto i = 0*inputs.size(); i < inputs.size(); ++i) {
+        results[i] = this->bhp(inputs[i], cells[i]);
+    }
+}
+
+double VFPProdEvaluator::thp(const Input& input, const double bhp) const
+{
+    const auto& thpNodes = m_interpolator.axis(0);
+
+    std::vector<double> bhpNodes(thpNodes.size());
+    std::array<double, 5> d{};
+    Cell cell{};
+    for (auto i = 0*thpNodes.size(); i < thpNodes.size(); ++i) {
+        bhpNodes[i] = m_interpolator.evaluate({ thpNodes[i], input.wfr, input.gfr,
+                                                input.alq, input.flo }, cell, d);
+    }
+
+    return invert(thpNodes, bhpNodes, bhp);
+}
+
+// ---------------------------------------------------------------------------
+
+VFPInjEvaluator::VFPInjEvaluator(const VFPInjTable& table)
+    : m_interpolator({ table.getTHPAxis(), table.getFloAxis() }, table.getTable())
+{}
+
+VFPEvaluation VFPInjEvaluator::bhp(const Input& input, Cell& cell) const
+{
+    std::array<double, 2> d{};
+    const auto value = m_interpolator.evaluate({ input.thp, input.flo }, cell, d);
+
+    VFPEvaluation result{};
+    result.value = value;
+    result.dthp = d[0];
+    result.dflo = d[1];
+
+    return result;
+}
+
+void VFPInjEvaluator::bhp(const std::vector<Input>& inputs,
+                          std::vector<Cell>& cells,
+                          std::vector<VFPEvaluation>& results) const
+{
+    if (cells.size() != inputs.size()) {
+        cells.assign(inputs.size(), Cell{});
+    }
+
+    results.resize(inputs.size());
+    for (auto i = 0*inputs.size(); i < inputs.size(); ++i) {
+        results[i] = this->bhp(inputs[i], cells[i]);
+    }
+}
+
+double VFPInjEvaluator::thp(const Input& input, const double bhp) const
+{
+    const auto& thpNodes = m_interpolator.axis(0);
+
+    std::vector<double> bhpNodes(thpNodes.size());
+    std::array<double, 2> d{};
+    Cell cell{};
+    for (auto i = 0*thpNodes.size(); i < thpNodes.size(); ++i) {
+        bhpNodes[i] = m_interpolator.evaluate({ thpNodes[i], input.flo }, cell, d);
+    }
+
+    return invert(thpNodes, bhpNodes, bhp);
+}
+
+} // namespace Opm
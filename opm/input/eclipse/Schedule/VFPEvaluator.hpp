@@ -0,0 +1,175 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_VFP_EVALUATOR_HPP
+#define OPM_VFP_EVALUATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace Opm {
+
+class VFPInjTable;
+class VFPProdTable;
+
+/*
+  Bottom hole pressure and its partial derivatives with respect to the
+  axis variables of a VFP table. The derivatives of the axes which are not
+  present in a table, e.g., WFR for injection tables, are zero.
+*/
+struct VFPEvaluation
+{
+    double value{0.0};
+    double dthp{0.0};
+    double dwfr{0.0};
+    double dgfr{0.0};
+    double dalq{0.0};
+    double dflo{0.0};
+};
+
+/*
+  Multilinear interpolation in an N-dimensional table given on a
+  rectilinear grid, with the values stored in row major order, i.e., the
+  last axis varies fastest. Outside of the axis ranges the values are
+  extrapolated linearly from the outermost cells, and axes with a single
+  node are constant.
+
+  The cell of the grid which contains a point is located by a binary search
+  in every axis, and the 2^N table values at its corners are copied into a
+  Cell object supplied by the caller. As long as the following points are
+  in the same cell, typically those of one well in consecutive Newton
+  iterations, neither the search nor the copy is repeated. The
+  interpolation itself then only touches the contiguous, cache line
+  aligned corner values, which the compiler vectorizes.
+*/
+template <std::size_t N>
+class VFPInterpolator
+{
+public:
+    static constexpr std::size_t numCorners = std::size_t{1} << N;
+
+    struct Cell
+    {
+        // Corner values, the bit N-1-k of the index selects the upper node
+        // of axis k.
+        alignas(64) std::array<double, numCorners> corners{};
+
+        // The cell is reused for points with lower[k] <= x[k] < upper[k].
+        std::array<double, N> lower{};
+        std::array<double, N> upper{};
+
+        // Lower node of the cell and inverse distance to the upper node.
+        std::array<double, N> start{};
+        std::array<double, N> invDist{};
+        std::array<std::size_t, N> index{};
+        bool valid{false};
+    };
+
+    VFPInterpolator() = default;
+    VFPInterpolator(std::array<std::vector<double>, N> axes, std::vector<double> data);
+
+    const std::vector<double>& axis(std::size_t k) const
+    { return m_axes[k]; }
+
+    // Interpolated value at x; the derivatives with respect to the axis
+    // variables are written to 'derivatives'.
+    double evaluate(const std::array<double, N>& x,
+                    Cell& cell,
+                    std::array<double, N>& derivatives) const;
+
+private:
+    void locate(const std::array<double, N>& x, Cell& cell) const;
+
+    std::array<std::vector<double>, N> m_axes{};
+    std::array<std::size_t, N> m_strides{};
+    std::vector<double> m_data{};
+};
+
+/*
+  Evaluation of VFPPROD tables for many wells. The evaluator holds a copy
+  of the table, and the caller holds one Cell per well which must only be
+  used with the same evaluator. All rates and ratios are in the SI units of
+  the table axes.
+*/
+class VFPProdEvaluator
+{
+public:
+    using Cell = VFPInterpolator<5>::Cell;
+
+    struct Input
+    {
+        double flo{0.0};
+        double thp{0.0};
+        double wfr{0.0};
+        double gfr{0.0};
+        double alq{0.0};
+    };
+
+    explicit VFPProdEvaluator(const VFPProdTable& table);
+
+    VFPEvaluation bhp(const Input& input, Cell& cell) const;
+
+    // Evaluates inputs[i] with cells[i]. The cells are reset if their
+    // number differs from the number of inputs.
+    void bhp(const std::vector<Input>& inputs,
+             std::vector<Cell>& cells,
+             std::vector<VFPEvaluation>& results) const;
+
+    // The THP for which the table gives the bottom hole pressure 'bhp',
+    // interpolated linearly between the THP nodes and extrapolated beyond
+    // them. The table is assumed to increase with THP; input.thp is
+    // ignored.
+    double thp(const Input& input, double bhp) const;
+
+private:
+    VFPInterpolator<5> m_interpolator;
+};
+
+/*
+  Evaluation of VFPINJ tables for many wells, see VFPProdEvaluator.
+*/
+class VFPInjEvaluator
+{
+public:
+    using Cell = VFPInterpolator<2>::Cell;
+
+    struct Input
+    {
+        double flo{0.0};
+        double thp{0.0};
+    };
+
+    explicit VFPInjEvaluator(const VFPInjTable& table);
+
+    VFPEvaluation bhp(const Input& input, Cell& cell) const;
+
+    void bhp(const std::vector<Input>& inputs,
+             std::vector<Cell>& cells,
+             std::vector<VFPEvaluation>& results) const;
+
+    double thp(const Input& input, double bhp) const;
+
+private:
+    VFPInterpolator<2> m_interpolator;
+};
+
+} // namespace Opm
+
+#endif // OPM_VFP_EVALUATOR_HPP
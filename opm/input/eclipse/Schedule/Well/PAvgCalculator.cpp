@@ -743,16 +743,18 @@ void PAvgCalculator<Scalar>::accumulateLocalContributions(const Sources& sources
     this->accumCTF_.prepareAccumulation();
     this->accumPV_.prepareAccumulation();
 
+    this->resolveCellSources(sources);
+
     const auto connDensity =
         this->connectionDensity(sources, controls, gravity);
 
     if (controls.open_connections()) {
-        this->accumulateLocalContribOpen(sources, controls,
+        this->accumulateLocalContribOpen(controls,
                                          gravity, refDepth,
                                          connDensity);
     }
     else {
-        this->accumulateLocalContribAll(sources, controls,
+        this->accumulateLocalContribAll(controls,
                                         gravity, refDepth,
                                         connDensity);
     }
@@ -872,6 +874,19 @@ void PAvgCalculator<Scalar>::pruneInactiveConnections(const std::vector<bool>& i
                    });
 }
 
+template<class Scalar>
+void PAvgCalculator<Scalar>::resolveCellSources(const Sources& sources)
+{
+    const auto& blockSrc = sources.wellBlocks();
+
+    this->cellSources_.clear();
+    this->cellSources_.reserve(this->contributingCells_.size());
+
+    for (const auto& cell : this->contributingCells_) {
+        this->cellSources_.push_back(blockSrc[cell]);
+    }
+}
+
 template<class Scalar>
 void PAvgCalculator<Scalar>::
 addNeighbour(std::optional<std::size_t> neighbour,
@@ -956,8 +971,7 @@ addNeighbours_Z(const GridDims& cellIndexMap, SetupMap& setupHelperMap)
 template<class Scalar>
 template <typename ConnIndexMap, typename CTFPressureWeightFunction>
 void PAvgCalculator<Scalar>::
-accumulateLocalContributions(const Sources&             sources,
-                             const PAvg&                controls,
+accumulateLocalContributions(const PAvg&                controls,
                              const Scalar               gravity,
                              const Scalar               refDepth,
                              const std::vector<Scalar>& connDensity,
@@ -975,15 +989,15 @@ accumulateLocalContributions(const Sources&             sources,
     this->accumPV_ .prepareContribution();
 
     // Intermediate, per connection results pertaining to CTF-weighted sum.
-    auto accumCTF_c = Accumulator{};
+    auto& accumCTF_c = this->accumCTF_c_;
 
-    auto addContrib = [gravity, refDepth, &sources, &ctfPressWeight, &accumCTF_c, this]
+    auto addContrib = [gravity, refDepth, &ctfPressWeight, &accumCTF_c, this]
         (const ContrIndexType i, const Scalar density, PressureTermHandler handler)
     {
         using Item = typename PAvgDynamicSourceData<Scalar>::
             template SourceDataSpan<const Scalar>::Item;
 
-        const auto src = sources.wellBlocks()[this->contributingCells_[i]];
+        const auto src = this->cellSources_[i];
         const auto p   = src[Item::Pressure] +
             pressureOffset(density, src[Item::Depth], gravity, refDepth);
 
@@ -1028,8 +1042,7 @@ accumulateLocalContributions(const Sources&             sources,
 template<class Scalar>
 template <typename ConnIndexMap>
 void PAvgCalculator<Scalar>::
-accumulateLocalContributions(const Sources&             sources,
-                             const PAvg&                controls,
+accumulateLocalContributions(const PAvg&                controls,
                              const Scalar               gravity,
                              const Scalar               refDepth,
                              const std::vector<Scalar>& connDensity,
@@ -1039,7 +1052,7 @@ accumulateLocalContributions(const Sources&             sources,
         // F1 < 0 => pore-volume weighting of individual cell contributions,
         // no weighting when commiting term.
 
-        this->accumulateLocalContributions(sources, controls,
+        this->accumulateLocalContributions(controls,
                                            gravity, refDepth, connDensity,
                                            std::forward<ConnIndexMap>(connIndex),
                                            [](const auto& src)
@@ -1055,7 +1068,7 @@ accumulateLocalContributions(const Sources&             sources,
         // F1 >= 0 => unit weighting of individual cell contributions,
         // F1-weighting when committing term.
 
-        this->accumulateLocalContributions(sources, controls,
+        this->accumulateLocalContributions(controls,
                                            gravity, refDepth, connDensity,
                                            std::forward<ConnIndexMap>(connIndex),
                                            [](const auto&)
@@ -1065,15 +1078,14 @@ accumulateLocalContributions(const Sources&             sources,
 
 template<class Scalar>
 void PAvgCalculator<Scalar>::
-accumulateLocalContribOpen(const Sources&             sources,
-                           const PAvg&                controls,
+accumulateLocalContribOpen(const PAvg&                controls,
                            const Scalar               gravity,
                            const Scalar               refDepth,
                            const std::vector<Scalar>& connDensity)
 {
     assert (connDensity.size() == this->openConns_.size());
 
-    this->accumulateLocalContributions(sources, controls,
+    this->accumulateLocalContributions(controls,
                                        gravity, refDepth, connDensity,
                                        [this](const auto i)
                                        { return this->openConns_[i]; });
@@ -1081,15 +1093,14 @@ accumulateLocalContribOpen(const Sources&             sources,
 
 template<class Scalar>
 void PAvgCalculator<Scalar>::
-accumulateLocalContribAll(const Sources&             sources,
-                          const PAvg&                controls,
+accumulateLocalContribAll(const PAvg&                controls,
                           const Scalar               gravity,
                           const Scalar               refDepth,
                           const std::vector<Scalar>& connDensity)
 {
     assert (connDensity.size() == this->connections_.size());
 
-    this->accumulateLocalContributions(sources, controls,
+    this->accumulateLocalContributions(controls,
                                        gravity, refDepth, connDensity,
                                        [](const auto i) { return i; });
 }
@@ -1119,7 +1130,6 @@ template<class Scalar>
 template <typename ConnIndexMap>
 std::vector<Scalar> PAvgCalculator<Scalar>::
 connectionDensityRes(const std::size_t nconn,
-                     const Sources&    sources,
                      ConnIndexMap      connIndex) const
 {
     auto connDensity = std::vector<Scalar>(nconn);
@@ -1131,12 +1141,12 @@ connectionDensityRes(const std::size_t nconn,
 
     auto density = WeightedRunningAverage<Scalar, Scalar>{};
 
-    auto includeDensity = [this, &sources, &density](const ContrIndexType i)
+    auto includeDensity = [this, &density](const ContrIndexType i)
     {
         using Item = typename PAvgDynamicSourceData<Scalar>::
             template SourceDataSpan<const Scalar>::Item;
 
-        const auto src = sources.wellBlocks()[this->contributingCells_[i]];
+        const auto src = this->cellSources_[i];
 
         density.add(src[Item::MixtureDensity], src[Item::PoreVol]);
     };
@@ -1184,11 +1194,11 @@ connectionDensity(const Sources& sources,
 
     if (controls.depth_correction() == PAvg::DepthCorrection::RES) {
         if (! controls.open_connections()) {
-            return this->connectionDensityRes(nconn, sources,
+            return this->connectionDensityRes(nconn,
                                               [](const auto i) { return i; });
         }
 
-        return this->connectionDensityRes(nconn, sources,
+        return this->connectionDensityRes(nconn,
                                           [this](const auto i)
                                           { return this->openConns_[i]; });
     }
@@ -20,6 +20,8 @@
 #ifndef PAVG_CALCULATOR_HPP
 #define PAVG_CALCULATOR_HPP
 
+#include <opm/input/eclipse/Schedule/Well/PAvgDynamicSourceData.hpp>
+
 #include <array>
 #include <cstddef>
 #include <functional>
@@ -35,7 +37,7 @@ namespace Opm {
 class Connection;
 class GridDims;
 class PAvg;
-template<class Scalar> class PAvgDynamicSourceData;
+template<class Scalar> class PAvgCalculatorCollection;
 class WellConnections;
 
 } // namespace Opm
@@ -392,6 +394,10 @@ protected:
     Accumulator accumPV_{};
 
 private:
+    /// Collections evaluate the individual stages of
+    /// inferBlockAveragePressures() for multiple wells at once.
+    friend class PAvgCalculatorCollection<Scalar>;
+
     /// Type representing enumeration of locally contributing cells.
     using ContrIndexType = std::vector<std::size_t>::size_type;
 
@@ -477,6 +483,18 @@ private:
     /// Cached end result from \code inferBlockAveragePressures() \endcode.
     PAvgCalculatorResult<Scalar> averagePressures_{};
 
+    /// Cell-level source terms for each of the \c contributingCells_.
+    ///
+    /// Resolved once at the start of each accumulation since each cell
+    /// typically contributes to several connections.  Valid only during
+    /// accumulateLocalContributions().  Capacity reused across calls.
+    std::vector<typename PAvgDynamicSourceData<Scalar>::
+                template SourceDataSpan<const Scalar>> cellSources_{};
+
+    /// Per-connection contributions to CTF-weighted sum.  Scratch space
+    /// for accumulateLocalContributions(), reused across calls.
+    Accumulator accumCTF_c_{};
+
     /// Include reservoir connection and all direction-dependent level 1 and
     /// level 2 neighbours of connection's connecting cell into known cell
     /// set.
@@ -506,6 +524,13 @@ private:
     ///   the active status of \code allWBPCells()[i] \endcode.
     void pruneInactiveConnections(const std::vector<bool>& isActive);
 
+    /// Look up cell-level source terms for all contributing cells.
+    ///
+    /// Writes to \c cellSources_.
+    ///
+    /// \param[in] sources Connection and cell-level raw data.
+    void resolveCellSources(const Sources& sources);
+
     /// Top-level entry point for accumulating local WBP contributions.
     ///
     /// Will dispatch to lower-level entry points depending on control's
@@ -635,7 +660,7 @@ private:
     ///   if the weighting factor F1 in WPAVE is negative, or a lambda that
     ///   just returns the number one (1.0) otherwise.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
+    /// Reads cell-level source terms from \c cellSources_.
     ///
     /// \param[in] controls Averaging procedure controls.
     ///
@@ -654,8 +679,7 @@ private:
     /// \param[in] ctfPressWeight Pressure weighting method for CTF term's
     ///   individual contributions.
     template <typename ConnIndexMap, typename CTFPressureWeightFunction>
-    void accumulateLocalContributions(const Sources&             sources,
-                                      const PAvg&                controls,
+    void accumulateLocalContributions(const PAvg&                controls,
                                       const Scalar               gravity,
                                       const Scalar               refDepth,
                                       const std::vector<Scalar>& connDensity,
@@ -684,8 +708,6 @@ private:
     ///   identity mapping \code [](i){return i} \endcode or the open
     ///   connection mapping \code [](i){return openConns_[i]} \endcode.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] gravity Strength of gravity in SI units [m/s^2].
@@ -700,8 +722,7 @@ private:
     /// \param[in] connIndex Translation method from active connection index
     ///   to index into all known reservoir connections.
     template <typename ConnIndexMap>
-    void accumulateLocalContributions(const Sources&             sources,
-                                      const PAvg&                controls,
+    void accumulateLocalContributions(const PAvg&                controls,
                                       const Scalar               gravity,
                                       const Scalar               refDepth,
                                       const std::vector<Scalar>& connDensity,
@@ -712,8 +733,6 @@ private:
     ///
     /// Invokes final dispatch level on set of open connections only.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] gravity Strength of gravity in SI units [m/s^2].
@@ -724,8 +743,7 @@ private:
     ///
     /// \param[in] connDensity Mixture density for pressure correction term
     ///   for each reservoir connection.
-    void accumulateLocalContribOpen(const Sources&             sources,
-                                    const PAvg&                controls,
+    void accumulateLocalContribOpen(const PAvg&                controls,
                                     const Scalar               gravity,
                                     const Scalar               refDepth,
                                     const std::vector<Scalar>& connDP);
@@ -735,8 +753,6 @@ private:
     ///
     /// Invokes final dispatch level on set of all known connections.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] gravity Strength of gravity in SI units [m/s^2].
@@ -747,8 +763,7 @@ private:
     ///
     /// \param[in] connDensity Mixture density for pressure correction term
     ///   for each reservoir connection.
-    void accumulateLocalContribAll(const Sources&             sources,
-                                   const PAvg&                controls,
+    void accumulateLocalContribAll(const PAvg&                controls,
                                    const Scalar               gravity,
                                    const Scalar               refDepth,
                                    const std::vector<Scalar>& connDensity);
@@ -801,9 +816,9 @@ private:
     ///   identity mapping \code [](i){return i} \endcode or the open
     ///   connection mapping \code [](i){return openConns_[i]} \endcode.
     ///
-    /// \param[in] nconn Number of elements in active connection subset.
+    /// Reads cell-level source terms from \c cellSources_.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
+    /// \param[in] nconn Number of elements in active connection subset.
     ///
     /// \param[in] connIndex Translation method from active connection index
     ///   to index into all known reservoir connections.
@@ -813,7 +828,6 @@ private:
     template <typename ConnIndexMap>
     std::vector<Scalar>
     connectionDensityRes(const std::size_t nconn,
-                         const Sources&    sources,
                          ConnIndexMap      connIndex) const;
 
     /// Top-level entry point for computing connection level mixture
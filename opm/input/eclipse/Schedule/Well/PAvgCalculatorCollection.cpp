@@ -19,6 +19,9 @@
 
 #include <opm/input/eclipse/Schedule/Well/PAvgCalculatorCollection.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
+#include <opm/input/eclipse/Schedule/Well/PAvg.hpp>
 #include <opm/input/eclipse/Schedule/Well/PAvgCalculator.hpp>
 
 #include <algorithm>
@@ -83,6 +86,56 @@ pruneInactiveWBPCells(ActivePredicate isActive)
     }
 }
 
+template<class Scalar>
+void PAvgCalculatorCollection<Scalar>::
+inferBlockAveragePressures(const std::vector<Request>& requests,
+                           const Scalar                gravity)
+{
+    // Requests are processed concurrently, so two requests for the same
+    // calculation object would race on that object's accumulators.
+    auto requested = std::vector<bool>(this->calculators_.size(), false);
+    for (const auto& req : requests) {
+        if (req.calcIndex >= requested.size()) {
+            throw std::invalid_argument {
+                fmt::format("WBPn calculation object index {} out of "
+                            "bounds [0, {})", req.calcIndex, requested.size())
+            };
+        }
+
+        if (requested[req.calcIndex]) {
+            throw std::invalid_argument {
+                fmt::format("WBPn calculation object {} requested "
+                            "more than once", req.calcIndex)
+            };
+        }
+
+        requested[req.calcIndex] = true;
+    }
+
+    // 1) Local contributions.  Each calculator writes to its own
+    // accumulators only, so the requests are independent.
+    utility::parallelFor(requests.size(), [this, &requests, gravity](const std::size_t i)
+    {
+        const auto& req = requests[i];
+
+        this->calculators_[req.calcIndex]->
+            accumulateLocalContributions(req.sources, *req.controls,
+                                         gravity, req.refDepth);
+    });
+
+    // 2) Global contributions.  Might be collective operations in
+    // MPI-aware calculators, so these must happen in the same order on
+    // all ranks.
+    for (const auto& req : requests) {
+        this->calculators_[req.calcIndex]->collectGlobalContributions();
+    }
+
+    // 3) Final results.
+    for (const auto& req : requests) {
+        this->calculators_[req.calcIndex]->assignResults(*req.controls);
+    }
+}
+
 template<class Scalar>
 PAvgCalculator<Scalar>&
 PAvgCalculatorCollection<Scalar>::operator[](const std::size_t i)
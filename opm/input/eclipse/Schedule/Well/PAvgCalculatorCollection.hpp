@@ -20,6 +20,8 @@
 #ifndef PAVE_CALC_COLLECTIONHPP
 #define PAVE_CALC_COLLECTIONHPP
 
+#include <opm/input/eclipse/Schedule/Well/PAvgCalculator.hpp>
+
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -27,7 +29,7 @@
 #include <vector>
 
 namespace Opm {
-    template<class Scalar> class PAvgCalculator;
+    class PAvg;
 } // namespace Opm
 
 namespace Opm {
@@ -56,6 +58,25 @@ public:
     using ActivePredicate = std::function<
         std::vector<bool>(const std::vector<std::size_t>&)>;
 
+    /// Input to block-average pressure calculation for a single WBPn
+    /// calculation object.
+    struct Request
+    {
+        /// WBPn calculation object index.  Must be one returned from a
+        /// previous call to \c setCalculator.
+        std::size_t calcIndex{};
+
+        /// Connection and cell-level raw data.
+        typename PAvgCalculator<Scalar>::Sources sources{};
+
+        /// Averaging procedure controls.  Typically the well's WPAVE
+        /// settings.
+        const PAvg* controls{nullptr};
+
+        /// Well's reference depth for block-average pressure calculation.
+        Scalar refDepth{};
+    };
+
     /// Default constructor.
     PAvgCalculatorCollection() = default;
 
@@ -97,6 +118,23 @@ public:
     ///   abide by the protocol outlined above.
     void pruneInactiveWBPCells(ActivePredicate isActive);
 
+    /// Compute block-average pressures for multiple WBPn calculation
+    /// objects.
+    ///
+    /// Same results as calling \code inferBlockAveragePressures()
+    /// \endcode on each calculation object in turn, but accumulates local
+    /// contributions for all objects in parallel when OpenMP is enabled.
+    /// Global contributions, which may involve collective communication,
+    /// are collected sequentially in request order.
+    ///
+    /// \param[in] requests Calculation inputs.  Each calculation object
+    ///   may appear at most once.  Throws \c std::invalid_argument if an
+    ///   object appears more than once or if an index is out of bounds.
+    ///
+    /// \param[in] gravity Strength of gravity in SI units [m/s^2].
+    void inferBlockAveragePressures(const std::vector<Request>& requests,
+                                    const Scalar                gravity);
+
     /// Access mutable WBPn calculation object.
     ///
     /// \param[in] i WBPn calculation object index.  Must be one returned
@@ -0,0 +1,278 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/ArrayIndex.hpp>
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <system_error>
+
+namespace {
+
+    static_assert(sizeof(Opm::EclIO::ArrayIndexEntry) == 48,
+                  "Array index entries must have a fixed layout");
+
+    constexpr char magic[8] = { 'O', 'P', 'M', 'A', 'R', 'I', 'D', 'X' };
+    constexpr std::uint64_t version = 2;
+
+    // Sidecar layout
+    //
+    //   char[8]   magic
+    //   uint64    format version
+    //   uint64    size of the ECL file in bytes
+    //   int64     last modification time of the ECL file
+    //   uint64    number of entries
+    //
+    // followed by the entries.
+    struct Header
+    {
+        std::uint64_t version;
+        std::uint64_t fileSize;
+        std::int64_t modified;
+        std::uint64_t count;
+    };
+
+    // Last modification time of 'filename' in ticks of the file clock, or
+    // nullopt if it cannot be determined.
+    std::optional<std::int64_t> modificationTime(const std::string& filename)
+    {
+        std::error_code ec;
+        const auto mtime = std::filesystem::last_write_time(filename, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+
+        return static_cast<std::int64_t>(mtime.time_since_epoch().count());
+    }
+
+    bool consistent(const std::vector<Opm::EclIO::ArrayIndexEntry>& entries,
+                    const std::uint64_t                              fileSize)
+    {
+        auto position = std::uint64_t{0};
+
+        for (const auto& entry : entries) {
+            if ((entry.headerPosition < position) ||
+                (entry.dataPosition <= entry.headerPosition) ||
+                (entry.dataPosition > fileSize) ||
+                (entry.size < 0) ||
+                (entry.type < Opm::EclIO::INTE) || (entry.type > Opm::EclIO::C0NN))
+            {
+                return false;
+            }
+
+            position = entry.dataPosition;
+        }
+
+        return true;
+    }
+
+    // Whether or not the file holds the array described by 'entry' at the
+    // recorded position.  A sidecar which matches the size of the file may
+    // still be stale, e.g., if the file has been rewritten by a tool which
+    // does not maintain the sidecar.
+    bool matchesFile(const std::string&                 filename,
+                     const bool                         formatted,
+                     const Opm::EclIO::ArrayIndexEntry& entry)
+    {
+        std::fstream fileH(filename, formatted ? std::ios::in : (std::ios::in | std::ios::binary));
+        if (! fileH) {
+            return false;
+        }
+
+        fileH.seekg(static_cast<std::streamoff>(entry.headerPosition), std::ios_base::beg);
+
+        std::string name(8, ' ');
+        std::int64_t num = 0;
+        Opm::EclIO::eclArrType type;
+        int elementSize = 0;
+
+        try {
+            if (formatted) {
+                Opm::EclIO::readFormattedHeader(fileH, name, num, type, elementSize);
+            } else {
+                Opm::EclIO::readBinaryHeader(fileH, name, num, type, elementSize);
+            }
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+
+        return (Opm::EclIO::trimr(name) == entry.arrayName())
+            && (type == entry.type) && (num == entry.size)
+            && (elementSize == entry.elementSize)
+            && (static_cast<std::uint64_t>(std::streamoff(fileH.tellg())) == entry.dataPosition);
+    }
+
+    // Write sidecar to a temporary file which is then renamed, whence
+    // concurrent readers never observe a partially written sidecar.
+    void writeSidecar(const std::string&                              target,
+                      const Header&                                   header,
+                      const std::vector<Opm::EclIO::ArrayIndexEntry>& entries)
+    {
+        const auto tmp = target + '.' + std::to_string(std::random_device{}());
+
+        {
+            std::ofstream os(tmp, std::ios::binary);
+            if (! os) {
+                return;
+            }
+
+            os.write(magic, sizeof magic);
+            os.write(reinterpret_cast<const char*>(&header), sizeof header);
+            os.write(reinterpret_cast<const char*>(entries.data()),
+                     static_cast<std::streamsize>(entries.size() * sizeof(Opm::EclIO::ArrayIndexEntry)));
+
+            if (! os.flush()) {
+                os.close();
+                std::error_code ec;
+                std::filesystem::remove(tmp, ec);
+                return;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tmp, target, ec);
+        if (ec) {
+            std::filesystem::remove(tmp, ec);
+        }
+    }
+
+} // Anonymous namespace
+
+std::string Opm::EclIO::ArrayIndexEntry::arrayName() const
+{
+    auto arrName = std::string(this->name, sizeof this->name);
+    arrName.erase(arrName.find_last_not_of(' ') + 1);
+
+    return arrName;
+}
+
+void Opm::EclIO::ArrayIndexEntry::setArrayName(const std::string& arrName)
+{
+    std::fill(std::begin(this->name), std::end(this->name), ' ');
+    std::copy_n(arrName.begin(), std::min(arrName.size(), sizeof this->name), this->name);
+}
+
+std::string Opm::EclIO::arrayIndexFilename(const std::string& filename)
+{
+    return filename + ".ARRIDX";
+}
+
+std::optional<std::vector<Opm::EclIO::ArrayIndexEntry>>
+Opm::EclIO::readArrayIndex(const std::string&  filename,
+                           const std::uint64_t fileSize,
+                           const bool          formatted)
+{
+    const auto sidecar = arrayIndexFilename(filename);
+
+    std::error_code ec;
+    const auto sidecarSize = std::filesystem::file_size(sidecar, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    std::ifstream is(sidecar, std::ios::binary);
+    if (! is) {
+        return std::nullopt;
+    }
+
+    char fileMagic[sizeof magic] {};
+    Header header {};
+
+    is.read(fileMagic, sizeof fileMagic);
+    is.read(reinterpret_cast<char*>(&header), sizeof header);
+
+    if (!is || (std::memcmp(fileMagic, magic, sizeof magic) != 0) ||
+        (header.version != version) || (header.fileSize < fileSize) ||
+        (sidecarSize < sizeof magic + sizeof header) ||
+        (header.count > (sidecarSize - sizeof magic - sizeof header) / sizeof(ArrayIndexEntry)) ||
+        (sidecarSize != sizeof magic + sizeof header + header.count * sizeof(ArrayIndexEntry)))
+    {
+        return std::nullopt;
+    }
+
+    // A file of unchanged size must also be unchanged since the sidecar
+    // was written.  This rejects sidecars of files which have been
+    // rewritten in place, or replaced by a different file of equal size.
+    // Truncating a file always updates its modification time, so a
+    // truncated file is validated by its array headers below.
+    if (header.fileSize == fileSize) {
+        const auto modified = modificationTime(filename);
+        if (! modified.has_value() || (*modified != header.modified)) {
+            return std::nullopt;
+        }
+    }
+
+    std::vector<ArrayIndexEntry> entries(header.count);
+    is.read(reinterpret_cast<char*>(entries.data()),
+            static_cast<std::streamsize>(entries.size() * sizeof(ArrayIndexEntry)));
+
+    if (!is || !consistent(entries, header.fileSize)) {
+        return std::nullopt;
+    }
+
+    if (header.fileSize > fileSize) {
+        // File truncated since the sidecar was written.  Usable only if
+        // the file now ends where one of the arrays started.
+        auto end = std::find_if(entries.begin(), entries.end(),
+                                [fileSize](const ArrayIndexEntry& entry)
+                                { return entry.headerPosition >= fileSize; });
+
+        if ((end == entries.end()) || (end->headerPosition != fileSize)) {
+            return std::nullopt;
+        }
+
+        entries.erase(end, entries.end());
+    }
+
+    if (! entries.empty() &&
+        (! matchesFile(filename, formatted, entries.front()) ||
+         ! matchesFile(filename, formatted, entries.back())))
+    {
+        return std::nullopt;
+    }
+
+    return entries;
+}
+
+void Opm::EclIO::writeArrayIndex(const std::string&                  filename,
+                                 const std::uint64_t                 fileSize,
+                                 const std::vector<ArrayIndexEntry>& entries) noexcept
+{
+    try {
+        const auto modified = modificationTime(filename);
+        if (! modified.has_value()) {
+            return;
+        }
+
+        writeSidecar(arrayIndexFilename(filename),
+                     Header { version, fileSize, *modified, entries.size() },
+                     entries);
+    }
+    catch (...) {
+        // Sidecar is optional
+    }
+}
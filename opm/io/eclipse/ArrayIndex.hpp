@@ -0,0 +1,116 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_ARRAY_INDEX_HPP_INCLUDED
+#define OPM_IO_ARRAY_INDEX_HPP_INCLUDED
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Location and description of a single array of an ECL file.
+///
+/// The array index sidecar <filename>.ARRIDX holds one such entry for
+/// every array of the file, in file order, which spares readers of large
+/// unified files the scan over all array headers.  The sidecar is a cache
+/// which is written in native byte order.  It is only used while the size
+/// and the modification time of the file match those recorded in the
+/// sidecar, and the headers of the first and last arrays of the file match
+/// their entries.  Copying a file without preserving its modification time
+/// therefore invalidates its sidecar.
+struct ArrayIndexEntry
+{
+    /// File position of the array header.
+    std::uint64_t headerPosition{0};
+
+    /// File position of the array data, i.e., just past the header.
+    std::uint64_t dataPosition{0};
+
+    /// Number of elements.
+    std::int64_t size{0};
+
+    /// Element type, an eclArrType value.
+    std::int32_t type{0};
+
+    /// Size of a single element in bytes.
+    std::int32_t elementSize{0};
+
+    /// SEQNUM value of the report step the array belongs to, or -1 in
+    /// files without report steps.  For SEQNUM arrays this is the array's
+    /// value.
+    std::int32_t reportStep{-1};
+
+    /// Array name, padded with blanks.
+    char name[8]{};
+
+    std::int32_t reserved{0};
+
+    /// Array name without trailing blanks.
+    std::string arrayName() const;
+
+    /// Assign array name.  Names longer than eight characters are
+    /// truncated.
+    void setArrayName(const std::string& arrName);
+};
+
+/// Name of the array index sidecar of \p filename.
+std::string arrayIndexFilename(const std::string& filename);
+
+/// Read the array index sidecar of an ECL file.
+///
+/// \param[in] filename Name of the ECL file, not of the sidecar.
+///
+/// \param[in] fileSize Current size of the ECL file in bytes.
+///
+/// \param[in] formatted Whether or not the ECL file is formatted.
+///
+/// \return Index entries of all arrays which the file holds.  If the
+///    file has been truncated at the start of an array since the sidecar
+///    was written, e.g., when a unified restart file is rewritten from a
+///    particular report step, the entries of the remaining arrays.
+///    Nullopt if there is no sidecar or if it does not describe the file.
+std::optional<std::vector<ArrayIndexEntry>>
+readArrayIndex(const std::string& filename,
+               std::uint64_t      fileSize,
+               bool               formatted);
+
+/// Write the array index sidecar of an ECL file.
+///
+/// The sidecar is only a cache, so failures are not reported and no
+/// exceptions are thrown, which makes this safe to call from destructors.
+/// The sidecar records the current modification time of the file, so call
+/// this only once all output to the file is complete.  It is
+/// written to a temporary file which is then renamed, whence concurrent
+/// readers never observe a partially written sidecar.
+///
+/// \param[in] filename Name of the ECL file, not of the sidecar.
+///
+/// \param[in] fileSize Size of the ECL file in bytes.
+///
+/// \param[in] entries Index entries of all arrays of the file.
+void writeArrayIndex(const std::string&                  filename,
+                     std::uint64_t                       fileSize,
+                     const std::vector<ArrayIndexEntry>& entries) noexcept;
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ARRAY_INDEX_HPP_INCLUDED
@@ -0,0 +1,137 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/AsyncWriter.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+Opm::EclIO::AsyncWriter::AsyncWriter(const std::size_t maxPendingBytes)
+    : maxPendingBytes_{ maxPendingBytes }
+{
+    this->thread_ = std::thread { [this]() { this->run(); } };
+}
+
+Opm::EclIO::AsyncWriter::~AsyncWriter()
+{
+    {
+        std::lock_guard<std::mutex> guard { this->lock_ };
+        this->stop_ = true;
+    }
+
+    this->jobAvailable_.notify_one();
+    this->thread_.join();
+}
+
+void Opm::EclIO::AsyncWriter::submit(Task task, const std::size_t size)
+{
+    {
+        std::unique_lock<std::mutex> guard { this->lock_ };
+
+        this->jobCompleted_.wait(guard, [size, this]()
+        {
+            return (this->pendingBytes_ == 0)
+                || (this->pendingBytes_ + size <= this->maxPendingBytes_);
+        });
+
+        this->queue_.push_back(Job { std::move(task), size });
+        this->pendingBytes_ += size;
+    }
+
+    this->jobAvailable_.notify_one();
+}
+
+void Opm::EclIO::AsyncWriter::fence()
+{
+    auto error = std::exception_ptr{};
+
+    {
+        std::unique_lock<std::mutex> guard { this->lock_ };
+
+        this->jobCompleted_.wait(guard, [this]()
+        {
+            return this->queue_.empty() && ! this->busy_;
+        });
+
+        std::swap(error, this->error_);
+    }
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+std::size_t Opm::EclIO::AsyncWriter::pendingBytes() const
+{
+    std::lock_guard<std::mutex> guard { this->lock_ };
+    return this->pendingBytes_;
+}
+
+void Opm::EclIO::AsyncWriter::run()
+{
+    while (true) {
+        auto job = Job{};
+        auto discard = false;
+
+        {
+            std::unique_lock<std::mutex> guard { this->lock_ };
+
+            this->jobAvailable_.wait(guard, [this]()
+            {
+                return this->stop_ || ! this->queue_.empty();
+            });
+
+            if (this->queue_.empty()) {
+                // Stop requested and no remaining work.
+                return;
+            }
+
+            job = std::move(this->queue_.front());
+            this->queue_.pop_front();
+
+            this->busy_ = true;
+            discard = this->error_ != nullptr;
+        }
+
+        if (! discard) {
+            try {
+                job.task();
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> guard { this->lock_ };
+                this->error_ = std::current_exception();
+            }
+        }
+
+        // Release the job's resources, e.g., by closing its file, before
+        // reporting completion.
+        job.task = nullptr;
+
+        {
+            std::lock_guard<std::mutex> guard { this->lock_ };
+            this->pendingBytes_ -= job.size;
+            this->busy_ = false;
+        }
+
+        this->jobCompleted_.notify_all();
+    }
+}
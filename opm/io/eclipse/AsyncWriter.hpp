@@ -0,0 +1,138 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_ASYNC_WRITER_HPP_INCLUDED
+#define OPM_IO_ASYNC_WRITER_HPP_INCLUDED
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Opm { namespace EclIO {
+
+/// Background output thread for ECL result files.
+///
+/// Runs output tasks, typically writing an already encoded byte buffer to
+/// an open file, on a dedicated thread in the order in which the tasks
+/// were submitted.  Since all tasks share a single thread, the contents of
+/// every file, and the relative order of operations across files, are
+/// identical to those of synchronous output.
+///
+/// The amount of submitted but not yet written data is bounded.  Callers
+/// of submit() block while the limit is exceeded.
+///
+/// Errors raised by a task are recorded and reported by the next call to
+/// fence().  Tasks submitted after a failed task are discarded until the
+/// error has been reported.
+class AsyncWriter
+{
+public:
+    /// Output task.  Runs on the background thread.
+    using Task = std::function<void()>;
+
+    /// Constructor.
+    ///
+    /// Launches background thread.
+    ///
+    /// \param[in] maxPendingBytes Upper bound on total size of submitted
+    ///    but not yet completed tasks.  A single task exceeding this
+    ///    limit is accepted once all preceding tasks have completed.
+    explicit AsyncWriter(const std::size_t maxPendingBytes = std::size_t{1} << 28);
+
+    /// Destructor.
+    ///
+    /// Completes all pending tasks before terminating the background
+    /// thread.  Unreported errors are discarded.  Call fence() prior to
+    /// destruction if error reporting is required.
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter& rhs) = delete;
+    AsyncWriter(AsyncWriter&& rhs) = delete;
+
+    AsyncWriter& operator=(const AsyncWriter& rhs) = delete;
+    AsyncWriter& operator=(AsyncWriter&& rhs) = delete;
+
+    /// Enqueue output task.
+    ///
+    /// \param[in] task Output operation.  Must own, or share ownership
+    ///    of, all resources it references.
+    ///
+    /// \param[in] size Number of bytes held by \p task.  Counts towards
+    ///    the pending data limit until \p task has completed.
+    void submit(Task task, const std::size_t size);
+
+    /// Block until all submitted tasks have completed.
+    ///
+    /// Throws the first exception raised by any task since the previous
+    /// call to fence().
+    void fence();
+
+    /// Number of bytes held by submitted but not yet completed tasks.
+    std::size_t pendingBytes() const;
+
+private:
+    /// Enqueued output task and its size in bytes.
+    struct Job
+    {
+        Task task{};
+        std::size_t size{};
+    };
+
+    /// Upper bound on total size of pending jobs.
+    std::size_t maxPendingBytes_{};
+
+    /// Protects all mutable state below.
+    mutable std::mutex lock_{};
+
+    /// Signalled when a job is enqueued or the thread must stop.
+    std::condition_variable jobAvailable_{};
+
+    /// Signalled when a job has completed.
+    std::condition_variable jobCompleted_{};
+
+    /// Jobs not yet started, in submission order.
+    std::deque<Job> queue_{};
+
+    /// Total size of pending jobs, including the currently running job.
+    std::size_t pendingBytes_{0};
+
+    /// Whether or not the background thread is running a job.
+    bool busy_{false};
+
+    /// Whether or not the background thread should terminate once the
+    /// queue is empty.
+    bool stop_{false};
+
+    /// First unreported error raised by a job.
+    std::exception_ptr error_{};
+
+    /// Background thread.
+    std::thread thread_{};
+
+    /// Main loop of background thread.
+    void run();
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ASYNC_WRITER_HPP_INCLUDED
@@ -18,15 +18,26 @@
 
 #include <opm/io/eclipse/ERst.hpp>
 
+#include <opm/io/eclipse/ArrayIndex.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
-#include <cstring>
+#include <cstdint>
 #include <exception>
+#include <filesystem>
+#include <fstream>
 #include <iterator>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
 
 
 namespace {
@@ -46,6 +57,46 @@ namespace {
             "From Restart Filename \"" + filename + '"'
         };
     }
+
+    bool isUnifiedFilename(const std::string& filename)
+    {
+        const auto re = std::regex {
+            R"~(\.F?UNRST$)~", std::regex::icase
+        };
+
+        return std::regex_search(filename, re);
+    }
+
+    bool isSeqnumHeader(const std::string& filename,
+                        const bool formatted,
+                        const std::uint64_t pos)
+    {
+        std::fstream fileH(filename, formatted ? std::ios::in : (std::ios::in | std::ios::binary));
+        if (!fileH) {
+            return false;
+        }
+
+        fileH.seekg(static_cast<std::streamoff>(pos), std::ios_base::beg);
+
+        std::string name(8, ' ');
+        std::int64_t num = 0;
+        Opm::EclIO::eclArrType type;
+        int elementSize = 0;
+
+        try {
+            if (formatted) {
+                Opm::EclIO::readFormattedHeader(fileH, name, num, type, elementSize);
+            } else {
+                Opm::EclIO::readBinaryHeader(fileH, name, num, type, elementSize);
+            }
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+
+        return (Opm::EclIO::trimr(name) == "SEQNUM")
+            && (type == Opm::EclIO::INTE) && (num == 1);
+    }
 }
 
 
@@ -63,6 +114,156 @@ ERst::ERst(const std::string& filename)
 }
 
 
+ERst::ERst(const std::string& filename, const int reportStepNumber)
+    : EclFile(filename, ERst::reportStepArrays(filename, reportStepNumber))
+{
+    // The range is empty if a unified file does not have the report step
+    if (this->hasKey("SEQNUM") || isUnifiedFilename(filename)) {
+        this->initUnified();
+    }
+    else {
+        this->initSeparate(seqnumFromSeparateFilename(filename));
+    }
+}
+
+
+EclFile::ArrayRange
+ERst::reportStepArrays(const std::string& filename, const int number)
+{
+    if (!fileExists(filename))
+        throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
+
+    const auto formatted = isFormatted(filename);
+    const auto unified = isUnifiedFilename(filename);
+
+    std::error_code ec;
+    const std::uint64_t fileSize = std::filesystem::file_size(filename, ec);
+
+    auto entries = ec ? std::nullopt : readArrayIndex(filename, fileSize, formatted);
+    if (! entries.has_value()) {
+        // No usable sidecar.  Scan the array headers, but do not create
+        // the sidecar.  That is up to the writer of the file, or to an
+        // explicit call to EclFile::writeArrayIndex().
+        return ERst::scanReportStep(filename, formatted, unified, number);
+    }
+
+    if (! unified) {
+        return { std::move(*entries), fileSize };
+    }
+
+    const auto isSeqnum = [](const ArrayIndexEntry& entry)
+    {
+        return (entry.arrayName() == "SEQNUM")
+            && (entry.type == INTE) && (entry.size == 1);
+    };
+
+    const auto pos = std::find_if(entries->begin(), entries->end(),
+                                  [&isSeqnum, number](const ArrayIndexEntry& entry)
+                                  { return isSeqnum(entry) && (entry.reportStep == number); });
+
+    if (pos == entries->end()) {
+        return {};
+    }
+
+    if (! isSeqnumHeader(filename, formatted, pos->headerPosition)) {
+        // Sidecar does not describe the file
+        return ERst::scanReportStep(filename, formatted, unified, number);
+    }
+
+    const auto next = std::find_if(std::next(pos), entries->end(), isSeqnum);
+
+    return { std::vector<ArrayIndexEntry>(pos, next),
+             (next == entries->end()) ? fileSize : next->headerPosition };
+}
+
+
+EclFile::ArrayRange
+ERst::scanReportStep(const std::string& filename,
+                     const bool formatted,
+                     const bool unified,
+                     const int number)
+{
+    std::fstream fileH(filename, formatted ? std::ios::in : (std::ios::in | std::ios::binary));
+    if (!fileH)
+        throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
+
+    ArrayRange range;
+
+    // All arrays of a separate restart file belong to its report step
+    auto inStep = !unified;
+    int reportStep = -1;
+
+    while (!isEOF(&fileH)) {
+        const std::uint64_t headerPos = fileH.tellg();
+
+        std::string arrName(8,' ');
+        eclArrType arrType;
+        std::int64_t num;
+        int sizeOfElement;
+
+        try {
+            if (formatted) {
+                readFormattedHeader(fileH, arrName, num, arrType, sizeOfElement);
+            } else {
+                readBinaryHeader(fileH, arrName, num, arrType, sizeOfElement);
+            }
+        } catch (const std::exception& e) {
+            OPM_THROW(std::runtime_error,
+                fmt::format("Unable to read array header from {}: {} \nPlease check if the file is corrupt!", filename, e.what()));
+        }
+
+        const std::uint64_t dataPos = fileH.tellg();
+        const std::uint64_t sizeOfArray = formatted
+            ? sizeOnDiskFormatted(num, arrType, sizeOfElement)
+            : sizeOnDiskBinary(num, arrType, sizeOfElement);
+
+        if (unified && (trimr(arrName) == "SEQNUM") && (arrType == INTE) && (num == 1)) {
+            if (inStep) {
+                // First array of the next report step
+                range.end = headerPos;
+                return range;
+            }
+
+            if (formatted) {
+                std::string buffer(sizeOfArray, ' ');
+                fileH.read(buffer.data(), sizeOfArray);
+                reportStep = readFormattedInteArray(buffer, 1, 0).front();
+            } else {
+                reportStep = readBinaryInteArray(fileH, 1).front();
+            }
+
+            inStep = (reportStep == number);
+        }
+
+        if (inStep) {
+            auto& entry = range.arrays.emplace_back();
+
+            entry.headerPosition = headerPos;
+            entry.dataPosition = dataPos;
+            entry.size = num;
+            entry.type = arrType;
+            entry.elementSize = sizeOfElement;
+            entry.reportStep = reportStep;
+            entry.setArrayName(trimr(arrName));
+        }
+
+        fileH.clear();
+        fileH.seekg(static_cast<std::streamoff>(dataPos + sizeOfArray), std::ios_base::beg);
+    }
+
+    if (!inStep) {
+        // Unified file without the report step
+        return {};
+    }
+
+    fileH.clear();
+    fileH.seekg(0, std::ios_base::end);
+    range.end = static_cast<std::uint64_t>(fileH.tellg());
+
+    return range;
+}
+
+
 bool ERst::hasReportStepNumber(int number) const
 {
     auto search = arrIndexRange.find(number);
@@ -90,6 +291,32 @@ void ERst::loadReportStepNumber(int number)
 }
 
 
+void ERst::loadReportStepNumber(int number, const std::vector<std::string>& arrayNames)
+{
+    this->loadReportStepNumbers({ number }, arrayNames);
+}
+
+
+void ERst::loadReportStepNumbers(const std::vector<int>& numbers, const std::vector<std::string>& arrayNames)
+{
+    std::vector<int> arrayIndexList;
+
+    for (const auto& number : numbers) {
+        const auto [first, last] = this->getIndexRange(number);
+
+        for (int i = first; i < last; i++) {
+            if (!this->isLoaded(i) &&
+                (std::find(arrayNames.begin(), arrayNames.end(), array_name[i]) != arrayNames.end()))
+            {
+                arrayIndexList.push_back(i);
+            }
+        }
+    }
+
+    loadData(arrayIndexList);
+}
+
+
 std::vector<EclFile::EclEntry> ERst::listOfRstArrays(int reportStepNumber)
 {
     return this->listOfRstArrays(reportStepNumber, "global");
@@ -21,10 +21,12 @@
 
 #include <opm/io/eclipse/EclFile.hpp>
 
+#include <cstdint>
 #include <ios>
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 
@@ -39,12 +41,30 @@ class ERst : public EclFile
 public:
     explicit ERst(const std::string& filename);
 
+    // Only the arrays of report step 'reportStepNumber'.  In a unified
+    // restart file the position of the report step is taken from the
+    // array index sidecar <filename>.ARRIDX when it matches the restart
+    // file.  Otherwise the array headers of the restart file are scanned
+    // once, up to the end of the report step.
+    // The sidecar is never created here, see EclFile::writeArrayIndex().
+    // A report step which is not in the file is reported as missing by
+    // hasReportStepNumber().
+    ERst(const std::string& filename, int reportStepNumber);
+
     bool hasReportStepNumber(int number) const;
     bool hasArray(const std::string& name, int number) const;
     bool hasLGR(const std::string& gridname, int reportStepNumber) const;
 
     void loadReportStepNumber(int number);
 
+    // Load all occurrences of the named arrays in report step 'number',
+    // read and decoded in parallel.  Names which are not in the report
+    // step are ignored.
+    void loadReportStepNumber(int number, const std::vector<std::string>& arrayNames);
+
+    // As above, for all of the report steps 'numbers' in a single pass.
+    void loadReportStepNumbers(const std::vector<int>& numbers, const std::vector<std::string>& arrayNames);
+
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber)
     {
@@ -97,6 +117,15 @@ private:
     std::streampos
     restartStepWritePosition(const int seqnumValue) const;
 
+    // Arrays of report step 'number', from the array index sidecar if it
+    // is valid and otherwise from scanReportStep().
+    static ArrayRange reportStepArrays(const std::string& filename, int number);
+
+    // Single pass over the array headers from the start of the file which
+    // reads the SEQNUM values and stops at the report step after 'number'.
+    static ArrayRange scanReportStep(const std::string& filename, bool formatted,
+                                     bool unified, int number);
+
 };
 
 }} // namespace Opm::EclIO
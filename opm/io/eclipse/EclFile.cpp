@@ -17,16 +17,23 @@
    */
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/ArrayIndex.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/ParallelFor.hpp>
 
 #include <algorithm>
 #include <cstring>
 #include <cstddef>
+#include <exception>
+#include <filesystem>
 #include <fstream>
 #include <string>
 #include <numeric>
 #include <cmath>
+#include <system_error>
+#include <type_traits>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -44,8 +51,17 @@ void EclFile::load(bool preload) {
     if (!fileH)
         throw std::runtime_error(fmt::format("Can not open EclFile: {}", this->inputFilename));
 
+    if (this->loadArrayIndex()) {
+        if (preload)
+            this->loadData();
+
+        return;
+    }
+
     int n = 0;
     while (!isEOF(&fileH)) {
+        const std::uint64_t headerPos = fileH.tellg();
+
         std::string arrName(8,' ');
         eclArrType arrType;
         std::int64_t num;
@@ -62,6 +78,8 @@ void EclFile::load(bool preload) {
                 fmt::format("Unable to read array header from {}: {} \nPlease check if the file is corrupt!", this->inputFilename, e.what()));
         }
 
+        std::uint64_t pos = fileH.tellg();
+
         array_size.push_back(num);
         array_type.push_back(arrType);
         array_name.push_back(trimr(arrName));
@@ -69,7 +87,7 @@ void EclFile::load(bool preload) {
 
         array_index[array_name[n]] = n;
 
-        std::uint64_t pos = fileH.tellg();
+        headerStreamPos.push_back(headerPos);
         ifStreamPos.push_back(pos);
 
         arrayLoaded.push_back(false);
@@ -87,8 +105,10 @@ void EclFile::load(bool preload) {
         n++;
     };
 
+    fileH.clear();
     fileH.seekg(0, std::ios_base::end);
     this->ifStreamPos.push_back(static_cast<std::uint64_t>(fileH.tellg()));
+
     fileH.close();
 
     if (preload)
@@ -96,6 +116,57 @@ void EclFile::load(bool preload) {
 }
 
 
+bool EclFile::loadArrayIndex()
+{
+    std::error_code ec;
+    const std::uint64_t fileSize = std::filesystem::file_size(this->inputFilename, ec);
+    if (ec) {
+        return false;
+    }
+
+    const auto entries = readArrayIndex(this->inputFilename, fileSize, this->formatted);
+    if (! entries.has_value()) {
+        return false;
+    }
+
+    this->assignArrays(*entries, fileSize);
+
+    return true;
+}
+
+
+void EclFile::assignArrays(const std::vector<ArrayIndexEntry>& entries,
+                           const std::uint64_t end)
+{
+    int n = 0;
+    for (const auto& entry : entries) {
+        array_size.push_back(entry.size);
+        array_type.push_back(static_cast<eclArrType>(entry.type));
+        array_name.push_back(entry.arrayName());
+        array_element_size.push_back(entry.elementSize);
+
+        array_index[array_name[n]] = n;
+
+        headerStreamPos.push_back(entry.headerPosition);
+        ifStreamPos.push_back(entry.dataPosition);
+
+        // The index holds the values of the SEQNUM arrays
+        const auto isSeqnum = (array_name[n] == "SEQNUM") &&
+            (entry.type == INTE) && (entry.size == 1) && (entry.reportStep >= 0);
+
+        if (isSeqnum) {
+            inte_array[n] = { entry.reportStep };
+        }
+
+        arrayLoaded.push_back(isSeqnum);
+
+        n++;
+    }
+
+    this->ifStreamPos.push_back(end);
+}
+
+
 EclFile::EclFile(const std::string& filename, EclFile::Formatted fmt, bool preload) :
     formatted(fmt.value),
     inputFilename(filename)
@@ -115,67 +186,91 @@ EclFile::EclFile(const std::string& filename, bool preload) :
 }
 
 
-void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
+EclFile::EclFile(const std::string& filename, const ArrayRange& range) :
+    formatted(isFormatted(filename)),
+    inputFilename(filename)
+{
+    this->assignArrays(range.arrays, range.end);
+}
+
+
+EclFile::ArrayData EclFile::readArray(std::fstream& fileH, std::size_t arrIndex) const
 {
+    // A formatted read of the last array may stop at the end of the file
+    fileH.clear();
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
+    if (formatted) {
+        std::size_t disk_size = sizeOnDiskFormatted(array_size[arrIndex],
+                                                    array_type[arrIndex],
+                                                    array_element_size[arrIndex]) + 1;
+        std::vector<char> buffer(disk_size);
+        fileH.read (buffer.data(), disk_size);
+
+        const std::string fileStr = std::string(buffer.data(), disk_size);
+
+        switch (array_type[arrIndex]) {
+        case INTE:
+            return readFormattedInteArray(fileStr, array_size[arrIndex], 0);
+        case REAL:
+            return readFormattedRealArray(fileStr, array_size[arrIndex], 0);
+        case DOUB:
+            return readFormattedDoubArray(fileStr, array_size[arrIndex], 0);
+        case LOGI:
+            return readFormattedLogiArray(fileStr, array_size[arrIndex], 0);
+        case CHAR:
+            return readFormattedCharArray(fileStr, array_size[arrIndex], 0, sizeOfChar);
+        case C0NN:
+            return readFormattedCharArray(fileStr, array_size[arrIndex], 0, array_element_size[arrIndex]);
+        case MESS:
+            return {};
+        default:
+            OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
+        }
+    }
+
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryInteArray(fileH, array_size[arrIndex]);
     case REAL:
-        real_array[arrIndex] = readBinaryRealArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryRealArray(fileH, array_size[arrIndex]);
     case DOUB:
-        doub_array[arrIndex] = readBinaryDoubArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryDoubArray(fileH, array_size[arrIndex]);
     case LOGI:
-        logi_array[arrIndex] = readBinaryLogiArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryLogiArray(fileH, array_size[arrIndex]);
     case CHAR:
-        char_array[arrIndex] = readBinaryCharArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryCharArray(fileH, array_size[arrIndex]);
     case C0NN:
-        char_array[arrIndex] = readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]);
-        break;
+        return readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]);
     case MESS:
-        break;
+        return {};
     default:
         OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
-        break;
     }
-
-    arrayLoaded[arrIndex] = true;
 }
 
-void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
+void EclFile::storeArray(std::size_t arrIndex, ArrayData&& data)
 {
+    std::visit([this, arrIndex](auto&& values)
+    {
+        using T = std::decay_t<decltype(values)>;
 
-    switch (array_type[arrIndex]) {
-    case INTE:
-        inte_array[arrIndex] = readFormattedInteArray(fileStr, array_size[arrIndex], fromPos);
-        break;
-    case REAL:
-        real_array[arrIndex] = readFormattedRealArray(fileStr, array_size[arrIndex], fromPos);
-        break;
-    case DOUB:
-        doub_array[arrIndex] = readFormattedDoubArray(fileStr, array_size[arrIndex], fromPos);
-        break;
-    case LOGI:
-        logi_array[arrIndex] = readFormattedLogiArray(fileStr, array_size[arrIndex], fromPos);
-        break;
-    case CHAR:
-        char_array[arrIndex] = readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, sizeOfChar);
-        break;
-    case C0NN:
-        char_array[arrIndex] = readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, array_element_size[arrIndex]);
-        break;
-    case MESS:
-        break;
-    default:
-        OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
-        break;
-    }
+        if constexpr (std::is_same_v<T, std::vector<int>>) {
+            inte_array[arrIndex] = std::move(values);
+        }
+        else if constexpr (std::is_same_v<T, std::vector<bool>>) {
+            logi_array[arrIndex] = std::move(values);
+        }
+        else if constexpr (std::is_same_v<T, std::vector<double>>) {
+            doub_array[arrIndex] = std::move(values);
+        }
+        else if constexpr (std::is_same_v<T, std::vector<float>>) {
+            real_array[arrIndex] = std::move(values);
+        }
+        else if constexpr (std::is_same_v<T, std::vector<std::string>>) {
+            char_array[arrIndex] = std::move(values);
+        }
+    }, std::move(data));
 
     arrayLoaded[arrIndex] = true;
 }
@@ -183,151 +278,74 @@ void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrInde
 
 void EclFile::loadData()
 {
+    std::vector<int> arrIndices(array_name.size());
+    std::iota(arrIndices.begin(), arrIndices.end(), 0);
 
-    if (formatted) {
-
-        std::vector<int> arrIndices(array_name.size());
-        std::iota(arrIndices.begin(), arrIndices.end(), 0);
-
-        this->loadData(arrIndices);
-
-    } else {
-
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        for (std::size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
-        }
-
-        fileH.close();
-    }
+    this->loadData(arrIndices);
 }
 
 
 void EclFile::loadData(const std::string& name)
 {
+    std::vector<int> arrIndices;
 
-    if (formatted) {
-
-        std::ifstream inFile(inputFilename);
-
-        for (unsigned int arrIndex = 0; arrIndex < array_name.size(); arrIndex++) {
-
-            if (array_name[arrIndex] == name) {
-
-                inFile.seekg(ifStreamPos[arrIndex]);
-
-                std::size_t disk_size = sizeOnDiskFormatted(array_size[arrIndex],
-                                                            array_type[arrIndex],
-                                                            array_element_size[arrIndex]) + 1;
-                std::vector<char> buffer(disk_size);
-                inFile.read (buffer.data(), disk_size);
-
-                std::string fileStr = std::string(buffer.data(), disk_size);
-
-                loadFormattedArray(fileStr, arrIndex, 0);
-            }
-        }
-
-    } else {
-
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        for (size_t i = 0; i < array_name.size(); i++) {
-            if (array_name[i] == name) {
-                loadBinaryArray(fileH, i);
-            }
+    for (size_t i = 0; i < array_name.size(); i++) {
+        if ((array_name[i] == name) && !arrayLoaded[i]) {
+            arrIndices.push_back(static_cast<int>(i));
         }
-
-        fileH.close();
     }
+
+    this->loadData(arrIndices);
 }
 
 
-void EclFile::loadData(const std::vector<int>& arrIndex)
+void EclFile::loadData(const std::vector<int>& requested)
 {
+    // Arrays which are already loaded are kept in place.  References to
+    // them, e.g., numpy views in the Python bindings, remain valid.
+    std::vector<int> arrIndex;
+    arrIndex.reserve(requested.size());
+    std::copy_if(requested.begin(), requested.end(), std::back_inserter(arrIndex),
+                 [this](const int i) { return !this->arrayLoaded[i]; });
+
+    const auto numArrays = static_cast<int>(arrIndex.size());
+    if (numArrays == 0) {
+        return;
+    }
 
-    if (formatted) {
-
-        std::ifstream inFile(inputFilename);
-
-        for (int ind : arrIndex) {
-
-            inFile.seekg(ifStreamPos[ind]);
-
-            std::size_t disk_size = sizeOnDiskFormatted(array_size[ind],
-                                                        array_type[ind],
-                                                        array_element_size[ind]) + 1;
-            std::vector<char> buffer(disk_size);
-            inFile.read (buffer.data(), disk_size);
-
-            std::string fileStr = std::string(buffer.data(), disk_size);
-
-            loadFormattedArray(fileStr, ind, 0);
-        }
-
-    } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+    // Every thread reads through a stream of its own into a separate
+    // element of 'data'.  The arrays are moved into the typed maps, which
+    // are not thread safe, once all of them have been read.
+    std::vector<ArrayData> data(numArrays);
+
+    const auto openFile = [this]()
+    {
+        return std::fstream {
+            this->inputFilename,
+            this->formatted ? std::ios::in : (std::ios::in | std::ios::binary)
+        };
+    };
 
+    utility::parallelForWithState(numArrays, openFile,
+        [this, &data, &arrIndex](std::fstream& fileH, const int i)
+    {
         if (!fileH) {
             std::string message="Could not open file: '" + inputFilename +"'";
             OPM_THROW(std::runtime_error, message);
         }
 
-        for (int ind : arrIndex) {
-            loadBinaryArray(fileH, ind);
-        }
+        data[i] = this->readArray(fileH, arrIndex[i]);
+    });
 
-        fileH.close();
+    for (int i = 0; i < numArrays; ++i) {
+        this->storeArray(arrIndex[i], std::move(data[i]));
     }
 }
 
 
 void EclFile::loadData(int arrIndex)
 {
-    if (formatted) {
-
-        std::ifstream inFile(inputFilename);
-
-            inFile.seekg(ifStreamPos[arrIndex]);
-
-            std::size_t disk_size = sizeOnDiskFormatted(array_size[arrIndex],
-                                                        array_type[arrIndex],
-                                                        array_element_size[arrIndex]) + 1;
-            std::vector<char> buffer(disk_size);
-            inFile.read (buffer.data(), disk_size);
-
-            std::string fileStr = std::string(buffer.data(), disk_size);
-
-            loadFormattedArray(fileStr, arrIndex, 0);
-
-
-    } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        loadBinaryArray(fileH, arrIndex);
-
-        fileH.close();
-    }
+    this->loadData(std::vector<int>{ arrIndex });
 }
 
 bool EclFile::is_ix() const
@@ -649,4 +667,48 @@ std::size_t EclFile::size() const {
 }
 
 
+std::vector<ArrayIndexEntry> EclFile::arrayIndex()
+{
+    this->loadData("SEQNUM");
+
+    std::vector<ArrayIndexEntry> entries(array_name.size());
+
+    int reportStep = -1;
+    for (size_t i = 0; i < entries.size(); i++) {
+        auto& entry = entries[i];
+
+        if ((array_name[i] == "SEQNUM") && (array_type[i] == INTE) && (array_size[i] == 1)) {
+            reportStep = this->get<int>(i).front();
+        }
+
+        entry.headerPosition = headerStreamPos[i];
+        entry.dataPosition = ifStreamPos[i];
+        entry.size = array_size[i];
+        entry.type = array_type[i];
+        entry.elementSize = array_element_size[i];
+        entry.reportStep = reportStep;
+        entry.setArrayName(array_name[i]);
+    }
+
+    return entries;
+}
+
+
+void EclFile::writeArrayIndex()
+{
+    std::error_code ec;
+    const std::uint64_t fileSize = std::filesystem::file_size(this->inputFilename, ec);
+
+    // Only an object holding all arrays of the file describes the file
+    const auto wholeFile = !ec && !this->ifStreamPos.empty()
+        && (this->ifStreamPos.back() == fileSize)
+        && (this->headerStreamPos.empty() || (this->headerStreamPos.front() == 0));
+
+    if (! wholeFile) {
+        return;
+    }
+
+    ::Opm::EclIO::writeArrayIndex(this->inputFilename, fileSize, this->arrayIndex());
+}
+
 }} // namespace Opm::ecl
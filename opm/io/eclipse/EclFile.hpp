@@ -19,14 +19,17 @@
 #ifndef OPM_IO_ECLFILE_HPP
 #define OPM_IO_ECLFILE_HPP
 
+#include <opm/io/eclipse/ArrayIndex.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 
 #include <ios>
+#include <iosfwd>
 #include <map>
 #include <string>
 #include <stdexcept>
 #include <tuple>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 #include <cstdint>
 
@@ -46,7 +49,10 @@ public:
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
-    void loadData(const std::vector<int>& arrIndex);   // load data based on array indices in vector arrIndex
+
+    // load data based on array indices in vector arrIndex.  The arrays are
+    // read and decoded in parallel if OpenMP is enabled.
+    void loadData(const std::vector<int>& arrIndex);
 
     void clearData()
     {
@@ -77,6 +83,16 @@ public:
     std::size_t size() const;
     bool is_ix() const;
 
+    // Locations of all arrays, e.g., to write an array index sidecar.
+    // Loads the SEQNUM arrays.
+    std::vector<ArrayIndexEntry> arrayIndex();
+
+    // Write the array index sidecar <filename>.ARRIDX of the whole file
+    // for later readers.  Readers never create the sidecar on their own,
+    // so this is the explicit opt-in for files not written with an array
+    // index.  Failures are not reported since the sidecar is only a cache.
+    void writeArrayIndex();
+
 protected:
     bool formatted;
     std::string inputFilename;
@@ -92,6 +108,7 @@ protected:
     std::vector<std::int64_t> array_size;
     std::vector<int> array_element_size;
 
+    std::vector<std::uint64_t> headerStreamPos;
     std::vector<std::uint64_t> ifStreamPos;
 
     std::map<std::string, int> array_index;
@@ -104,13 +121,40 @@ protected:
     std::streampos
     seekPosition(const std::vector<std::string>::size_type arrIndex) const;
 
+    // Arrays of a contiguous part of a file, such as one report step of a
+    // unified restart file.
+    struct ArrayRange
+    {
+        std::vector<ArrayIndexEntry> arrays{};  // in file order
+        std::uint64_t end{0};                   // file position after the last array
+    };
+
+    // Only the arrays of 'range'.  The caller has located them, so the
+    // file is neither scanned nor checked for an array index.
+    EclFile(const std::string& filename, const ArrayRange& range);
+
+    bool isLoaded(int arrIndex) const { return arrayLoaded[arrIndex]; }
+
 private:
     std::vector<bool> arrayLoaded;
 
-    void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
-    void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
+    using ArrayData = std::variant<std::monostate,
+                                   std::vector<int>,
+                                   std::vector<bool>,
+                                   std::vector<double>,
+                                   std::vector<float>,
+                                   std::vector<std::string>>;
+
+    ArrayData readArray(std::fstream& fileH, std::size_t arrIndex) const;
+    void storeArray(std::size_t arrIndex, ArrayData&& data);
     void load(bool preload);
 
+    // Use the array index sidecar instead of scanning the file, if the
+    // sidecar is valid.
+    bool loadArrayIndex();
+
+    void assignArrays(const std::vector<ArrayIndexEntry>& entries, std::uint64_t end);
+
     std::vector<unsigned int> get_bin_logi_raw_values(int arrIndex) const;
     std::vector<std::string> get_fmt_real_raw_str_values(int arrIndex) const;
 
@@ -17,28 +17,360 @@
    */
 
 #include <opm/io/eclipse/EclOutput.hpp>
+
+#include <opm/io/eclipse/ArrayIndex.hpp>
+#include <opm/io/eclipse/AsyncWriter.hpp>
+#include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/ParallelFor.hpp>
 
 #include <algorithm>
+#include <charconv>
 #include <cmath>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
 #include <ios>
 #include <sstream>
 #include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <tuple>
+#include <type_traits>
 #include <typeinfo>
+#include <utility>
+#include <vector>
+
+// Floating-point std::to_chars() is missing from libstdc++ before GCC 11
+// and from libc++ before LLVM 14.
+#if (defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)) \
+    || (defined(_LIBCPP_VERSION) && (_LIBCPP_VERSION >= 14000))      \
+    || defined(_MSC_VER)
+#define OPM_ECLOUTPUT_FP_TO_CHARS 1
+#endif
+
+namespace {
+
+/// Amount of staged output at which large arrays are handed over to the
+/// background writer in pieces rather than as a whole.
+constexpr auto stagingChunkSize = std::string::size_type{1} << 20;
+
+/// Upper bound on size of intermediate buffer of encoded binary records.
+constexpr auto maxWriteBufferSize = std::int64_t{1} << 23;
+
+/// Number of formatted output blocks encoded per batch.  Bounds the size
+/// of the intermediate text buffers.
+constexpr auto formattedBatchSize = std::size_t{256};
+
+/// Upper bound on number of characters in a single formatted value.
+constexpr auto maxFormattedValueSize = std::size_t{32};
+
+template <std::size_t N>
+char* putLiteral(const char (&str)[N], char* out)
+{
+    return std::copy_n(str, N - 1, out);
+}
+
+/// Write exponent in the style of printf("%+03i").
+char* putExponent(int exponent, char* out)
+{
+    *out++ = (exponent < 0) ? '-' : '+';
+
+    if (exponent < 0) {
+        exponent = -exponent;
+    }
+
+    if (exponent < 10) {
+        *out++ = '0';
+    }
+
+    return std::to_chars(out, out + 4, exponent).ptr;
+}
+
+/// Write value as [-]d.ddd...ddde{+-}XX[X] with 'precision' digits after
+/// the decimal point.  Equivalent to printf("%.*e").
+template <typename T>
+char* putScientific(const T value, const int precision, char* first, char* last)
+{
+#ifdef OPM_ECLOUTPUT_FP_TO_CHARS
+    return std::to_chars(first, last, value, std::chars_format::scientific, precision).ptr;
+#else
+    const auto n = std::snprintf(first, last - first, "%.*e", precision, static_cast<double>(value));
+    return first + n;
+#endif
+}
+
+/// Write finite, non-zero value as [-]0.ddd...ddd with numDigits correctly
+/// rounded significant digits.  Decimal exponent of the leading digit,
+/// i.e., the exponent of the d.ddd representation, returned in exponent.
+template <typename T>
+char* putEclMantissa(const T value, const int numDigits, char* out, int& exponent)
+{
+    // [-]d.ddd...ddde{+-}XX[X]
+    char sci[maxFormattedValueSize];
+    const auto end = putScientific(value, numDigits - 1, std::begin(sci), std::end(sci));
+
+    const char* p = sci;
+    if (*p == '-') {
+        *out++ = *p++;
+    }
+
+    *out++ = '0';
+    *out++ = '.';
+    *out++ = *p++;              // Leading digit
+    ++p;                        // Decimal point
+    out = std::copy_n(p, numDigits - 1, out);
+    p += numDigits;             // Trailing digits and 'e'
+
+    // std::from_chars() does not accept a leading '+'.
+    std::from_chars(p + (*p == '+'), end, exponent);
+
+    return out;
+}
+
+template <typename T>
+char* putNonFinite(const T value, char* out)
+{
+    if (std::isnan(value)) {
+        return putLiteral("NAN", out);
+    }
+
+    return (value > 0) ? putLiteral("INF", out) : putLiteral("-INF", out);
+}
+
+/// Equivalent to printf("%10.7E") followed by shifting the decimal point
+/// one place to the left, i.e., 0.ddddddddE+XX.
+char* formatRealEcl(const float value, char* out)
+{
+    if (value == 0.0) {
+        return putLiteral("0.00000000E+00", out);
+    }
+
+    if (! std::isfinite(value)) {
+        return putNonFinite(value, out);
+    }
+
+    auto exponent = 0;
+    out = putEclMantissa(value, 8, out, exponent);
+
+    *out++ = 'E';
+    return putExponent(exponent + 1, out);
+}
+
+/// Equivalent to printf("%19.13E") followed by shifting the decimal point
+/// one place to the left.  Exponent character is 'D', but omitted if the
+/// exponent has three digits.
+char* formatDoubEcl(const double value, char* out)
+{
+    if (value == 0.0) {
+        return putLiteral("0.00000000000000D+00", out);
+    }
+
+    if (! std::isfinite(value)) {
+        return putNonFinite(value, out);
+    }
+
+    auto exponent = 0;
+    out = putEclMantissa(value, 14, out, exponent);
+
+    if ((exponent >= -100) && (exponent < 99)) {
+        *out++ = 'D';
+    }
+
+    return putExponent(exponent + 1, out);
+}
+
+template <typename T>
+char* formatIx(const T value, const int precision, char* out)
+{
+    const auto end = putScientific(value, precision, out, out + maxFormattedValueSize);
+
+    std::replace(out, end, 'e', 'E');
+
+    return end;
+}
+
+/// Equivalent to printf("%10.7E").
+char* formatRealIx(const float value, char* out)
+{
+    if (value == 0.0) {
+        return putLiteral(" 0.0000000E+00", out);
+    }
+
+    if (! std::isfinite(value)) {
+        return putNonFinite(value, out);
+    }
+
+    return formatIx(value, 7, out);
+}
+
+/// Equivalent to printf("%19.13E").
+char* formatDoubIx(const double value, char* out)
+{
+    if (value == 0.0) {
+        return putLiteral(" 0.0000000000000E+00", out);
+    }
+
+    if (! std::isfinite(value)) {
+        return putNonFinite(value, out);
+    }
+
+    return formatIx(value, 13, out);
+}
+
+char* formatInte(const int value, char* out)
+{
+    return std::to_chars(out, out + maxFormattedValueSize, value).ptr;
+}
+
+char* formatLogi(const bool value, char* out)
+{
+    return value ? putLiteral("  T", out) : putLiteral("  F", out);
+}
+
+/// Append formatted text of elements [begin, end) of data, constituting a
+/// single block of a formatted array, to text.  Each element is right
+/// aligned in a column of width columnWidth, and lines end after every
+/// nColumns elements and at the end of the block.
+template <typename T, typename Format>
+void encodeFormattedBlock(const std::vector<T>& data,
+                          const std::size_t     begin,
+                          const std::size_t     end,
+                          const int             nColumns,
+                          const int             columnWidth,
+                          Format&&              format,
+                          std::string&          text)
+{
+    char value[maxFormattedValueSize];
+
+    auto n = 0;
+    for (auto i = begin; i < end; ++i) {
+        const auto len = static_cast<int>(format(data[i], value) - value);
+
+        if (len < columnWidth) {
+            text.append(columnWidth - len, ' ');
+        }
+
+        text.append(value, len);
+
+        if ((++n % nColumns) == 0) {
+            text.push_back('\n');
+        }
+    }
+
+    if ((n % nColumns) != 0) {
+        text.push_back('\n');
+    }
+}
+
+/// Encode formatted array in batches of whole blocks.  Blocks are
+/// independent, so the blocks of a batch are encoded in parallel and then
+/// handed to emit() in order.
+template <typename T, typename Format, typename Emit>
+void encodeFormattedArray(const std::vector<T>&          data,
+                          const Opm::EclIO::eclArrType   arrType,
+                          Format&&                       format,
+                          Emit&&                         emit)
+{
+    const auto sizeData = Opm::EclIO::block_size_data_formatted(arrType);
+
+    const auto maxBlockSize = static_cast<std::size_t>(std::get<0>(sizeData));
+    const int nColumns = std::get<1>(sizeData);
+    const int columnWidth = std::get<2>(sizeData);
+
+    const auto size = data.size();
+    const auto numBlocks = (size + maxBlockSize - 1) / maxBlockSize;
+
+    std::vector<std::string> text(std::min(numBlocks, formattedBatchSize));
+
+    for (auto batch = 0*numBlocks; batch < numBlocks; batch += text.size()) {
+        const auto numBatch = static_cast<int>(std::min(text.size(), numBlocks - batch));
+
+        Opm::utility::parallelFor(numBatch, [&](const int b)
+        {
+            const auto begin = (batch + b) * maxBlockSize;
+
+            text[b].clear();
+            encodeFormattedBlock(data, begin, std::min(begin + maxBlockSize, size),
+                                 nColumns, columnWidth, format, text[b]);
+        });
+
+        for (auto b = 0; b < numBatch; ++b) {
+            emit(text[b]);
+        }
+    }
+}
+
+} // Anonymous namespace
 
 namespace Opm { namespace EclIO {
 
+class EclOutput::Staging
+{
+public:
+    Staging()
+        : stream_ { &this->buffer_ }
+    {}
+
+    std::ostream& stream()
+    {
+        return this->stream_;
+    }
+
+    std::string::size_type size() const
+    {
+        return this->buffer_.data.size();
+    }
+
+    /// Extract all staged data and reset buffer to empty.
+    std::string release()
+    {
+        auto data = std::exchange(this->buffer_.data, std::string{});
+        this->buffer_.data.reserve(stagingChunkSize);
+
+        return data;
+    }
+
+private:
+    /// Stream buffer which appends all output to a string.
+    class Buffer : public std::streambuf
+    {
+    public:
+        std::string data{};
+
+    protected:
+        int_type overflow(int_type ch) override
+        {
+            if (! traits_type::eq_int_type(ch, traits_type::eof())) {
+                this->data.push_back(traits_type::to_char_type(ch));
+            }
+
+            return traits_type::not_eof(ch);
+        }
+
+        std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+            this->data.append(s, static_cast<std::string::size_type>(n));
+            return n;
+        }
+    };
+
+    Buffer buffer_{};
+    std::ostream stream_;
+};
+
 EclOutput::EclOutput(const std::string&            filename,
                      const bool                    formatted,
                      const std::ios_base::openmode mode)
     : isFormatted{formatted}
+    , fileName_{filename}
 {
     const auto binmode = mode | std::ios_base::binary;
     ix_standard = false;
@@ -46,6 +378,115 @@ EclOutput::EclOutput(const std::string&            filename,
     this->ofileH.open(filename, this->isFormatted ? mode : binmode);
 }
 
+EclOutput::~EclOutput()
+{
+    if (this->asyncFile_ == nullptr) {
+        this->writeArrayIndex();
+        return;
+    }
+
+    // Close file once all pending output has been written.
+    try {
+        this->writer_->submit([file = std::move(this->asyncFile_),
+                               fname = this->fileName_]()
+        {
+            file->close();
+
+            if (file->fail()) {
+                throw std::runtime_error {
+                    "Failed to close output file '" + fname + '\''
+                };
+            }
+        }, 0);
+    }
+    catch (...) {
+        // Failed to allocate close task.  File closed when last pending
+        // write completes.
+    }
+
+    this->writeArrayIndex();
+}
+
+EclOutput::EclOutput(EclOutput&& rhs) = default;
+EclOutput& EclOutput::operator=(EclOutput&& rhs) = default;
+
+void EclOutput::setAsyncWriter(std::shared_ptr<AsyncWriter> writer)
+{
+    if ((writer == nullptr) || ! this->ofileH.is_open()) {
+        // Nothing to do, or file could not be opened.  Retain synchronous
+        // mode to report errors at the point of writing.
+        return;
+    }
+
+    if (this->writer_ != nullptr) {
+        throw std::logic_error {
+            "Output stream for '" + this->fileName_
+            + "' is already asynchronous"
+        };
+    }
+
+    this->ofileH.flush();
+
+    if (this->index_ != nullptr) {
+        this->asyncPosition_ = this->position();
+    }
+
+    this->asyncFile_ = std::make_shared<std::ofstream>(std::move(this->ofileH));
+    this->staging_ = std::make_unique<Staging>();
+    this->writer_ = std::move(writer);
+}
+
+void EclOutput::enableArrayIndex()
+{
+    if ((this->index_ != nullptr) || ! this->ofileH.is_open()) {
+        return;
+    }
+
+    if (this->writer_ != nullptr) {
+        throw std::logic_error {
+            "Array index for '" + this->fileName_
+            + "' must be enabled before output is made asynchronous"
+        };
+    }
+
+    // The file position of a stream in append mode is not placed at the
+    // end of the file until the first output operation.
+    this->ofileH.flush();
+    this->ofileH.seekp(0, std::ios_base::end);
+
+    const auto filePos = this->ofileH.tellp();
+    if (filePos == std::ofstream::pos_type(-1)) {
+        this->ofileH.clear();
+        return;
+    }
+
+    const auto size = static_cast<std::uint64_t>(std::streamoff(filePos));
+
+    auto entries = std::vector<ArrayIndexEntry>{};
+    if (size > 0) {
+        if (auto existing = readArrayIndex(this->fileName_, size, this->isFormatted); existing.has_value()) {
+            entries = std::move(*existing);
+        }
+        else {
+            // No usable sidecar.  Index existing contents by scanning.
+            try {
+                entries = EclFile { this->fileName_, EclFile::Formatted { this->isFormatted } }
+                    .arrayIndex();
+            }
+            catch (const std::exception&) {
+                // Not an ECL file we can read.  Do not create an index.
+                return;
+            }
+        }
+    }
+
+    if (! entries.empty()) {
+        this->reportStep_ = entries.back().reportStep;
+    }
+
+    this->index_ = std::make_unique<std::vector<ArrayIndexEntry>>(std::move(entries));
+}
+
 
 template<>
 void EclOutput::write<std::string>(const std::string& name,
@@ -88,6 +529,8 @@ void EclOutput::write<std::string>(const std::string& name,
             writeBinaryCharArray(data, sizeOfChar);
        }
     }
+
+    submitStaged();
 }
 
 void EclOutput::write(const std::string& name, const std::vector<std::string>& data, int element_size)
@@ -125,6 +568,8 @@ void EclOutput::write(const std::string& name, const std::vector<std::string>& d
             writeBinaryCharArray(data, sizeOfChar);
         }
     }
+
+    submitStaged();
 }
 
 template <>
@@ -140,6 +585,8 @@ void EclOutput::write<PaddedOutputString<8>>
         writeBinaryHeader(name, data.size(), CHAR, sizeOfChar);
         writeBinaryCharArray(data);
     }
+
+    this->submitStaged();
 }
 
 void EclOutput::message(const std::string& msg)
@@ -153,11 +600,143 @@ void EclOutput::message(const std::string& msg)
 
 void EclOutput::flushStream()
 {
-    this->ofileH.flush();
+    if (this->asyncFile_ == nullptr) {
+        this->ofileH.flush();
+        return;
+    }
+
+    this->writer_->submit([file = this->asyncFile_]() { file->flush(); }, 0);
+}
+
+std::ostream& EclOutput::sink()
+{
+    if (this->staging_ != nullptr) {
+        return this->staging_->stream();
+    }
+
+    return this->ofileH;
+}
+
+bool EclOutput::isOpen() const
+{
+    return (this->asyncFile_ != nullptr) || this->ofileH.is_open();
+}
+
+void EclOutput::submitStaged(const std::size_t minSize)
+{
+    if ((this->staging_ == nullptr) || (this->staging_->size() < minSize)) {
+        return;
+    }
+
+    auto data = this->staging_->release();
+    if (data.empty()) {
+        return;
+    }
+
+    const auto size = data.size();
+
+    this->asyncPosition_ += size;
+
+    this->writer_->submit([file = this->asyncFile_,
+                           data = std::move(data),
+                           fname = this->fileName_]()
+    {
+        file->write(data.data(), static_cast<std::streamsize>(data.size()));
+
+        if (! *file) {
+            throw std::runtime_error {
+                "Failed to write " + std::to_string(data.size())
+                + " bytes to output file '" + fname + '\''
+            };
+        }
+    }, size);
+}
+
+void EclOutput::rewind()
+{
+    // Array positions no longer known
+    this->index_.reset();
+
+    const auto position = std::ofstream::pos_type{0};
+
+    if (this->asyncFile_ == nullptr) {
+        this->ofileH.seekp(position, std::ios_base::beg);
+        return;
+    }
+
+    this->writer_->submit([file = this->asyncFile_, position]()
+    {
+        file->seekp(position, std::ios_base::beg);
+    }, 0);
+}
+
+std::uint64_t EclOutput::position()
+{
+    if (this->staging_ != nullptr) {
+        return this->asyncPosition_ + this->staging_->size();
+    }
+
+    return static_cast<std::uint64_t>(std::streamoff(this->ofileH.tellp()));
+}
+
+void EclOutput::indexArray(const std::uint64_t headerPosition,
+                           const std::string&  arrName,
+                           const std::int64_t  size,
+                           const eclArrType    arrType,
+                           const int           element_size)
+{
+    auto& entry = this->index_->emplace_back();
+
+    entry.headerPosition = headerPosition;
+    entry.dataPosition = this->position();
+    entry.size = size;
+    entry.type = arrType;
+
+    // Element size as reported by the header readers
+    entry.elementSize = (arrType == C0NN) ? element_size
+        : (((arrType == DOUB) || (arrType == CHAR)) ? 8 : 4);
+    entry.reportStep = this->reportStep_;
+    entry.setArrayName(arrName);
+}
+
+void EclOutput::writeArrayIndex() noexcept
+{
+    if (this->index_ == nullptr) {
+        return;
+    }
+
+    // The destructor hands the asynchronous file over to the close task
+    // before getting here, so test for the writer rather than the file.
+    if (this->writer_ == nullptr) {
+        if (this->ofileH.flush()) {
+            ::Opm::EclIO::writeArrayIndex(this->fileName_, this->position(), *this->index_);
+        }
+
+        return;
+    }
+
+    // Written once all pending output, including the close task, is
+    // complete.  Capturing the file name may throw.
+    try {
+        this->writer_->submit([entries = std::move(*this->index_),
+                               fname = this->fileName_,
+                               size = this->position()]()
+        {
+            ::Opm::EclIO::writeArrayIndex(fname, size, entries);
+        }, 0);
+    }
+    catch (...) {
+        // Sidecar is optional
+    }
 }
 
 void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclArrType arrType, int element_size)
 {
+    auto& os = this->sink();
+
+    const auto headerPosition = (this->index_ != nullptr) ? this->position() : 0;
+    const auto numElements = size;
+
     int bhead = flipEndianInt(16);
     std::string name = arrName + std::string(8 - arrName.size(),' ');
 
@@ -168,21 +747,21 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclAr
 
         int flippedx231 = flipEndianInt(static_cast<int>( (-1)*x231 ));
 
-        ofileH.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
-        ofileH.write(name.c_str(), 8);
-        ofileH.write(reinterpret_cast<char*>(&flippedx231), sizeof(flippedx231));
-        ofileH.write("X231", 4);
-        ofileH.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
+        os.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
+        os.write(name.c_str(), 8);
+        os.write(reinterpret_cast<char*>(&flippedx231), sizeof(flippedx231));
+        os.write("X231", 4);
+        os.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
 
         size = size - (x231 * val231);
     }
 
     int flippedSize = flipEndianInt(size);
 
-    ofileH.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
+    os.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
 
-    ofileH.write(name.c_str(), 8);
-    ofileH.write(reinterpret_cast<char*>(&flippedSize), sizeof(flippedSize));
+    os.write(name.c_str(), 8);
+    os.write(reinterpret_cast<char*>(&flippedSize), sizeof(flippedSize));
 
     std::string c0nn_str;
 
@@ -194,38 +773,41 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclAr
 
     switch(arrType) {
     case INTE:
-        ofileH.write("INTE", 4);
+        os.write("INTE", 4);
         break;
     case REAL:
-        ofileH.write("REAL", 4);
+        os.write("REAL", 4);
         break;
     case DOUB:
-        ofileH.write("DOUB", 4);
+        os.write("DOUB", 4);
         break;
     case LOGI:
-        ofileH.write("LOGI", 4);
+        os.write("LOGI", 4);
         break;
     case CHAR:
-        ofileH.write("CHAR", 4);
+        os.write("CHAR", 4);
         break;
     case C0NN:
-        ofileH.write(c0nn_str.c_str(), 4);
+        os.write(c0nn_str.c_str(), 4);
         break;
     case MESS:
-        ofileH.write("MESS", 4);
+        os.write("MESS", 4);
         break;
     }
 
-    ofileH.write(reinterpret_cast<char *>(&bhead), sizeof(bhead));
+    os.write(reinterpret_cast<char *>(&bhead), sizeof(bhead));
+
+    if (this->index_ != nullptr) {
+        this->indexArray(headerPosition, arrName, numElements, arrType, element_size);
+    }
 }
 
 template <typename T>
 void EclOutput::writeBinaryArray(const std::vector<T>& data)
 {
-    int num;
-    int64_t rest, offset;
-    int dhead;
-    int64_t size = data.size();
+    auto& os = this->sink();
+
+    const int64_t size = data.size();
 
     eclArrType arrType = MESS;
 
@@ -239,86 +821,69 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         arrType = LOGI;
     }
 
-    auto sizeData = block_size_data_binary(arrType);
+    const auto sizeData = block_size_data_binary(arrType);
 
-    int sizeOfElement = std::get<0>(sizeData);
-    int maxBlockSize = std::get<1>(sizeData);
-    int maxNumberOfElements = maxBlockSize / sizeOfElement;
+    const auto sizeOfElement = static_cast<int64_t>(std::get<0>(sizeData));
+    const auto maxNumberOfElements = std::get<1>(sizeData) / sizeOfElement;
 
-    if (!ofileH.is_open()) {
+    if (!this->isOpen()) {
         OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
     }
 
-    int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
-
-    rest = size * static_cast<int64_t>(sizeOfElement);
-
-    offset = 0;
-
-    while (rest > 0) {
-        if (rest > maxBlockSize) {
-            rest -= maxBlockSize;
-            num = maxNumberOfElements;
-        } else {
-            num = static_cast<int>(rest) / sizeOfElement;
-            rest = 0;
-        }
-
-        dhead = flipEndianInt(num * sizeOfElement);
-
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+    const int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
 
-        if (arrType == INTE) {
+    // Encode as many complete records, including the Fortran record
+    // markers, as fit in a single buffer and output each buffer in a
+    // single write operation.
+    const auto markerSize = static_cast<int64_t>(sizeof(int));
+    const auto maxRecordSize = maxNumberOfElements*sizeOfElement + 2*markerSize;
+    const auto recordsPerWrite = std::max(int64_t{1}, maxWriteBufferSize / maxRecordSize);
 
-            std::vector<int> flipped_data;
-            flipped_data.resize(num, 0);
+    auto buffer = std::vector<char>{};
 
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianInt(data[m + offset]);
+    int64_t offset = 0;
+    while (offset < size) {
+        const auto numRemaining = size - offset;
+        const auto numRecords = std::min(recordsPerWrite,
+                                         (numRemaining + maxNumberOfElements - 1) / maxNumberOfElements);
+        const auto numElements = std::min(numRemaining, numRecords*maxNumberOfElements);
 
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
+        buffer.resize(numElements*sizeOfElement + numRecords*2*markerSize);
 
-        } else if (arrType == REAL) {
+        auto* rec = buffer.data();
+        for (auto r = 0*numRecords; r < numRecords; ++r) {
+            const auto num = std::min(maxNumberOfElements, size - offset);
+            const int dhead = flipEndianInt(static_cast<int>(num * sizeOfElement));
 
-            std::vector<float> flipped_data;
-            flipped_data.resize(num, 0);
+            std::memcpy(rec, &dhead, sizeof dhead);
+            auto* payload = rec + markerSize;
 
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianFloat(data[m + offset]);
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
-
-        } else if (arrType == DOUB) {
-
-            std::vector<double> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianDouble(data[m + offset]);
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
-
-        } else if (arrType == LOGI) {
-
-            std::vector<int> logi_data;
-            logi_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                if (data[m + offset])
-                    logi_data[m] = logi_true_val;
-                else
-                    logi_data[m] = false_value;
-
-            ofileH.write(reinterpret_cast<char*>(logi_data.data()), logi_data.size() * sizeof(int)) ;
+            if constexpr (std::is_same_v<T, bool>) {
+                for (auto m = 0*num; m < num; ++m) {
+                    const int value = data[m + offset] ? logi_true_val : false_value;
+                    std::memcpy(payload + m*sizeOfElement, &value, sizeof value);
+                }
+            }
+            else {
+                std::memcpy(payload, data.data() + offset, num * sizeof(T));
+
+                if constexpr (sizeof(T) == 4) {
+                    flipEndianArray32(payload, num);
+                }
+                else if constexpr (sizeof(T) == 8) {
+                    flipEndianArray64(payload, num);
+                }
+            }
 
-        } else {
+            std::memcpy(payload + num*sizeOfElement, &dhead, sizeof dhead);
 
-            std::cerr << "type not supported in write binaryarray\n";
-            std::exit(EXIT_FAILURE);
+            rec = payload + num*sizeOfElement + markerSize;
+            offset += num;
         }
 
-        offset += num;
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        os.write(buffer.data(), buffer.size());
+
+        this->submitStaged(stagingChunkSize);
     }
 }
 
@@ -332,6 +897,8 @@ template void EclOutput::writeBinaryArray<char>(const std::vector<char>& data);
 
 void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data, int element_size)
 {
+    auto& os = this->sink();
+
     int num,dhead;
 
     int n = 0;
@@ -350,7 +917,7 @@ void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data, int e
 
     int rest = size * sizeOfElement;
 
-    if (!ofileH.is_open()) {
+    if (!this->isOpen()) {
         OPM_THROW(std::runtime_error,"fstream fileH not open for writing");
     }
 
@@ -365,20 +932,22 @@ void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data, int e
 
         dhead = flipEndianInt(num * sizeOfElement);
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        os.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
         for (int i = 0; i < num; i++) {
             std::string tmpStr = data[n] + std::string(sizeOfElement - data[n].size(),' ');
-            ofileH.write(tmpStr.c_str(), sizeOfElement);
+            os.write(tmpStr.c_str(), sizeOfElement);
             n++;
         }
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        os.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
 void EclOutput::writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& data)
 {
+    auto& os = this->sink();
+
     const auto size = data.size();
 
     const auto sizeData = block_size_data_binary(CHAR);
@@ -389,7 +958,7 @@ void EclOutput::writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& d
 
     int rest = size * sizeOfElement;
 
-    if (!ofileH.is_open()) {
+    if (!this->isOpen()) {
         OPM_THROW(std::runtime_error,"fstream fileH not open for writing");
     }
 
@@ -403,21 +972,25 @@ void EclOutput::writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& d
 
         auto dhead = flipEndianInt(numElm * sizeOfElement);
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        os.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
         for (auto i = 0*numElm; i < numElm; ++i, ++elm) {
-            ofileH.write(elm->c_str(), sizeOfElement);
+            os.write(elm->c_str(), sizeOfElement);
         }
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        os.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
 void EclOutput::writeFormattedHeader(const std::string& arrName, int size, eclArrType arrType, int element_size)
 {
+    auto& os = this->sink();
+
+    const auto headerPosition = (this->index_ != nullptr) ? this->position() : 0;
+
     std::string name = arrName + std::string(8 - arrName.size(),' ');
 
-    ofileH << " '" << name << "' " << std::setw(11) << size;
+    os << " '" << name << "' " << std::setw(11) << size;
 
     std::string c0nn_str;
 
@@ -430,155 +1003,30 @@ void EclOutput::writeFormattedHeader(const std::string& arrName, int size, eclAr
 
     switch (arrType) {
     case INTE:
-        ofileH << " 'INTE'" <<  std::endl;
+        os << " 'INTE'" <<  std::endl;
         break;
     case REAL:
-        ofileH << " 'REAL'" <<  std::endl;
+        os << " 'REAL'" <<  std::endl;
         break;
     case DOUB:
-        ofileH << " 'DOUB'" <<  std::endl;
+        os << " 'DOUB'" <<  std::endl;
         break;
     case LOGI:
-        ofileH << " 'LOGI'" <<  std::endl;
+        os << " 'LOGI'" <<  std::endl;
         break;
     case CHAR:
-        ofileH << " 'CHAR'" <<  std::endl;
+        os << " 'CHAR'" <<  std::endl;
         break;
     case C0NN:
-        ofileH << " '" << c0nn_str << "'" <<  std::endl;
+        os << " '" << c0nn_str << "'" <<  std::endl;
         break;
     case MESS:
-        ofileH << " 'MESS'" <<  std::endl;
+        os << " 'MESS'" <<  std::endl;
         break;
     }
-}
-
 
-std::string EclOutput::make_real_string_ecl(float value) const
-{
-    constexpr std::size_t buf_size = 15;
-    char buffer [buf_size];
-    std::snprintf (buffer, sizeof buffer, "%10.7E", value);
-
-    if (value == 0.0) {
-        return "0.00000000E+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-
-        int exp =  value < 0.0 ? std::stoi(tmpstr.substr(11, 3)) :  std::stoi(tmpstr.substr(10, 3));
-
-        if (value < 0.0) {
-            tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 7) + "E";
-        } else {
-            tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 7) +"E";
-        }
-
-        std::snprintf (buffer, sizeof buffer, "%+03i", exp+1);
-        tmpstr = tmpstr+buffer;
-
-        return tmpstr;
-    }
-}
-
-std::string EclOutput::make_real_string_ix(float value) const
-{
-    constexpr std::size_t buf_size = 15;
-    char buffer [buf_size];
-    std::snprintf (buffer, sizeof buffer, "%10.7E", value);
-
-    if (value == 0.0) {
-        return " 0.0000000E+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-
-        return tmpstr;
-    }
-}
-
-
-std::string EclOutput::make_doub_string_ecl(double value) const
-{
-    char buffer [21 + 1];
-    std::snprintf (buffer, sizeof buffer, "%19.13E", value);
-
-    if (value == 0.0) {
-        return "0.00000000000000D+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-        int exp = value < 0.0 ? std::stoi(tmpstr.substr(17, 4)) : std::stoi(tmpstr.substr(16, 4));
-        const bool use_exp_char = (exp >= -100) && (exp < 99);
-
-        if (value < 0.0) {
-            if (use_exp_char) {
-                tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 13) + "D";
-            } else {
-                tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 13);
-            }
-        } else {
-            if (use_exp_char) {
-                tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 13) + "D";
-            } else {
-                tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 13);
-            }
-        }
-
-        std::snprintf(buffer, sizeof buffer, "%+03i", exp + 1);
-        tmpstr = tmpstr + buffer;
-        return tmpstr;
-    }
-}
-
-std::string EclOutput::make_doub_string_ix(double value) const
-{
-    char buffer [21];
-    std::snprintf (buffer, sizeof buffer, "%19.13E", value);
-
-    if (value == 0.0) {
-        return " 0.0000000000000E+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-
-        return tmpstr;
+    if (this->index_ != nullptr) {
+        this->indexArray(headerPosition, arrName, size, arrType, element_size);
     }
 }
 
@@ -586,68 +1034,23 @@ std::string EclOutput::make_doub_string_ix(double value) const
 template <typename T>
 void EclOutput::writeFormattedArray(const std::vector<T>& data)
 {
-    int size = data.size();
-    int n = 0;
+    auto emit = [this](const std::string& text)
+    {
+        this->sink().write(text.data(), text.size());
+        this->submitStaged(stagingChunkSize);
+    };
 
-    eclArrType arrType = MESS;
-    if (typeid(T) == typeid(int)) {
-        arrType = INTE;
-    } else if (typeid(T) == typeid(float)) {
-        arrType = REAL;
-    } else if (typeid(T) == typeid(double)) {
-        arrType = DOUB;
-    } else if (typeid(T) == typeid(bool)) {
-        arrType = LOGI;
+    if constexpr (std::is_same_v<T, int>) {
+        encodeFormattedArray(data, INTE, formatInte, emit);
     }
-
-
-    auto sizeData = block_size_data_formatted(arrType);
-
-    int maxBlockSize = std::get<0>(sizeData);
-    int nColumns = std::get<1>(sizeData);
-    int columnWidth = std::get<2>(sizeData);
-
-    for (int i = 0; i < size; i++) {
-        n++;
-
-        switch (arrType) {
-        case INTE:
-            ofileH << std::setw(columnWidth) << data[i];
-            break;
-        case REAL:
-            if (ix_standard)
-                ofileH << std::setw(columnWidth) << make_real_string_ix(data[i]);
-            else
-                ofileH << std::setw(columnWidth) << make_real_string_ecl(data[i]);
-            break;
-        case DOUB:
-            if (ix_standard)
-                ofileH << std::setw(columnWidth) << make_doub_string_ix(data[i]);
-            else
-                ofileH << std::setw(columnWidth) << make_doub_string_ecl(data[i]);
-            break;
-        case LOGI:
-            if (data[i]) {
-                ofileH << "  T";
-            } else {
-                ofileH << "  F";
-            }
-            break;
-        default:
-            break;
-        }
-
-        if ((n % nColumns) == 0 || (n % maxBlockSize) == 0) {
-            ofileH << std::endl;
-        }
-
-        if ((n % maxBlockSize) == 0) {
-            n=0;
-        }
+    else if constexpr (std::is_same_v<T, float>) {
+        encodeFormattedArray(data, REAL, this->ix_standard ? formatRealIx : formatRealEcl, emit);
     }
-
-    if ((n % nColumns) != 0 && (n % maxBlockSize) != 0) {
-        ofileH << std::endl;
+    else if constexpr (std::is_same_v<T, double>) {
+        encodeFormattedArray(data, DOUB, this->ix_standard ? formatDoubIx : formatDoubEcl, emit);
+    }
+    else if constexpr (std::is_same_v<T, bool>) {
+        encodeFormattedArray(data, LOGI, formatLogi, emit);
     }
 }
 
@@ -661,6 +1064,8 @@ template void EclOutput::writeFormattedArray<char>(const std::vector<char>& data
 
 void EclOutput::writeFormattedCharArray(const std::vector<std::string>& data, int element_size)
 {
+    auto& os = this->sink();
+
     auto sizeData = block_size_data_formatted(CHAR);
     int maxBlockSize = std::get<0>(sizeData);
 
@@ -687,15 +1092,15 @@ void EclOutput::writeFormattedCharArray(const std::vector<std::string>& data, in
             str1 = data[n] + std::string(element_size - data[n].size(),' ');
 
             n++;
-            ofileH << " '" << str1 << "'";
+            os << " '" << str1 << "'";
 
             if ((i+1) % nColumns == 0) {
-                ofileH  << std::endl;
+                os  << std::endl;
             }
         }
 
         if ((size % nColumns) != 0) {
-            ofileH  << std::endl;
+            os  << std::endl;
         }
 
         rest = (rest > maxBlockSize) ? rest - maxBlockSize : 0;
@@ -705,6 +1110,8 @@ void EclOutput::writeFormattedCharArray(const std::vector<std::string>& data, in
 
 void EclOutput::writeFormattedCharArray(const std::vector<PaddedOutputString<8>>& data)
 {
+    auto& os = this->sink();
+
     const auto sizeData = block_size_data_formatted(CHAR);
 
     const int nColumns = std::get<1>(sizeData);
@@ -712,15 +1119,15 @@ void EclOutput::writeFormattedCharArray(const std::vector<PaddedOutputString<8>>
     const auto size = data.size();
 
     for (auto i = 0*size; i < size; ++i) {
-        ofileH << " '" << data[i].c_str() << '\'';
+        os << " '" << data[i].c_str() << '\'';
 
         if ((i+1) % nColumns == 0) {
-            ofileH << '\n';
+            os << '\n';
         }
     }
 
     if ((size % nColumns) != 0) {
-        ofileH << '\n';
+        os << '\n';
     }
 }
 
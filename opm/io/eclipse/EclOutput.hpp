@@ -18,9 +18,13 @@
 #ifndef OPM_IO_ECLOUTPUT_HPP
 #define OPM_IO_ECLOUTPUT_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <ios>
+#include <memory>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 #include <vector>
 
@@ -34,6 +38,9 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 
 namespace Opm { namespace EclIO {
 
+class AsyncWriter;
+struct ArrayIndexEntry;
+
 class EclOutput
 {
 public:
@@ -41,6 +48,11 @@ public:
               const bool                    formatted,
               const std::ios_base::openmode mode = std::ios::out);
 
+    ~EclOutput();
+
+    EclOutput(EclOutput&& rhs);
+    EclOutput& operator=(EclOutput&& rhs);
+
     template<typename T>
     void write(const std::string& name,
                const std::vector<T>& data)
@@ -60,6 +72,12 @@ public:
         else if (typeid(T) == typeid(char))
             arrType = MESS;
 
+        if constexpr (std::is_same_v<T, int>) {
+            if ((name == "SEQNUM") && (data.size() == 1)) {
+                this->reportStep_ = data.front();
+            }
+        }
+
         if (isFormatted)
         {
             writeFormattedHeader(name, data.size(), arrType, element_size);
@@ -72,6 +90,8 @@ public:
             if (arrType != MESS)
                 writeBinaryArray(data);
         }
+
+        submitStaged();
     }
 
     // when this function is used array type will be assumed C0NN (not CHAR).
@@ -84,10 +104,35 @@ public:
 
     void set_ix() { ix_standard = true; }
 
+    /// Route all subsequent output through a background writer.
+    ///
+    /// Array data is still encoded on the calling thread, but the
+    /// encoded bytes are written to file by \p writer.  Ownership of the
+    /// underlying file is shared with the pending output tasks, so this
+    /// object may be destroyed before its output is complete.  Use
+    /// AsyncWriter::fence() to wait for completion and to report errors.
+    ///
+    /// \param[in] writer Background writer.  Typically shared among all
+    ///    output files of a run to preserve the order of operations.
+    void setAsyncWriter(std::shared_ptr<AsyncWriter> writer);
+
+    /// Maintain an array index sidecar, <filename>.ARRIDX, for this file.
+    ///
+    /// The sidecar describes all arrays of the file, including those
+    /// which existed before the file was opened, and spares readers the
+    /// scan over all array headers.  It is written when this object is
+    /// destroyed, in asynchronous mode once all output is complete.
+    ///
+    /// Must be called before setAsyncWriter().
+    void enableArrayIndex();
+
     friend class OutputStream::Restart;
     friend class OutputStream::SummarySpecification;
 
 private:
+    /// Staging buffer for encoded output in asynchronous mode.
+    class Staging;
+
     void writeBinaryHeader(const std::string& arrName, int64_t size, eclArrType arrType, int element_size);
 
     template <typename T>
@@ -105,13 +150,53 @@ private:
     void writeFormattedCharArray(const std::vector<PaddedOutputString<8>>& data);
 
     void writeArrayType(const eclArrType arrType);
-    std::string make_real_string_ecl(float value) const;
-    std::string make_real_string_ix(float value) const;
-    std::string make_doub_string_ecl(double value) const;
-    std::string make_doub_string_ix(double value) const;
+
+    /// Output stream of encoded data.  File stream in synchronous mode,
+    /// staging buffer in asynchronous mode.
+    std::ostream& sink();
+
+    /// Whether or not the underlying file is open for writing.
+    bool isOpen() const;
+
+    /// Hand encoded data in staging buffer over to background writer.
+    /// No-op in synchronous mode or if less than \p minSize bytes have
+    /// been staged.
+    void submitStaged(const std::size_t minSize = 0);
+
+    /// Place output position at start of file.
+    void rewind();
+
+    /// Current output position.  Only maintained while an array index
+    /// is enabled.
+    std::uint64_t position();
+
+    /// Record array in the array index, if enabled.
+    void indexArray(std::uint64_t      headerPosition,
+                    const std::string& arrName,
+                    std::int64_t       size,
+                    eclArrType         arrType,
+                    int                element_size);
+
+    /// Write array index sidecar, if enabled.  Called from the destructor,
+    /// so failures are ignored.
+    void writeArrayIndex() noexcept;
 
     bool isFormatted, ix_standard;
     std::ofstream ofileH;
+
+    std::string fileName_{};
+    std::shared_ptr<AsyncWriter> writer_{};
+    std::shared_ptr<std::ofstream> asyncFile_{};
+    std::unique_ptr<Staging> staging_{};
+
+    /// Entries of array index sidecar.  Null unless enabled.
+    std::unique_ptr<std::vector<ArrayIndexEntry>> index_{};
+
+    /// File position of start of staging buffer in asynchronous mode.
+    std::uint64_t asyncPosition_{0};
+
+    /// SEQNUM value of current report step, -1 before first SEQNUM.
+    int reportStep_{-1};
 };
 
 
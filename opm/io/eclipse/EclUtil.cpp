@@ -20,21 +20,317 @@
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/ParallelFor.hpp>
 
 #include <algorithm>
 #include <array>
+#include <charconv>
+#include <cerrno>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #ifdef _MSC_VER
 #include <intrin.h>
 #endif
 
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define OPM_ECLUTIL_SSSE3 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OPM_ECLUTIL_SSE2 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define OPM_ECLUTIL_NEON 1
+#endif
+
+// Floating-point std::from_chars() is missing from libc++ before LLVM 20.
+#if (defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)) \
+    || (defined(_LIBCPP_VERSION) && (_LIBCPP_VERSION >= 200000))     \
+    || defined(_MSC_VER)
+#define OPM_ECLUTIL_FP_FROM_CHARS 1
+#endif
+
+namespace {
+
+    std::uint32_t byteSwap(const std::uint32_t x)
+    {
+#ifdef _MSC_VER
+        return _byteswap_ulong(x);
+#else
+        return __builtin_bswap32(x);
+#endif
+    }
+
+    std::uint64_t byteSwap(const std::uint64_t x)
+    {
+#ifdef _MSC_VER
+        return _byteswap_uint64(x);
+#else
+        return __builtin_bswap64(x);
+#endif
+    }
+
+    /// Byte swap trailing elements not handled by the vector kernels.
+    template <typename UInt>
+    void flipEndianScalar(unsigned char* p, const std::size_t n)
+    {
+        for (auto i = 0*n; i < n; ++i, p += sizeof(UInt)) {
+            UInt x;
+            std::memcpy(&x, p, sizeof x);
+            x = byteSwap(x);
+            std::memcpy(p, &x, sizeof x);
+        }
+    }
+
+    /// Byte swap 16-byte chunks of elements of size \p ElmSize.
+    ///
+    /// \return Number of bytes processed.  Always a multiple of 16.
+    template <int ElmSize>
+    std::size_t flipEndianVector([[maybe_unused]] unsigned char* p,
+                                 [[maybe_unused]] const std::size_t nbytes)
+    {
+        auto i = std::size_t{0};
+
+#if defined(OPM_ECLUTIL_SSSE3)
+        const auto mask = (ElmSize == 4)
+            ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+            : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+        for (; i + 16 <= nbytes; i += 16) {
+            auto* v = reinterpret_cast<__m128i*>(p + i);
+            _mm_storeu_si128(v, _mm_shuffle_epi8(_mm_loadu_si128(v), mask));
+        }
+#elif defined(OPM_ECLUTIL_SSE2)
+        for (; i + 16 <= nbytes; i += 16) {
+            auto* v = reinterpret_cast<__m128i*>(p + i);
+            auto x = _mm_loadu_si128(v);
+
+            // Swap bytes within each 16-bit word, then reverse the order
+            // of the 16-bit words within each element.
+            x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+            if constexpr (ElmSize == 4) {
+                x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+                x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+            }
+            else {
+                x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(0, 1, 2, 3));
+                x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(0, 1, 2, 3));
+            }
+
+            _mm_storeu_si128(v, x);
+        }
+#elif defined(OPM_ECLUTIL_NEON)
+        for (; i + 16 <= nbytes; i += 16) {
+            const auto x = vld1q_u8(p + i);
+            if constexpr (ElmSize == 4) {
+                vst1q_u8(p + i, vrev32q_u8(x));
+            }
+            else {
+                vst1q_u8(p + i, vrev64q_u8(x));
+            }
+        }
+#endif
+
+        return i;
+    }
+
+    template <typename UInt>
+    void flipEndianArray(void* data, const std::size_t n)
+    {
+        auto* p = static_cast<unsigned char*>(data);
+        const auto nbytes = n * sizeof(UInt);
+
+        const auto done = flipEndianVector<sizeof(UInt)>(p, nbytes);
+
+        flipEndianScalar<UInt>(p + done, (nbytes - done) / sizeof(UInt));
+    }
+
+    /// Number of formatted array elements converted per parallel task.
+    constexpr auto formattedChunkSize = std::int64_t{1} << 14;
+
+    bool isBlank(const char c)
+    {
+        return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+    }
+
+    const char* skipBlanks(const char* p, const char* end)
+    {
+        while ((p != end) && isBlank(*p)) { ++p; }
+        return p;
+    }
+
+    const char* skipToken(const char* p, const char* end)
+    {
+        while ((p != end) && !isBlank(*p)) { ++p; }
+        return p;
+    }
+
+    [[noreturn]] void throwConversionError(const char* first, const char* last,
+                                           const std::string& type,
+                                           const std::errc ec)
+    {
+        const auto message = "Could not convert '" + std::string(first, last)
+            + "' to " + type + " value";
+
+        if (ec == std::errc::result_out_of_range) {
+            throw std::out_of_range(message);
+        }
+
+        throw std::invalid_argument(message);
+    }
+
+    // std::from_chars() does not accept a leading '+'.
+    const char* skipPlus(const char* first, const char* last)
+    {
+        return ((first != last) && (*first == '+')) ? first + 1 : first;
+    }
+
+    int parseInte(const char* first, const char* last)
+    {
+        auto value = 0;
+        const auto res = std::from_chars(skipPlus(first, last), last, value);
+
+        if (res.ec != std::errc{}) {
+            throwConversionError(first, last, "an integer", res.ec);
+        }
+
+        if (res.ptr != last) {
+            throwConversionError(first, last, "an integer", std::errc::invalid_argument);
+        }
+
+        return value;
+    }
+
+    /// Parse floating-point value which may use 'D' as exponent
+    /// character, or omit the exponent character altogether for
+    /// three-digit exponents, e.g., 0.1-100.
+    double parseDoub(const char* first, const char* last)
+    {
+        char buffer[64];
+
+        const auto* begin = skipPlus(first, last);
+        const auto len = last - begin;
+        if (len + 2 > static_cast<std::ptrdiff_t>(sizeof buffer)) {
+            throwConversionError(first, last, "a floating-point", std::errc::invalid_argument);
+        }
+
+        auto* out = buffer;
+        auto hasExpChar = false;
+        for (auto p = begin; p != last; ++p) {
+            const auto c = *p;
+
+            if ((c == 'D') || (c == 'd') || (c == 'E') || (c == 'e')) {
+                hasExpChar = true;
+                *out++ = 'E';
+            }
+            else if (((c == '-') || (c == '+')) && (p != begin) && !hasExpChar) {
+                hasExpChar = true;
+                *out++ = 'E';
+                *out++ = c;
+            }
+            else {
+                *out++ = c;
+            }
+        }
+
+#ifdef OPM_ECLUTIL_FP_FROM_CHARS
+        auto value = 0.0;
+        const auto res = std::from_chars(buffer, out, value);
+
+        if (res.ec != std::errc{}) {
+            throwConversionError(first, last, "a floating-point", res.ec);
+        }
+
+        const auto* end = res.ptr;
+#else
+        *out = '\0';
+
+        errno = 0;
+        char* end = nullptr;
+        const auto value = std::strtod(buffer, &end);
+
+        if ((end == buffer) || (errno == ERANGE)) {
+            throwConversionError(first, last, "a floating-point",
+                                 (end == buffer) ? std::errc::invalid_argument
+                                                 : std::errc::result_out_of_range);
+        }
+#endif
+
+        // Reject trailing characters, e.g., "1.5E+03xyz".
+        if (end != out) {
+            throwConversionError(first, last, "a floating-point", std::errc::invalid_argument);
+        }
+
+        return value;
+    }
+
+    /// Convert size whitespace separated elements of file_str, starting
+    /// at position fromPos.  Conversion of large arrays runs in parallel
+    /// over chunks of formattedChunkSize elements, the start positions of
+    /// which are found in a serial scan.
+    template <typename T, typename Parse>
+    std::vector<T> parseFormattedArray(const std::string& file_str,
+                                       const std::int64_t size,
+                                       const std::int64_t fromPos,
+                                       Parse&&            parse)
+    {
+        std::vector<T> arr(size);
+
+        const auto* end = file_str.data() + file_str.size();
+
+        std::vector<const char*> chunkStart;
+        chunkStart.reserve(size / formattedChunkSize + 1);
+
+        const auto* p = file_str.data() + fromPos;
+        for (auto i = 0*size; i < size; ++i) {
+            p = skipBlanks(p, end);
+
+            if (p == end) {
+                OPM_THROW(std::runtime_error,
+                          "Formatted array ends after " + std::to_string(i)
+                          + " of " + std::to_string(size) + " elements");
+            }
+
+            if ((i % formattedChunkSize) == 0) {
+                chunkStart.push_back(p);
+            }
+
+            p = skipToken(p, end);
+        }
+
+        const auto numChunks = static_cast<std::int64_t>(chunkStart.size());
+
+        Opm::utility::parallelFor(numChunks, [&](const std::int64_t c)
+        {
+            const auto begin = c * formattedChunkSize;
+            const auto stop = std::min(begin + formattedChunkSize, size);
+
+            const auto* first = chunkStart[c];
+            for (auto i = begin; i < stop; ++i) {
+                first = skipBlanks(first, end);
+
+                const auto* last = skipToken(first, end);
+                arr[i] = parse(first, last);
+
+                first = last;
+            }
+        });
+
+        return arr;
+    }
+
+} // Anonymous namespace
+
 int Opm::EclIO::flipEndianInt(int num)
 {
 #ifdef _MSC_VER
@@ -78,6 +374,16 @@ double Opm::EclIO::flipEndianDouble(double num)
     return value;
 }
 
+void Opm::EclIO::flipEndianArray32(void* data, const std::size_t n)
+{
+    flipEndianArray<std::uint32_t>(data, n);
+}
+
+void Opm::EclIO::flipEndianArray64(void* data, const std::size_t n)
+{
+    flipEndianArray<std::uint64_t>(data, n);
+}
+
 bool Opm::EclIO::fileExists(const std::string& filename){
 
     std::ifstream fileH(filename.c_str());
@@ -505,53 +811,141 @@ std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const std::int64
 }
 
 
+namespace {
+
+    /// Upper bound on size of intermediate buffer used when reading
+    /// numeric arrays.
+    constexpr auto maxReadBufferSize = std::int64_t{1} << 23;
+
+    /// Read binary array of numeric (INTE, REAL, DOUB, or raw LOGI)
+    /// elements.
+    ///
+    /// Reads as many complete records as fit in an intermediate buffer in
+    /// a single operation, validates the record markers, and copies the
+    /// payload into the result array before converting it to native byte
+    /// order.
+    template <typename T>
+    std::vector<T> readBinaryNumericArray(std::fstream&                fileH,
+                                          const std::int64_t           size,
+                                          const Opm::EclIO::eclArrType type)
+    {
+        static_assert((sizeof(T) == 4) || (sizeof(T) == 8),
+                      "Numeric array elements must be 4 or 8 bytes");
+
+        const auto sizeData = Opm::EclIO::block_size_data_binary(type);
+        const auto maxNumberOfElements =
+            static_cast<std::int64_t>(std::get<1>(sizeData) / std::get<0>(sizeData));
+
+        const auto elementSize = static_cast<std::int64_t>(sizeof(T));
+        const auto markerSize = static_cast<std::int64_t>(sizeof(int));
+        const auto maxRecordSize = maxNumberOfElements*elementSize + 2*markerSize;
+        const auto recordsPerRead = std::max(std::int64_t{1}, maxReadBufferSize / maxRecordSize);
+
+        auto arr = std::vector<T>(size);
+        auto buffer = std::vector<char>{};
+
+        auto offset = std::int64_t{0};
+        while (offset < size) {
+            // Number of records and elements in this read operation,
+            // assuming a well-formed file.
+            const auto numRemaining = size - offset;
+            const auto numRecords = std::min(recordsPerRead,
+                                             (numRemaining + maxNumberOfElements - 1) / maxNumberOfElements);
+            const auto numElements = std::min(numRemaining, numRecords * maxNumberOfElements);
+
+            buffer.resize(numElements*elementSize + numRecords*2*markerSize);
+            fileH.read(buffer.data(), buffer.size());
+
+            if (! fileH) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file");
+            }
+
+            const auto* rec = buffer.data();
+            auto* dest = reinterpret_cast<char*>(arr.data() + offset);
+
+            for (auto r = 0*numRecords; r < numRecords; ++r) {
+                int dhead;
+                std::memcpy(&dhead, rec, sizeof dhead);
+                dhead = Opm::EclIO::flipEndianInt(dhead);
+
+                const auto num = std::min(maxNumberOfElements, numRemaining - r*maxNumberOfElements);
+                if (dhead != num*elementSize) {
+                    OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+                }
+
+                std::memcpy(dest, rec + markerSize, dhead);
+
+                int dtail;
+                std::memcpy(&dtail, rec + markerSize + dhead, sizeof dtail);
+                dtail = Opm::EclIO::flipEndianInt(dtail);
+
+                if (dhead != dtail) {
+                    OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
+                }
+
+                rec  += dhead + 2*markerSize;
+                dest += dhead;
+            }
+
+            // Logical values are interpreted in on-disk byte order.
+            if (type != Opm::EclIO::LOGI) {
+                if constexpr (sizeof(T) == 4) {
+                    Opm::EclIO::flipEndianArray32(arr.data() + offset, numElements);
+                }
+                else {
+                    Opm::EclIO::flipEndianArray64(arr.data() + offset, numElements);
+                }
+            }
+
+            offset += numElements;
+        }
+
+        return arr;
+    }
+
+} // Anonymous namespace
+
 std::vector<int> Opm::EclIO::readBinaryInteArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f, sizeOfInte);
+    return readBinaryNumericArray<int>(fileH, size, Opm::EclIO::INTE);
 }
 
 
 std::vector<float> Opm::EclIO::readBinaryRealArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f, sizeOfReal);
+    return readBinaryNumericArray<float>(fileH, size, Opm::EclIO::REAL);
 }
 
 
 std::vector<double> Opm::EclIO::readBinaryDoubArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f, sizeOfDoub);
+    return readBinaryNumericArray<double>(fileH, size, Opm::EclIO::DOUB);
 }
 
 std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<bool(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              bool value = false;
-                                              if (intVal == Opm::EclIO::true_value_ecl) {
-                                                  value = true;
-                                              } else if (intVal == Opm::EclIO::false_value) {
-                                                  value = false;
-                                              } else if (intVal == Opm::EclIO::true_value_ix) {
-                                                  value = true;
-                                              } else {
-                                                  OPM_THROW(std::runtime_error, "Error reading logi value");
-                                              }
-
-                                              return value;
-                                          };
-    return readBinaryArray<bool,unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
+    const auto raw = readBinaryNumericArray<unsigned int>(fileH, size, Opm::EclIO::LOGI);
+
+    std::vector<bool> arr(raw.size());
+    for (auto i = 0*raw.size(); i < raw.size(); ++i) {
+        const auto intVal = raw[i];
+
+        if ((intVal == Opm::EclIO::true_value_ecl) ||
+            (intVal == Opm::EclIO::true_value_ix))
+        {
+            arr[i] = true;
+        }
+        else if (intVal != Opm::EclIO::false_value) {
+            OPM_THROW(std::runtime_error, "Error reading logi value");
+        }
+    }
+
+    return arr;
 }
 
 std::vector<unsigned int> Opm::EclIO::readBinaryRawLogiArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<unsigned int(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              return intVal;
-                                          };
-    return readBinaryArray<unsigned int, unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
+    return readBinaryNumericArray<unsigned int>(fileH, size, Opm::EclIO::LOGI);
 }
 
 
@@ -603,16 +997,9 @@ std::vector<T> Opm::EclIO::readFormattedArray(const std::string& file_str, const
 
 std::vector<int> Opm::EclIO::readFormattedInteArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
-
-    std::function<int(const std::string&)> f = [](const std::string& val)
-                                               {
-                                                   return std::stoi(val);
-                                               };
-
-    return readFormattedArray(file_str, size, fromPos, f);
+    return parseFormattedArray<int>(file_str, size, fromPos, parseInte);
 }
 
-
 std::vector<std::string> Opm::EclIO::readFormattedCharArray(const std::string& file_str, const std::int64_t size,
                                                             std::int64_t fromPos, int elementSize)
 {
@@ -640,16 +1027,13 @@ std::vector<std::string> Opm::EclIO::readFormattedCharArray(const std::string& f
 
 std::vector<float> Opm::EclIO::readFormattedRealArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
-
-    std::function<float(const std::string&)> f = [](const std::string& val)
-                                                 {
-                                                     // tskille: temporary fix, need to be discussed. OPM flow writes numbers
-                                                     // that are outside valid range for float, and function stof will fail
-                                                     double dtmpv = std::stod(val);
-                                                     return dtmpv;
-                                                 };
-
-    return readFormattedArray<float>(file_str, size, fromPos, f);
+    // tskille: temporary fix, need to be discussed. OPM flow writes numbers
+    // that are outside valid range for float, so convert as double.
+    return parseFormattedArray<float>(file_str, size, fromPos,
+                                      [](const char* first, const char* last)
+                                      {
+                                          return static_cast<float>(parseDoub(first, last));
+                                      });
 }
 
 std::vector<std::string> Opm::EclIO::readFormattedRealRawStrings(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
@@ -667,44 +1051,25 @@ std::vector<std::string> Opm::EclIO::readFormattedRealRawStrings(const std::stri
 
 std::vector<bool> Opm::EclIO::readFormattedLogiArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
-
-    std::function<bool(const std::string&)> f = [](const std::string& val)
+    // Convert through char since concurrent writes to distinct elements
+    // of a std::vector<bool> are not thread safe.
+    const auto logi = parseFormattedArray<char>(file_str, size, fromPos,
+                                                [](const char* first, const char* last) -> char
                                                 {
-                                                    if (val[0] == 'T') {
+                                                    if (*first == 'T') {
                                                         return true;
-                                                    } else if (val[0] == 'F') {
+                                                    } else if (*first == 'F') {
                                                         return false;
                                                     } else {
-                                                        std::string message="Could not convert '" + val + "' to a bool value ";
+                                                        std::string message="Could not convert '" + std::string(first, last) + "' to a bool value ";
                                                         OPM_THROW(std::invalid_argument, message);
                                                     }
-                                                };
+                                                });
 
-    return readFormattedArray<bool>(file_str, size, fromPos, f);
+    return { logi.begin(), logi.end() };
 }
 
 std::vector<double> Opm::EclIO::readFormattedDoubArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
-
-    std::function<double(const std::string&)> f = [](std::string val)
-                                                  {
-                                                      auto p1 = val.find_first_of("D");
-
-                                                      if (p1 != std::string::npos) {
-                                                          val.replace(p1,1,"E");
-                                                      }
-
-                                                      p1 = val.find_first_of("E");
-
-                                                      if (p1 == std::string::npos) {
-                                                          auto p2 = val.find_first_of("-+", 1);
-
-                                                          if (p2 != std::string::npos)
-                                                              val = val.insert(p2,"E");
-                                                      }
-                                                      return std::stod(val);
-                                                  };
-
-    return readFormattedArray<double>(file_str, size, fromPos, f);
+    return parseFormattedArray<double>(file_str, size, fromPos, parseDoub);
 }
-
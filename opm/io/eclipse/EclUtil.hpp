@@ -22,6 +22,7 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -34,6 +35,21 @@ namespace Opm { namespace EclIO {
     std::int64_t flipEndianLongInt(std::int64_t num);
     float flipEndianFloat(float num);
     double flipEndianDouble(double num);
+
+    /// Reverse byte order of each of \p n consecutive 4-byte elements, in
+    /// place.  Converts arrays of INTE, REAL, or LOGI elements between
+    /// native and on-disk (big-endian) representation.
+    ///
+    /// Uses SSE2/SSSE3 or NEON instructions when available.
+    void flipEndianArray32(void* data, std::size_t n);
+
+    /// Reverse byte order of each of \p n consecutive 8-byte elements, in
+    /// place.  Converts arrays of DOUB elements between native and on-disk
+    /// (big-endian) representation.
+    ///
+    /// Uses SSE2/SSSE3 or NEON instructions when available.
+    void flipEndianArray64(void* data, std::size_t n);
+
     bool isEOF(std::fstream* fileH);
     bool fileExists(const std::string& filename);
     bool isFormatted(const std::string& filename);
@@ -21,6 +21,7 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 
+#include <opm/io/eclipse/AsyncWriter.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 
@@ -209,12 +210,15 @@ namespace {
 // =====================================================================
 
 Opm::EclIO::OutputStream::Init::
-Init(const ResultSet& rset,
-     const Formatted& fmt)
+Init(const ResultSet&             rset,
+     const Formatted&             fmt,
+     std::shared_ptr<AsyncWriter> writer)
 {
     const auto fname = outputFileName(rset, FileExtension::init(fmt.set));
 
     this->open(fname, fmt.set);
+
+    this->stream_->setAsyncWriter(std::move(writer));
 }
 
 Opm::EclIO::OutputStream::Init::~Init()
@@ -288,20 +292,34 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 // =====================================================================
 
 Opm::EclIO::OutputStream::Restart::
-Restart(const ResultSet& rset,
-        const int        seqnum,
-        const Formatted& fmt,
-        const Unified&   unif)
+Restart(const ResultSet&             rset,
+        const int                    seqnum,
+        const Formatted&             fmt,
+        const Unified&               unif,
+        std::shared_ptr<AsyncWriter> writer,
+        const Indexed&               index)
 {
     const auto ext = FileExtension::
         restart(seqnum, fmt.set, unif.set);
 
     const auto fname = outputFileName(rset, ext);
 
+    if (writer != nullptr) {
+        // Existing file contents, e.g., the SEQNUM positions of a unified
+        // restart file, must be complete before we open the file.
+        writer->fence();
+    }
+
     if (unif.set) {
         // Run uses unified restart files.
         this->openUnified(fname, fmt.set, seqnum);
 
+        if (index.set) {
+            this->stream_->enableArrayIndex();
+        }
+
+        this->stream_->setAsyncWriter(std::move(writer));
+
         // Write SEQNUM value to stream to start new output sequence.
         this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
     }
@@ -309,6 +327,8 @@ Restart(const ResultSet& rset,
         // Run uses separate, not unified, restart files.  Create a
         // new output file and open an output stream on it.
         this->openNew(fname, fmt.set);
+
+        this->stream_->setAsyncWriter(std::move(writer));
     }
 }
 
@@ -474,13 +494,27 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 // =====================================================================
 
 Opm::EclIO::OutputStream::RFT::
-RFT(const ResultSet&    rset,
-    const Formatted&    fmt,
-    const OpenExisting& existing)
+RFT(const ResultSet&             rset,
+    const Formatted&             fmt,
+    const OpenExisting&          existing,
+    std::shared_ptr<AsyncWriter> writer,
+    const Indexed&               index)
 {
     const auto fname = outputFileName(rset, FileExtension::rft(fmt.set));
 
+    if (writer != nullptr) {
+        // Output from previous report steps must be complete before we
+        // reopen the file.
+        writer->fence();
+    }
+
     this->open(fname, fmt.set, existing.set);
+
+    if (index.set) {
+        this->stream_->enableArrayIndex();
+    }
+
+    this->stream_->setAsyncWriter(std::move(writer));
 }
 
 Opm::EclIO::OutputStream::RFT::~RFT()
@@ -695,12 +729,13 @@ Parameters::add(const std::string& keyword,
 }
 
 Opm::EclIO::OutputStream::SummarySpecification::
-SummarySpecification(const ResultSet&            rset,
-                     const Formatted&            fmt,
-                     const UnitConvention        uconv,
-                     const std::array<int,3>&    cartDims,
-                     const RestartSpecification& restart,
-                     const StartTime             start)
+SummarySpecification(const ResultSet&             rset,
+                     const Formatted&             fmt,
+                     const UnitConvention         uconv,
+                     const std::array<int,3>&     cartDims,
+                     const RestartSpecification&  restart,
+                     const StartTime              start,
+                     std::shared_ptr<AsyncWriter> writer)
     : unit_       (unitConvention(uconv))
     , restartStep_(makeRestartStep(restart))
     , cartDims_   (cartDims)
@@ -710,6 +745,7 @@ SummarySpecification(const ResultSet&            rset,
     const auto fname = outputFileName(rset, FileExtension::smspec(fmt.set));
 
     this->stream_ = Open::Smspec::write(fname, fmt.set);
+    this->stream_->setAsyncWriter(std::move(writer));
 }
 
 Opm::EclIO::OutputStream::SummarySpecification::~SummarySpecification()
@@ -771,9 +807,7 @@ SummarySpecification::write(const Parameters& params)
 void Opm::EclIO::OutputStream::SummarySpecification::rewindStream()
 {
     // Benefits from EclOutput friendship
-    const auto position = std::ofstream::pos_type{0};
-
-    this->stream().ofileH.seekp(position, std::ios_base::beg);
+    this->stream().rewind();
 }
 
 void Opm::EclIO::OutputStream::SummarySpecification::flushStream()
@@ -790,19 +824,29 @@ Opm::EclIO::OutputStream::SummarySpecification::stream()
 // =====================================================================
 
 std::unique_ptr<Opm::EclIO::EclOutput>
-Opm::EclIO::OutputStream::createSummaryFile(const ResultSet& rset,
-                                            const int        seqnum,
-                                            const Formatted& fmt,
-                                            const Unified&   unif)
+Opm::EclIO::OutputStream::createSummaryFile(const ResultSet&             rset,
+                                            const int                    seqnum,
+                                            const Formatted&             fmt,
+                                            const Unified&               unif,
+                                            std::shared_ptr<AsyncWriter> writer,
+                                            const Indexed&               index)
 {
     const auto ext = FileExtension::summary(seqnum, fmt.set, unif.set);
 
-    return std::unique_ptr<Opm::EclIO::EclOutput> {
+    auto stream = std::unique_ptr<Opm::EclIO::EclOutput> {
         new Opm::EclIO::EclOutput {
             outputFileName(rset, ext),
             fmt.set, std::ios_base::out
         }
     };
+
+    if (unif.set && index.set) {
+        stream->enableArrayIndex();
+    }
+
+    stream->setAsyncWriter(std::move(writer));
+
+    return stream;
 }
 
 // =====================================================================
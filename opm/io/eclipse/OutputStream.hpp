@@ -32,6 +32,7 @@
 
 namespace Opm { namespace EclIO {
 
+    class AsyncWriter;
     class EclOutput;
 
 }} // namespace Opm::EclIO
@@ -41,6 +42,10 @@ namespace Opm { namespace EclIO { namespace OutputStream {
     struct Formatted { bool set; };
     struct Unified   { bool set; };
 
+    /// Whether or not to accompany unified output files with an array
+    /// index sidecar (see EclOutput::enableArrayIndex()).
+    struct Indexed   { bool set; };
+
     /// Abstract representation of an ECLIPSE-style result set.
     struct ResultSet
     {
@@ -62,8 +67,13 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] rset Output directory and base name of output stream.
         ///
         /// \param[in] fmt Whether or not to create formatted output files.
-        explicit Init(const ResultSet& rset,
-                      const Formatted& fmt);
+        ///
+        /// \param[in] writer Optional background writer.  If non-null,
+        ///    routes all output through \p writer whence the INIT arrays
+        ///    are written to file while subsequent arrays are assembled.
+        explicit Init(const ResultSet&             rset,
+                      const Formatted&             fmt,
+                      std::shared_ptr<AsyncWriter> writer = {});
 
         ~Init();
 
@@ -152,10 +162,19 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] fmt Whether or not to create formatted output files.
         ///
         /// \param[in] unif Whether or not to create unified output files.
-        explicit Restart(const ResultSet& rset,
-                         const int        seqnum,
-                         const Formatted& fmt,
-                         const Unified&   unif);
+        ///
+        /// \param[in] writer Optional background writer.  If non-null,
+        ///    waits for all pending output of \p writer before opening the
+        ///    restart file, and routes all output through \p writer.
+        ///
+        /// \param[in] index Whether or not to maintain an array index
+        ///    sidecar of a unified restart file.
+        explicit Restart(const ResultSet&             rset,
+                         const int                    seqnum,
+                         const Formatted&             fmt,
+                         const Unified&               unif,
+                         std::shared_ptr<AsyncWriter> writer = {},
+                         const Indexed&               index = Indexed { false });
 
         ~Restart();
 
@@ -294,9 +313,18 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] fmt Whether or not to create formatted output files.
         ///
         /// \param[in] existing Whether or not to open an existing output file.
-        explicit RFT(const ResultSet&    rset,
-                     const Formatted&    fmt,
-                     const OpenExisting& existing);
+        ///
+        /// \param[in] writer Optional background writer.  If non-null,
+        ///    waits for all pending output of \p writer before opening the
+        ///    RFT file, and routes all output through \p writer.
+        ///
+        /// \param[in] index Whether or not to maintain an array index
+        ///    sidecar of the RFT file.
+        explicit RFT(const ResultSet&             rset,
+                     const Formatted&             fmt,
+                     const OpenExisting&          existing,
+                     std::shared_ptr<AsyncWriter> writer = {},
+                     const Indexed&               index = Indexed { false });
 
         ~RFT();
 
@@ -396,12 +424,13 @@ namespace Opm { namespace EclIO { namespace OutputStream {
             std::vector<PaddedOutputString<8>> units{};
         };
 
-        explicit SummarySpecification(const ResultSet&            rset,
-                                      const Formatted&            fmt,
-                                      const UnitConvention        uconv,
-                                      const std::array<int,3>&    cartDims,
-                                      const RestartSpecification& restart,
-                                      const StartTime             start);
+        explicit SummarySpecification(const ResultSet&             rset,
+                                      const Formatted&             fmt,
+                                      const UnitConvention         uconv,
+                                      const std::array<int,3>&     cartDims,
+                                      const RestartSpecification&  restart,
+                                      const StartTime              start,
+                                      std::shared_ptr<AsyncWriter> writer = {});
 
         ~SummarySpecification();
 
@@ -429,11 +458,20 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         EclOutput& stream();
     };
 
+    /// Create summary (UNSMRY or Snnnn) file output stream.
+    ///
+    /// \param[in] writer Optional background writer through which to
+    ///    route all output to the new stream.
+    ///
+    /// \param[in] index Whether or not to accompany an UNSMRY file with an
+    ///    array index sidecar, written when the stream is closed.
     std::unique_ptr<EclOutput>
-    createSummaryFile(const ResultSet& rset,
-                      const int        seqnum,
-                      const Formatted& fmt,
-                      const Unified&   unif);
+    createSummaryFile(const ResultSet&             rset,
+                      const int                    seqnum,
+                      const Formatted&             fmt,
+                      const Unified&               unif,
+                      std::shared_ptr<AsyncWriter> writer = {},
+                      const Indexed&               index = Indexed { false });
 
     /// Derive filename corresponding to output stream of particular result
     /// set, with user-specified file extension.
@@ -24,6 +24,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -115,10 +116,22 @@ public:
     const std::vector<ElmType>&
     getKeyword(const std::string& vector, const int occurrence)
     {
+        // ERst loads the vectors on first access
+        std::lock_guard<std::mutex> lock{ this->mutex_ };
+
         return this->rst_file_->
             getRestartData<ElmType>(vector, this->report_step_, occurrence);
     }
 
+    void prefetch(const std::vector<std::string>& vectors)
+    {
+        if (this->rst_file_ == nullptr) { return; }
+
+        std::lock_guard<std::mutex> lock{ this->mutex_ };
+
+        this->rst_file_->loadReportStepNumber(this->report_step_, vectors);
+    }
+
     const std::vector<int>& intehead()
     {
         const auto ihkw = std::string { "INTEHEAD" };
@@ -170,6 +183,7 @@ private:
     int         report_step_;
     std::size_t sim_step_;
     TypedColl   vectors_;
+    std::mutex  mutex_{};
 
     bool collectionContains(const VectorColl&  coll,
                             const std::string& vector) const
@@ -211,7 +225,7 @@ Implementation(Implementation&& rhs)
     , report_step_(rhs.report_step_)
     , sim_step_   (rhs.sim_step_)            // Scalar (size_t)
     , vectors_    (std::move(rhs.vectors_))
-{}
+{}                                          // Mutex not moved
 
 Opm::EclIO::RestartFileView::Implementation&
 Opm::EclIO::RestartFileView::Implementation::operator=(Implementation&& rhs)
@@ -273,6 +287,11 @@ const std::vector<double>& Opm::EclIO::RestartFileView::doubhead() const
     return this->pImpl_->doubhead();
 }
 
+void Opm::EclIO::RestartFileView::prefetch(const std::vector<std::string>& vectors) const
+{
+    this->pImpl_->prefetch(vectors);
+}
+
 template <typename ElmType>
 bool Opm::EclIO::RestartFileView::hasKeyword(const std::string& vector) const
 {
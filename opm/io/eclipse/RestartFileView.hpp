@@ -53,10 +53,17 @@ public:
     template <typename ElmType>
     bool hasKeyword(const std::string& vector) const;
 
+    // Safe to call concurrently, e.g., from tasks which restore
+    // different parts of the simulator state.
     template <typename ElmType>
     const std::vector<ElmType>&
     getKeyword(const std::string& vector, const int occurrence = 0) const;
 
+    // Load the named vectors of the report step in one parallel pass
+    // through the file instead of one read per getKeyword() call.
+    // Vectors which do not exist are ignored.
+    void prefetch(const std::vector<std::string>& vectors) const;
+
     const std::vector<int>& intehead() const;
     const std::vector<bool>& logihead() const;
     const std::vector<double>& doubhead() const;
@@ -39,10 +39,13 @@
 #include <opm/material/Constants.hpp>
 #include <opm/material/eos/PengRobinsonMixture.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <dune/common/fvector.hh>
 #include <dune/common/fmatrix.hh>
 #include <dune/common/classname.hh>
 
+#include <iterator>
 #include <limits>
 #include <iostream>
 #include <iomanip>
@@ -79,6 +82,48 @@ public:
                       const std::string& twoPhaseMethod,
                       Scalar flash_tolerance,
                       int verbosity = 0)
+    {
+        solveCell_(fluid_state, twoPhaseMethod, flash_tolerance,
+                   /*checkCriticalRegion=*/false, verbosity);
+    } // end solve
+
+    /*!
+     * \brief Calculates the fluid states of a batch of cells.
+     *
+     * Every fluid state provides pressure, temperature and global mole
+     * fractions, and the K-values and L of the previous solution of the
+     * cell.  The previous solution is the initial guess of the two-phase
+     * solver.  The stability test is skipped for cells which were two-phase
+     * and whose K-values are far from the trivial solution, i.e., cells
+     * which are not close to the critical region.  Cells closer to it are
+     * tested again, starting from Wilson's K-values.
+     *
+     * Cells are solved in parallel if OpenMP is enabled.  If the flash fails
+     * in any cell, the exception of the first failing cell is rethrown once
+     * all cells have been processed.
+     */
+    template <class FluidStateContainer>
+    static void solveBatch(FluidStateContainer& fluid_states,
+                           const std::string& twoPhaseMethod,
+                           Scalar flash_tolerance,
+                           int verbosity = 0)
+    {
+        const auto numCells = static_cast<int>(std::size(fluid_states));
+
+        utility::parallelFor(numCells, [&](const int cellIdx)
+        {
+            solveCell_(fluid_states[cellIdx], twoPhaseMethod, flash_tolerance,
+                       /*checkCriticalRegion=*/true, verbosity);
+        }, 64);
+    }
+
+private:
+    template <class FluidState>
+    static void solveCell_(FluidState& fluid_state,
+                           const std::string& twoPhaseMethod,
+                           const Scalar flash_tolerance,
+                           const bool checkCriticalRegion,
+                           const int verbosity)
     {
         using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
         ScalarFluidState fluid_state_scalar;
@@ -97,7 +142,8 @@ public:
 
         fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
 
-        const auto is_single_phase = flash_solve_scalar_(fluid_state_scalar, twoPhaseMethod, flash_tolerance, verbosity);
+        const auto is_single_phase = flash_solve_scalar_(fluid_state_scalar, twoPhaseMethod, flash_tolerance,
+                                                         verbosity, checkCriticalRegion);
 
         // the flash solution process were performed in scalar form, after the flash calculation finishes,
         // ensure that things in fluid_state_scalar is transformed to fluid_state
@@ -110,7 +156,9 @@ public:
 
         // we update the derivatives in fluid_state
         updateDerivatives_(fluid_state_scalar, fluid_state, is_single_phase);
-    } // end solve
+    } // end solveCell_
+
+public:
 
     /*!
      * \brief Calculates the chemical equilibrium from the component
@@ -223,7 +271,8 @@ public:
     static bool flash_solve_scalar_(FluidState& fluid_state,
                                     const std::string& twoPhaseMethod,
                                     const Scalar flash_tolerance,
-                                    const int verbosity = 0)
+                                    const int verbosity = 0,
+                                    const bool checkCriticalRegion = false)
     {
         // Do a stability test to check if cell is is_single_phase-phase (do for all cells the first time).
         bool is_stable = false;
@@ -241,6 +290,17 @@ public:
             }
             phaseStabilityTest_(is_stable, K_scalar, fluid_state, z_scalar, verbosity);
         }
+        else if (checkCriticalRegion && nearCriticalRegion_(K_scalar)) {
+            // The previous K-values are close to the trivial solution, which
+            // the two-phase solver might converge to.  Restart from Wilson.
+            if (verbosity >= 1) {
+                std::cout << "Perform stability test (close to critical region)!" << std::endl;
+            }
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                K_scalar[compIdx] = wilsonK_(fluid_state, compIdx);
+            }
+            phaseStabilityTest_(is_stable, K_scalar, fluid_state, z_scalar, verbosity);
+        }
         if (verbosity >= 1) {
             std::cout << "Inputs after stability test are K = [" << K_scalar << "], L = [" << L_scalar << "], z = [" << z_scalar << "], P = " << fluid_state.pressure(0) << ", and T = " << fluid_state.temperature(0) << std::endl;
         }
@@ -420,6 +480,27 @@ protected:
         return tmp;
     }
 
+    /*!
+     * \brief Whether K-values are so close to one that the two-phase
+     *        solution may collapse into the trivial solution.
+     *
+     * Uses the same measure, sum of squared log K-values, as the trivial
+     * solution check of the stability test, with a wider threshold.
+     */
+    template <class Vector>
+    static bool nearCriticalRegion_(const Vector& K)
+    {
+        constexpr Scalar criticalRegionKNorm = 0.1;
+
+        Scalar K_norm = 0.0;
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const auto b = Opm::log(Opm::getValue(K[compIdx]));
+            K_norm += b*b;
+        }
+
+        return K_norm < criticalRegionKNorm;
+    }
+
     template <class Vector>
     static typename Vector::field_type rachfordRice_g_(const Vector& K, typename Vector::field_type L, const Vector& z)
     {
@@ -306,14 +306,17 @@ public:
         assert(size() == other.size());
 
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
-        // u'v)/v^2.
+        // u'v)/v^2. the derivatives are computed as u'/v - v'*u/v^2, which needs a single
+        // division instead of one per derivative.
         ValueType& u = data_[valuepos_()];
         const ValueType& v = other.value();
+        const ValueType vInv = 1.0/v;
+        const ValueType uvInv2 = u*vInv*vInv;
         for (int idx = dstart_(); idx < dend_(); ++idx) {
             const ValueType& uPrime = data_[idx];
             const ValueType& vPrime = other.data_[idx];
 
-            data_[idx] = (v*uPrime - u*vPrime)/(v*v);
+            data_[idx] = uPrime*vInv - vPrime*uvInv2;
         }
         u /= v;
 
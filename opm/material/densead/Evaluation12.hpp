@@ -41,6 +41,7 @@
 #include <stdexcept>
 
 #include <opm/common/utility/gpuDecorators.hpp>
+#include <opm/material/densead/EvaluationSimd.hpp>
 
 namespace Opm {
 namespace DenseAd {
@@ -317,6 +318,11 @@ public:
         data_[valuepos_()] *= v ;
 
         //  derivatives
+#if OPM_DENSEAD_SIMD
+        const auto productRule = [u, v](const auto& uPrime, const auto& vPrime)
+        { return uPrime * v + vPrime * u; };
+        detail::simdTransform<12>(&data_[1], &other.data_[1], productRule);
+#else
         data_[1] = data_[1] * v + other.data_[1] * u;
         data_[2] = data_[2] * v + other.data_[2] * u;
         data_[3] = data_[3] * v + other.data_[3] * u;
@@ -329,6 +335,7 @@ public:
         data_[10] = data_[10] * v + other.data_[10] * u;
         data_[11] = data_[11] * v + other.data_[11] * u;
         data_[12] = data_[12] * v + other.data_[12] * u;
+#endif
 
         return *this;
     }
@@ -360,21 +367,30 @@ public:
         assert(size() == other.size());
 
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
-        // u'v)/v^2.
+        // u'v)/v^2. the derivatives are computed as u'/v - v'*u/v^2, which needs a single
+        // division instead of one per derivative.
         ValueType& u = data_[valuepos_()];
         const ValueType& v = other.value();
-        data_[1] = (v*data_[1] - u*other.data_[1])/(v*v);
-        data_[2] = (v*data_[2] - u*other.data_[2])/(v*v);
-        data_[3] = (v*data_[3] - u*other.data_[3])/(v*v);
-        data_[4] = (v*data_[4] - u*other.data_[4])/(v*v);
-        data_[5] = (v*data_[5] - u*other.data_[5])/(v*v);
-        data_[6] = (v*data_[6] - u*other.data_[6])/(v*v);
-        data_[7] = (v*data_[7] - u*other.data_[7])/(v*v);
-        data_[8] = (v*data_[8] - u*other.data_[8])/(v*v);
-        data_[9] = (v*data_[9] - u*other.data_[9])/(v*v);
-        data_[10] = (v*data_[10] - u*other.data_[10])/(v*v);
-        data_[11] = (v*data_[11] - u*other.data_[11])/(v*v);
-        data_[12] = (v*data_[12] - u*other.data_[12])/(v*v);
+        const ValueType vInv = 1.0/v;
+        const ValueType uvInv2 = u*vInv*vInv;
+#if OPM_DENSEAD_SIMD
+        const auto quotientRule = [vInv, uvInv2](const auto& uPrime, const auto& vPrime)
+        { return uPrime*vInv - vPrime*uvInv2; };
+        detail::simdTransform<12>(&data_[1], &other.data_[1], quotientRule);
+#else
+        data_[1] = data_[1]*vInv - other.data_[1]*uvInv2;
+        data_[2] = data_[2]*vInv - other.data_[2]*uvInv2;
+        data_[3] = data_[3]*vInv - other.data_[3]*uvInv2;
+        data_[4] = data_[4]*vInv - other.data_[4]*uvInv2;
+        data_[5] = data_[5]*vInv - other.data_[5]*uvInv2;
+        data_[6] = data_[6]*vInv - other.data_[6]*uvInv2;
+        data_[7] = data_[7]*vInv - other.data_[7]*uvInv2;
+        data_[8] = data_[8]*vInv - other.data_[8]*uvInv2;
+        data_[9] = data_[9]*vInv - other.data_[9]*uvInv2;
+        data_[10] = data_[10]*vInv - other.data_[10]*uvInv2;
+        data_[11] = data_[11]*vInv - other.data_[11]*uvInv2;
+        data_[12] = data_[12]*vInv - other.data_[12]*uvInv2;
+#endif
         u /= v;
 
         return *this;
@@ -300,11 +300,14 @@ public:
         assert(size() == other.size());
 
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
-        // u'v)/v^2.
+        // u'v)/v^2. the derivatives are computed as u'/v - v'*u/v^2, which needs a single
+        // division instead of one per derivative.
         ValueType& u = data_[valuepos_()];
         const ValueType& v = other.value();
-        data_[1] = (v*data_[1] - u*other.data_[1])/(v*v);
-        data_[2] = (v*data_[2] - u*other.data_[2])/(v*v);
+        const ValueType vInv = 1.0/v;
+        const ValueType uvInv2 = u*vInv*vInv;
+        data_[1] = data_[1]*vInv - other.data_[1]*uvInv2;
+        data_[2] = data_[2]*vInv - other.data_[2]*uvInv2;
         u /= v;
 
         return *this;
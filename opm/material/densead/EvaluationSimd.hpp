@@ -0,0 +1,101 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Explicitly vectorized kernels for the derivatives of the
+ *        statically sized dense-AD Evaluation specializations.
+ *
+ * The kernels are used if OPM_DENSEAD_SIMD is nonzero.  Unless defined by
+ * the user, it is enabled if the standard library provides
+ * <experimental/simd> and the code is not compiled for a GPU.  Otherwise
+ * the specializations use their unrolled scalar loops.
+ */
+#ifndef OPM_DENSEAD_EVALUATION_SIMD_HPP
+#define OPM_DENSEAD_EVALUATION_SIMD_HPP
+
+#ifndef OPM_DENSEAD_SIMD
+#if defined(__CUDACC__) || defined(__HIPCC__)
+#define OPM_DENSEAD_SIMD 0
+#elif defined(__has_include)
+#if __has_include(<experimental/simd>) && __cplusplus >= 201703L
+#define OPM_DENSEAD_SIMD 1
+#else
+#define OPM_DENSEAD_SIMD 0
+#endif
+#else
+#define OPM_DENSEAD_SIMD 0
+#endif
+#endif
+
+#if OPM_DENSEAD_SIMD
+#include <algorithm>
+#include <experimental/simd>
+#include <type_traits>
+
+namespace Opm {
+namespace DenseAd {
+namespace detail {
+
+/*!
+ * \brief Compute a[i] = op(a[i], b[i]) for i in [0, n).
+ *
+ * Full registers of the native SIMD width, but at most 256 bits, are
+ * processed with vector instructions and the remainder element by element.
+ * Loads and stores are unaligned, as the derivatives follow the value in
+ * the storage of an Evaluation.  Value types which are not floating point
+ * numbers, e.g., nested Evaluations, always use the scalar loop.
+ */
+template <int n, class ValueType, class BinaryOp>
+inline void simdTransform(ValueType* a, const ValueType* b, BinaryOp op)
+{
+    int i = 0;
+
+    if constexpr (std::is_floating_point_v<ValueType>) {
+        // Registers wider than 256 bits do not pay off for the short
+        // derivative vectors, partly because results are often stored by
+        // scalar code right before they are loaded again.
+        namespace stdx = std::experimental;
+        constexpr int width = std::min(static_cast<int>(stdx::native_simd<ValueType>::size()),
+                                       static_cast<int>(32 / sizeof(ValueType)));
+        using Vector = stdx::simd<ValueType, stdx::simd_abi::deduce_t<ValueType, width>>;
+
+        for (; i + width <= n; i += width) {
+            const Vector x(a + i, stdx::element_aligned);
+            const Vector y(b + i, stdx::element_aligned);
+            op(x, y).copy_to(a + i, stdx::element_aligned);
+        }
+    }
+
+    for (; i < n; ++i) {
+        a[i] = op(a[i], b[i]);
+    }
+}
+
+} // namespace detail
+} // namespace DenseAd
+} // namespace Opm
+
+#endif // OPM_DENSEAD_SIMD
+
+#endif // OPM_DENSEAD_EVALUATION_SIMD_HPP
@@ -0,0 +1,172 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Inline approximations of the exponential function and the natural
+ *        logarithm with a bounded relative error.
+ *
+ * The dense-AD functions in Math.hpp use them for the values of exp(),
+ * log() and pow() of double and float Evaluations if OPM_DENSEAD_FAST_MATH
+ * is nonzero.  It defaults to zero, i.e., the functions of <cmath> are
+ * used.  The approximations are inlined into the callers, so they avoid
+ * the call into the math library and can be vectorized by the compiler
+ * together with the surrounding code, but they are less accurate than the
+ * correctly rounded library functions.
+ */
+#ifndef OPM_DENSEAD_FAST_MATH_HPP
+#define OPM_DENSEAD_FAST_MATH_HPP
+
+#ifndef OPM_DENSEAD_FAST_MATH
+#define OPM_DENSEAD_FAST_MATH 0
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace Opm {
+namespace DenseAd {
+
+/*!
+ * \brief Upper bound of the relative error of fastExp().
+ */
+constexpr double fastExpMaxRelativeError = 1e-11;
+
+/*!
+ * \brief Upper bound of the relative error of fastLog().
+ */
+constexpr double fastLogMaxRelativeError = 1e-11;
+
+/*!
+ * \brief Approximation of exp(x).
+ *
+ * The argument is reduced to x = k*ln(2) + r with |r| <= ln(2)/2, exp(r)
+ * is approximated by its Taylor polynomial of degree nine and 2^k is
+ * applied to the exponent bits of the result.  Arguments for which the
+ * result would not be a normalized double, infinities and NaNs are passed
+ * on to std::exp().
+ */
+inline double fastExp(const double x)
+{
+    if (!(x > -708.0 && x < 709.0)) {
+        return std::exp(x);
+    }
+
+    // ln(2) split into a part whose products with k are exact and the rest
+    constexpr double ln2Hi = 6.93147180369123816490e-01;
+    constexpr double ln2Lo = 1.90821492927058770002e-10;
+    constexpr double invLn2 = 1.44269504088896338700e+00;
+
+    // Adding and subtracting 1.5*2^52 rounds to the nearest integer
+    // without a call to std::nearbyint() for targets without SSE4.1.
+    constexpr double shifter = 6755399441055744.0;
+    double k = x*invLn2 + shifter;
+    k -= shifter;
+
+    const double r = (x - k*ln2Hi) - k*ln2Lo;
+
+    double p = 1.0/362880.0;
+    p = p*r + 1.0/40320.0;
+    p = p*r + 1.0/5040.0;
+    p = p*r + 1.0/720.0;
+    p = p*r + 1.0/120.0;
+    p = p*r + 1.0/24.0;
+    p = p*r + 1.0/6.0;
+    p = p*r + 0.5;
+    p = p*r + 1.0;
+    p = p*r + 1.0;
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &p, sizeof(bits));
+    bits += static_cast<std::uint64_t>(static_cast<std::int64_t>(k)) << 52;
+    std::memcpy(&p, &bits, sizeof(p));
+
+    return p;
+}
+
+/*!
+ * \brief Approximation of log(x).
+ *
+ * The argument is split into x = m*2^e with sqrt(1/2) < m <= sqrt(2) and
+ * log(m) = 2*atanh((m - 1)/(m + 1)) is approximated by the first seven
+ * terms of its series.  Subnormal, negative and non-finite arguments as
+ * well as zero are passed on to std::log().
+ */
+inline double fastLog(const double x)
+{
+    if (!(x >= std::numeric_limits<double>::min() && x <= std::numeric_limits<double>::max())) {
+        return std::log(x);
+    }
+
+    constexpr double ln2Hi = 6.93147180369123816490e-01;
+    constexpr double ln2Lo = 1.90821492927058770002e-10;
+    constexpr double sqrt2 = 1.41421356237309504880;
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    int e = static_cast<int>((bits >> 52) & 0x7ff) - 1023;
+    bits = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+
+    double m;
+    std::memcpy(&m, &bits, sizeof(m));
+    if (m > sqrt2) {
+        m *= 0.5;
+        ++e;
+    }
+
+    const double f = (m - 1.0)/(m + 1.0);
+    const double f2 = f*f;
+
+    double s = 1.0/13.0;
+    s = s*f2 + 1.0/11.0;
+    s = s*f2 + 1.0/9.0;
+    s = s*f2 + 1.0/7.0;
+    s = s*f2 + 1.0/5.0;
+    s = s*f2 + 1.0/3.0;
+
+    const double logM = 2.0*f + 2.0*f*f2*s;
+
+    return (e*ln2Hi + logM) + e*ln2Lo;
+}
+
+/*!
+ * \brief Approximation of exp(x) in single precision.
+ *
+ * Evaluated in double precision, so the result is correctly rounded in
+ * most cases.
+ */
+inline float fastExp(const float x)
+{ return static_cast<float>(fastExp(static_cast<double>(x))); }
+
+/*!
+ * \brief Approximation of log(x) in single precision.
+ */
+inline float fastLog(const float x)
+{ return static_cast<float>(fastLog(static_cast<double>(x))); }
+
+} // namespace DenseAd
+} // namespace Opm
+
+#endif // OPM_DENSEAD_FAST_MATH_HPP
@@ -33,16 +33,73 @@
 #define OPM_LOCAL_AD_MATH_HPP
 
 #include "Evaluation.hpp"
+#include "FastMath.hpp"
 
 #include <opm/material/common/MathToolbox.hpp>
 
 #include <opm/common/utility/gpuDecorators.hpp>
+
+#include <type_traits>
+
 namespace Opm {
 namespace DenseAd {
 // forward declaration of the Evaluation template class
 template <class ValueT, int numVars, unsigned staticSize>
 class Evaluation;
 
+namespace detail {
+
+// Evaluation of a function of x given its value f(x) and its derivative
+// df_dx(x). Scaling all of x by df_dx and overwriting the value afterwards
+// uses the (vectorized) scalar multiplication of the Evaluation.
+template <class ValueType, int numVars, unsigned staticSize>
+OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize>
+chainRule(const Evaluation<ValueType, numVars, staticSize>& x,
+          const typename Evaluation<ValueType, numVars, staticSize>::ValueType& f,
+          const typename Evaluation<ValueType, numVars, staticSize>::ValueType& df_dx)
+{
+    Evaluation<ValueType, numVars, staticSize> result(x);
+    result *= df_dx;
+    result.setValue(f);
+
+    return result;
+}
+
+// Whether the approximations of FastMath.hpp are used for a value type
+template <class ValueType>
+constexpr bool useFastMath()
+{
+#if OPM_DENSEAD_FAST_MATH && !OPM_IS_INSIDE_DEVICE_FUNCTION
+    return std::is_same_v<ValueType, double> || std::is_same_v<ValueType, float>;
+#else
+    return false;
+#endif
+}
+
+template <class ValueType>
+OPM_HOST_DEVICE ValueType expValue(const ValueType& x)
+{
+    if constexpr (useFastMath<ValueType>()) {
+        return fastExp(x);
+    }
+    else {
+        return MathToolbox<ValueType>::exp(x);
+    }
+}
+
+template <class ValueType>
+OPM_HOST_DEVICE ValueType logValue(const ValueType& x)
+{
+    if constexpr (useFastMath<ValueType>()) {
+        return fastLog(x);
+    }
+    else {
+        return MathToolbox<ValueType>::log(x);
+    }
+}
+
+} // namespace detail
+
 // provide some algebraic functions
 template <class ValueType, int numVars, unsigned staticSize>
 OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> abs(const Evaluation<ValueType, numVars, staticSize>& x)
@@ -99,17 +156,10 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> tan(const Evaluation<
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
     const ValueType& tmp = ValueTypeToolbox::tan(x.value());
-    result.setValue(tmp);
 
     // derivatives use the chain rule
-    const ValueType& df_dx = 1 + tmp*tmp;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, tmp, 1 + tmp*tmp);
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
@@ -117,16 +167,8 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> atan(const Evaluation
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::atan(x.value()));
-
     // derivatives use the chain rule
-    const ValueType& df_dx = 1/(1 + x.value()*x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::atan(x.value()), 1/(1 + x.value()*x.value()));
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
@@ -197,16 +239,8 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> sin(const Evaluation<
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::sin(x.value()));
-
     // derivatives use the chain rule
-    const ValueType& df_dx = ValueTypeToolbox::cos(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::sin(x.value()), ValueTypeToolbox::cos(x.value()));
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
@@ -214,16 +248,9 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> asin(const Evaluation
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::asin(x.value()));
-
     // derivatives use the chain rule
-    const ValueType& df_dx = 1.0/ValueTypeToolbox::sqrt(1 - x.value()*x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::asin(x.value()),
+                             1.0/ValueTypeToolbox::sqrt(1 - x.value()*x.value()));
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
@@ -231,16 +258,9 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> sinh(const Evaluation
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::sinh(x.value()));
-
     // derivatives use the chain rule
-    const ValueType& df_dx = ValueTypeToolbox::cosh(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::sinh(x.value()),
+                             ValueTypeToolbox::cosh(x.value()));
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
@@ -248,16 +268,9 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> asinh(const Evaluatio
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::asinh(x.value()));
-
     // derivatives use the chain rule
-    const ValueType& df_dx = 1.0/ValueTypeToolbox::sqrt(x.value()*x.value() + 1);
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::asinh(x.value()),
+                             1.0/ValueTypeToolbox::sqrt(x.value()*x.value() + 1));
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
@@ -265,16 +278,9 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> cos(const Evaluation<
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::cos(x.value()));
-
     // derivatives use the chain rule
-    const ValueType& df_dx = -ValueTypeToolbox::sin(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::cos(x.value()),
+                             -ValueTypeToolbox::sin(x.value()));
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
@@ -282,16 +288,9 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> acos(const Evaluation
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::acos(x.value()));
-
     // derivatives use the chain rule
-    const ValueType& df_dx = - 1.0/ValueTypeToolbox::sqrt(1 - x.value()*x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::acos(x.value()),
+                             - 1.0/ValueTypeToolbox::sqrt(1 - x.value()*x.value()));
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
@@ -299,16 +298,9 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> cosh(const Evaluation
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::cosh(x.value()));
-
     // derivatives use the chain rule
-    const ValueType& df_dx = ValueTypeToolbox::sinh(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::cosh(x.value()),
+                             ValueTypeToolbox::sinh(x.value()));
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
@@ -316,16 +308,9 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> acosh(const Evaluatio
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::acosh(x.value()));
-
     // derivatives use the chain rule
-    const ValueType& df_dx = 1.0/ValueTypeToolbox::sqrt(x.value()*x.value() - 1);
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::acosh(x.value()),
+                             1.0/ValueTypeToolbox::sqrt(x.value()*x.value() - 1));
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
@@ -333,35 +318,19 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> sqrt(const Evaluation
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
     const ValueType& sqrt_x = ValueTypeToolbox::sqrt(x.value());
-    result.setValue(sqrt_x);
 
     // derivatives use the chain rule
-    ValueType df_dx = 0.5/sqrt_x;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx) {
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-    }
-
-    return result;
+    return detail::chainRule(x, sqrt_x, 0.5/sqrt_x);
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
 OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> exp(const Evaluation<ValueType, numVars, staticSize>& x)
 {
-    typedef MathToolbox<ValueType> ValueTypeToolbox;
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    const ValueType& exp_x = ValueTypeToolbox::exp(x.value());
-    result.setValue(exp_x);
-
-    // derivatives use the chain rule
-    const ValueType& df_dx = exp_x;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    const ValueType& exp_x = detail::expValue(x.value());
 
-    return result;
+    // derivatives use the chain rule, exp is its own derivative
+    return detail::chainRule(x, exp_x, exp_x);
 }
 
 // exponentiation of arbitrary base with a fixed constant
@@ -370,24 +339,26 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const Evaluation<
                                                const ExpType& exp)
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
-    Evaluation<ValueType, numVars, staticSize> result(base);
-
-    const ValueType& pow_x = ValueTypeToolbox::pow(base.value(), exp);
-    result.setValue(pow_x);
 
     if (base == 0.0) {
         // we special case the base 0 case because 0.0 is in the valid range of the
         // base but the generic code leads to NaNs.
+        Evaluation<ValueType, numVars, staticSize> result(base);
         result = 0.0;
+        return result;
+    }
+
+    const ValueType& f = base.value();
+    ValueType pow_x;
+    if (detail::useFastMath<ValueType>() && f > 0.0) {
+        pow_x = detail::expValue(static_cast<ValueType>(exp*detail::logValue(f)));
     }
     else {
-        // derivatives use the chain rule
-        const ValueType& df_dx = pow_x/base.value()*exp;
-        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-            result.setDerivative(curVarIdx, df_dx*base.derivative(curVarIdx));
+        pow_x = ValueTypeToolbox::pow(f, exp);
     }
 
-    return result;
+    // derivatives use the chain rule
+    return detail::chainRule(base, pow_x, pow_x/f*exp);
 }
 
 // exponentiation of constant base with an arbitrary exponent
@@ -397,24 +368,19 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const BaseType& b
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(exp);
-
     if (base == 0.0) {
         // we special case the base 0 case because 0.0 is in the valid range of the
         // base but the generic code leads to NaNs.
+        Evaluation<ValueType, numVars, staticSize> result(exp);
         result = 0.0;
+        return result;
     }
-    else {
-        const ValueType& lnBase = ValueTypeToolbox::log(base);
-        result.setValue(ValueTypeToolbox::exp(lnBase*exp.value()));
 
-        // derivatives use the chain rule
-        const ValueType& df_dx = lnBase*result.value();
-        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-            result.setDerivative(curVarIdx, df_dx*exp.derivative(curVarIdx));
-    }
+    const ValueType& lnBase = ValueTypeToolbox::log(base);
+    const ValueType& pow_x = detail::expValue(static_cast<ValueType>(lnBase*exp.value()));
 
-    return result;
+    // derivatives use the chain rule
+    return detail::chainRule(exp, pow_x, lnBase*pow_x);
 }
 
 // this is the most expensive power function. Computationally it is pretty expensive, so
@@ -433,18 +399,30 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const Evaluation<
         result = 0.0;
     }
     else {
-        ValueType valuePow = ValueTypeToolbox::pow(base.value(), exp.value());
+        // f^g and its partial derivatives g*f^(g - 1) and log(f)*f^g share log(f),
+        // which is thus computed only once. If the fast approximations are
+        // enabled, f^g is also computed from it.
+        const ValueType& f = base.value();
+        const ValueType& g = exp.value();
+        const ValueType& logF = detail::logValue(f);
+
+        ValueType valuePow;
+        if (detail::useFastMath<ValueType>() && f > 0.0) {
+            valuePow = detail::expValue(static_cast<ValueType>(g*logF));
+        }
+        else {
+            valuePow = ValueTypeToolbox::pow(f, g);
+        }
         result.setValue(valuePow);
 
         // use the chain rule for the derivatives. since both, the base and the exponent can
-        // potentially depend on the variable set, calculating these is quite elaborate...
-        const ValueType& f = base.value();
-        const ValueType& g = exp.value();
-        const ValueType& logF = ValueTypeToolbox::log(f);
+        // potentially depend on the variable set, both partial derivatives contribute.
+        const ValueType& df_dBase = g*valuePow/f;
+        const ValueType& df_dExp = logF*valuePow;
         for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx) {
-            const ValueType& fPrime = base.derivative(curVarIdx);
-            const ValueType& gPrime = exp.derivative(curVarIdx);
-            result.setDerivative(curVarIdx, (g*fPrime/f + logF*gPrime) * valuePow);
+            result.setDerivative(curVarIdx,
+                                 df_dBase*base.derivative(curVarIdx)
+                                 + df_dExp*exp.derivative(curVarIdx));
         }
     }
 
@@ -454,18 +432,8 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const Evaluation<
 template <class ValueType, int numVars, unsigned staticSize>
 OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> log(const Evaluation<ValueType, numVars, staticSize>& x)
 {
-    typedef MathToolbox<ValueType> ValueTypeToolbox;
-
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::log(x.value()));
-
     // derivatives use the chain rule
-    const ValueType& df_dx = 1/x.value();
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    return detail::chainRule(x, detail::logValue(x.value()), 1/x.value());
 }
 
 
@@ -474,16 +442,9 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> log10(const Evaluatio
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::log10(x.value()));
-
-    // derivatives use the chain rule
-    const ValueType& df_dx = 1/x.value() * ValueTypeToolbox::log10(ValueTypeToolbox::exp(1.0));
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-
-    return result;
+    // derivatives use the chain rule, d/dx log10(x) = log10(e)/x
+    constexpr double log10e = 0.434294481903251827651;
+    return detail::chainRule(x, ValueTypeToolbox::log10(x.value()), log10e/x.value());
 }
 
 } // namespace DenseAd
@@ -0,0 +1,228 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::PengRobinsonMixtureBatch
+ */
+#ifndef OPM_PENG_ROBINSON_MIXTURE_BATCH_HPP
+#define OPM_PENG_ROBINSON_MIXTURE_BATCH_HPP
+
+#include <opm/material/eos/PengRobinsonParamsMixture.hpp>
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/PolynomialUtils.hpp>
+#include <opm/material/Constants.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Evaluates the Peng-Robinson equation of state of a phase for a
+ *        batch of cells at a common temperature.
+ *
+ * Computes the same molar volumes and fugacity coefficients as
+ * PTFlashParameterCache and PengRobinsonMixture, but for many cells at
+ * once.  The temperature dependent pure component parameters and the
+ * binary attraction terms \f$a_{ij}\f$ are computed once per temperature
+ * instead of once per cell.  Compositions and fugacity coefficients use a
+ * component major (structure of arrays) layout, i.e., entry
+ * <tt>compIdx*numCells + cellIdx</tt>, so the mixing rules and the
+ * fugacity expressions are loops over cells with unit stride.
+ *
+ * The Evaluation type of the per-cell quantities may be a plain scalar or
+ * a DenseAd::Evaluation, in which case the derivatives with respect to
+ * pressure and composition are propagated.
+ */
+template <class Scalar, class FluidSystem>
+class PengRobinsonMixtureBatch
+{
+    enum { numComponents = FluidSystem::numComponents };
+
+    // Only used for its pure component parameters and a_ij, which do not
+    // depend on the phase.
+    using PureParams = PengRobinsonParamsMixture<Scalar, FluidSystem, /*phaseIdx=*/0>;
+
+public:
+    /*!
+     * \brief Update the pure component parameters for a temperature.
+     *
+     * Does nothing if the temperature is the same as in the previous call.
+     */
+    void updatePure(const Scalar temperature)
+    {
+        if (temperature == this->temperature_) {
+            return;
+        }
+
+        // The pressure argument is not used by the pure component
+        // parameters.
+        this->pureParams_.updatePure(temperature, Scalar{1});
+
+        for (unsigned compIIdx = 0; compIIdx < numComponents; ++compIIdx) {
+            this->b_[compIIdx] = this->pureParams_.pureParams(compIIdx).b();
+
+            for (unsigned compJIdx = 0; compJIdx < numComponents; ++compJIdx) {
+                this->aij_[compIIdx][compJIdx] = this->pureParams_.getaCache(compIIdx, compJIdx);
+            }
+        }
+
+        this->temperature_ = temperature;
+    }
+
+    /*!
+     * \brief Temperature of the current pure component parameters.
+     */
+    Scalar temperature() const
+    { return this->temperature_; }
+
+    /*!
+     * \brief Compute molar volumes and fugacity coefficients of a phase for
+     *        a batch of cells.
+     *
+     * updatePure() must have been called for the temperature of the cells.
+     *
+     * \param numCells Number of cells in the batch.
+     * \param pressure Phase pressure of each cell [Pa].
+     * \param moleFractions Phase mole fractions, component major.
+     * \param isGasPhase Which root of the cubic to use if there are three.
+     * \param molarVolume Output, molar volume of each cell [m^3/mol].
+     * \param fugacityCoefficients Output, component major.
+     */
+    template <class Evaluation>
+    void computeFugacityCoefficients(const std::size_t numCells,
+                                     const Evaluation* pressure,
+                                     const Evaluation* moleFractions,
+                                     const bool isGasPhase,
+                                     Evaluation* molarVolume,
+                                     Evaluation* fugacityCoefficients) const
+    {
+        auto x = [numCells, moleFractions](unsigned compIdx, std::size_t cellIdx) -> const Evaluation&
+        { return moleFractions[compIdx*numCells + cellIdx]; };
+
+        const Scalar RT = Constants<Scalar>::R * this->temperature_;
+
+        std::vector<Evaluation> a(numCells, Evaluation{0.0});
+        std::vector<Evaluation> b(numCells, Evaluation{0.0});
+        std::vector<Evaluation> As(numComponents*numCells, Evaluation{0.0});
+
+        // Mixing rules, see PengRobinsonParamsMixture::updateMix().  The
+        // clamped mole fractions enter a and b, the raw ones enter the sum
+        // over a_ij of the fugacity coefficient.
+        for (unsigned compIIdx = 0; compIIdx < numComponents; ++compIIdx) {
+            for (unsigned compJIdx = 0; compJIdx < numComponents; ++compJIdx) {
+                const Scalar aij = this->aij_[compIIdx][compJIdx];
+                for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                    const Evaluation xi = max(0.0, min(1.0, x(compIIdx, cellIdx)));
+                    const Evaluation xj = max(0.0, min(1.0, x(compJIdx, cellIdx)));
+                    a[cellIdx] += xi * xj * aij;
+                    As[compIIdx*numCells + cellIdx] += aij * x(compJIdx, cellIdx);
+                }
+            }
+
+            const Scalar bi = this->b_[compIIdx];
+            for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                b[cellIdx] += max(0.0, min(1.0, x(compIIdx, cellIdx))) * bi;
+            }
+        }
+
+        // Molar volumes, see PengRobinson::computeMolarVolume()
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            molarVolume[cellIdx] = computeMolarVolume_(a[cellIdx], b[cellIdx], pressure[cellIdx],
+                                                       RT, isGasPhase);
+        }
+
+        // Fugacity coefficients, see
+        // PengRobinsonMixture::computeFugacityCoefficient()
+        const Scalar m1 = 0.5*(u + std::sqrt(u*u - 4*w));
+        const Scalar m2 = 0.5*(u - std::sqrt(u*u - 4*w));
+
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const Scalar bi = this->b_[compIdx];
+
+            for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                const Evaluation& p = pressure[cellIdx];
+                const Evaluation bi_b = bi / b[cellIdx];
+                const Evaluation Z = p*molarVolume[cellIdx]/RT;
+                const Evaluation Astar = a[cellIdx]*p/(RT*RT);
+                const Evaluation Bstar = b[cellIdx]*p/RT;
+                const Evaluation A_s = As[compIdx*numCells + cellIdx]*p/(RT*RT);
+
+                const Evaluation alpha = -log(Z - Bstar) + bi_b * (Z - 1);
+                const Evaluation betta = log((Z + m2 * Bstar) / (Z + m1 * Bstar)) * Astar / ((m1 - m2) * Bstar);
+                const Evaluation gamma = (2 / Astar) * A_s - bi_b;
+
+                const Evaluation fugCoeff = exp(alpha + (betta * gamma));
+                fugacityCoefficients[compIdx*numCells + cellIdx] = max(1e-10, min(1e10, fugCoeff));
+            }
+        }
+    }
+
+private:
+    // the u and w parameters as given by the Peng-Robinson EOS
+    static constexpr Scalar u = 2.0;
+    static constexpr Scalar w = -1.0;
+
+    template <class Evaluation>
+    static Evaluation computeMolarVolume_(const Evaluation& a,
+                                          const Evaluation& b,
+                                          const Evaluation& p,
+                                          const Scalar RT,
+                                          const bool isGasPhase)
+    {
+        if (!std::isfinite(scalarValue(a)) || std::abs(scalarValue(a)) < 1e-30) {
+            return std::numeric_limits<Scalar>::quiet_NaN();
+        }
+        if (!std::isfinite(scalarValue(b)) || b <= 0) {
+            return std::numeric_limits<Scalar>::quiet_NaN();
+        }
+
+        const Evaluation Astar = a*p/(RT*RT);
+        const Evaluation Bstar = b*p/RT;
+
+        const Evaluation a1 = 1.0;
+        const Evaluation a2 = - (1 - Bstar);
+        const Evaluation a3 = Astar - Bstar*(3*Bstar + 2);
+        const Evaluation a4 = Bstar*(- Astar + Bstar*(1 + Bstar));
+
+        Evaluation Z[3] = {0.0, 0.0, 0.0};
+        const auto numSol = cubicRoots(Z, a1, a2, a3, a4);
+        if ((numSol == 3) && isGasPhase) {
+            return max(1e-7, Z[2]*RT/p);
+        }
+
+        return max(1e-7, Z[0]*RT/p);
+    }
+
+    PureParams pureParams_{};
+    Scalar temperature_{std::numeric_limits<Scalar>::quiet_NaN()};
+    Scalar b_[numComponents]{};
+    Scalar aij_[numComponents][numComponents]{};
+};
+
+} // namespace Opm
+
+#endif
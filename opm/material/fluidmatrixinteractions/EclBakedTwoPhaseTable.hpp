@@ -0,0 +1,241 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::EclBakedTwoPhaseTable
+ */
+#ifndef OPM_ECL_BAKED_TWO_PHASE_TABLE_HPP
+#define OPM_ECL_BAKED_TWO_PHASE_TABLE_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \ingroup FluidMatrixInteractions
+ *
+ * \brief Piecewise linear tabulation of the endpoint scaled capillary
+ *        pressure and relative permeability curves of a two-phase system.
+ *
+ * The table is defined on scaled wetting phase saturations in [0, 1] and
+ * folds the saturation scaling, the effective saturation function and the
+ * vertical scaling into a single lookup.  Sampling points are the union of
+ * a set of breakpoints, typically the scaled images of the nodes of the
+ * underlying saturation function tables and the scaled endpoints, and a
+ * uniform grid.  If the breakpoints include every kink of the scaled
+ * functions, the tabulation is exact up to rounding.
+ *
+ * Segment lookup is O(1) through a uniform bucket index, and derivatives
+ * follow from the linear interpolation.  At a sampling point the segment to
+ * the left is used, so derivatives at kinks are one-sided.
+ */
+template <class Scalar>
+class EclBakedTwoPhaseTable
+{
+public:
+    /*!
+     * \brief Maximum absolute deviation of the tabulated curves from the
+     *        functions they were created from.
+     *
+     * Measured at the interior quarter points of every segment.
+     */
+    struct Accuracy
+    {
+        Scalar pcnw{};
+        Scalar krw{};
+        Scalar krn{};
+    };
+
+    /*!
+     * \brief Tabulate a two-phase system.
+     *
+     * \param breakpoints Scaled saturations at which the curves should be
+     *                    sampled.  Values outside [0, 1] are ignored.
+     *
+     * \param minSegments Minimum number of uniform segments on [0, 1].
+     *                    Only relevant for curves which are not piecewise
+     *                    linear between the breakpoints.
+     *
+     * \param eval Callable which returns the curve values {pcnw, krw, krn}
+     *             at a given scaled wetting phase saturation.
+     */
+    template <class EvalFunction>
+    EclBakedTwoPhaseTable(std::vector<Scalar> breakpoints,
+                          const std::size_t   minSegments,
+                          EvalFunction&&      eval)
+    {
+        const auto n = std::max(minSegments, std::size_t{1});
+        for (auto i = 0*n; i <= n; ++i) {
+            breakpoints.push_back(static_cast<Scalar>(i) / n);
+        }
+
+        breakpoints.erase(std::remove_if(breakpoints.begin(), breakpoints.end(),
+                                         [](const Scalar s) { return !covers(s); }),
+                          breakpoints.end());
+
+        std::sort(breakpoints.begin(), breakpoints.end());
+
+        // Drop sampling points which are too close to distinguish
+        constexpr auto minDistance = 16 * std::numeric_limits<Scalar>::epsilon();
+        for (const auto s : breakpoints) {
+            if (this->x_.empty() || (s - this->x_.back() > minDistance)) {
+                this->x_.push_back(s);
+            }
+        }
+        this->x_.back() = Scalar{1};
+
+        std::vector<std::array<Scalar, 3>> y;
+        y.reserve(this->x_.size());
+        for (const auto s : this->x_) {
+            y.push_back(eval(s));
+        }
+
+        const auto numSegments = this->x_.size() - 1;
+        for (auto& curve : this->curves_) {
+            curve.resize(numSegments);
+        }
+
+        for (auto i = 0*numSegments; i < numSegments; ++i) {
+            const auto dx = this->x_[i + 1] - this->x_[i];
+
+            for (auto c = 0*y[i].size(); c < y[i].size(); ++c) {
+                this->curves_[c][i] = { y[i][c], (y[i + 1][c] - y[i][c]) / dx };
+            }
+        }
+
+        this->buildIndex_();
+        this->measureAccuracy_(eval);
+    }
+
+    /*!
+     * \brief Whether or not a scaled saturation is inside the range of the
+     *        table.
+     */
+    static bool covers(const Scalar Sw)
+    { return (Sw >= Scalar{0}) && (Sw <= Scalar{1}); }
+
+    template <class Evaluation>
+    Evaluation pcnw(const Evaluation& Sw) const
+    { return this->eval_(this->curves_[0], Sw); }
+
+    template <class Evaluation>
+    Evaluation krw(const Evaluation& Sw) const
+    { return this->eval_(this->curves_[1], Sw); }
+
+    template <class Evaluation>
+    Evaluation krn(const Evaluation& Sw) const
+    { return this->eval_(this->curves_[2], Sw); }
+
+    /*!
+     * \brief Deviation from the exact curves.
+     */
+    const Accuracy& accuracy() const
+    { return this->accuracy_; }
+
+    /*!
+     * \brief Number of sampling points of the table.
+     */
+    std::size_t numSamples() const
+    { return this->x_.size(); }
+
+private:
+    struct Segment
+    {
+        Scalar y0;
+        Scalar slope;
+    };
+
+    std::size_t segmentIndex_(const Scalar Sw) const
+    {
+        const auto numSegments = this->x_.size() - 1;
+        const auto bucket = std::min(static_cast<std::size_t>(Sw * this->bucketScale_),
+                                     this->bucketStart_.size() - 1);
+
+        auto i = this->bucketStart_[bucket];
+        while ((i + 1 < numSegments) && (this->x_[i + 1] < Sw)) {
+            ++i;
+        }
+
+        return i;
+    }
+
+    template <class Evaluation>
+    Evaluation eval_(const std::vector<Segment>& curve, const Evaluation& Sw) const
+    {
+        const auto i = this->segmentIndex_(scalarValue(Sw));
+        const auto& seg = curve[i];
+
+        return seg.y0 + (Sw - this->x_[i])*seg.slope;
+    }
+
+    void buildIndex_()
+    {
+        // Twice as many buckets as segments, so each lookup inspects at
+        // most a few sampling points.
+        const auto numBuckets = 2 * (this->x_.size() - 1);
+        this->bucketScale_ = static_cast<Scalar>(numBuckets);
+        this->bucketStart_.resize(numBuckets);
+
+        auto i = std::size_t{0};
+        for (auto b = 0*numBuckets; b < numBuckets; ++b) {
+            const auto s = static_cast<Scalar>(b) / this->bucketScale_;
+            while ((i + 2 < this->x_.size()) && (this->x_[i + 1] < s)) {
+                ++i;
+            }
+
+            this->bucketStart_[b] = i;
+        }
+    }
+
+    template <class EvalFunction>
+    void measureAccuracy_(EvalFunction& eval)
+    {
+        for (auto i = 0*this->x_.size(); i + 1 < this->x_.size(); ++i) {
+            for (const auto t : { Scalar{0.25}, Scalar{0.5}, Scalar{0.75} }) {
+                const auto s = this->x_[i] + t*(this->x_[i + 1] - this->x_[i]);
+                const auto exact = eval(s);
+
+                this->accuracy_.pcnw = std::max(this->accuracy_.pcnw, std::abs(this->pcnw(s) - exact[0]));
+                this->accuracy_.krw = std::max(this->accuracy_.krw, std::abs(this->krw(s) - exact[1]));
+                this->accuracy_.krn = std::max(this->accuracy_.krn, std::abs(this->krn(s) - exact[2]));
+            }
+        }
+    }
+
+    std::vector<Scalar> x_{};
+    std::array<std::vector<Segment>, 3> curves_{};
+    std::vector<std::size_t> bucketStart_{};
+    Scalar bucketScale_{};
+    Accuracy accuracy_{};
+};
+
+} // namespace Opm
+
+#endif
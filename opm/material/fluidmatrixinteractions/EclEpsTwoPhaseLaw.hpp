@@ -149,6 +149,12 @@ public:
     template <class Evaluation>
     static Evaluation twoPhaseSatPcnw(const Params& params, const Evaluation& SwScaled)
     {
+        if (const auto* baked = params.bakedTable();
+            (baked != nullptr) && baked->covers(scalarValue(SwScaled)))
+        {
+            return baked->pcnw(SwScaled);
+        }
+
         const Evaluation SwUnscaled = scaledToUnscaledSatPc(params, SwScaled);
         const Evaluation pcUnscaled = EffLaw::twoPhaseSatPcnw(params.effectiveLawParams(), SwUnscaled);
         return unscaledToScaledPcnw_(params, pcUnscaled);
@@ -221,6 +227,12 @@ public:
     template <class Evaluation>
     static Evaluation twoPhaseSatKrw(const Params& params, const Evaluation& SwScaled)
     {
+        if (const auto* baked = params.bakedTable();
+            (baked != nullptr) && baked->covers(scalarValue(SwScaled)))
+        {
+            return baked->krw(SwScaled);
+        }
+
         const Evaluation SwUnscaled = scaledToUnscaledSatKrw(params, SwScaled);
         const Evaluation krwUnscaled = EffLaw::twoPhaseSatKrw(params.effectiveLawParams(), SwUnscaled);
         return unscaledToScaledKrw_(SwScaled, params, krwUnscaled);
@@ -246,6 +258,12 @@ public:
     template <class Evaluation>
     static Evaluation twoPhaseSatKrn(const Params& params, const Evaluation& SwScaled)
     {
+        if (const auto* baked = params.bakedTable();
+            (baked != nullptr) && baked->covers(scalarValue(SwScaled)))
+        {
+            return baked->krn(SwScaled);
+        }
+
         const Evaluation SwUnscaled = scaledToUnscaledSatKrn(params, SwScaled);
         const Evaluation krnUnscaled = EffLaw::twoPhaseSatKrn(params.effectiveLawParams(), SwUnscaled);
         return unscaledToScaledKrn_(SwScaled, params, krnUnscaled);
@@ -27,6 +27,7 @@
 #ifndef OPM_ECL_EPS_TWO_PHASE_LAW_PARAMS_HPP
 #define OPM_ECL_EPS_TWO_PHASE_LAW_PARAMS_HPP
 
+#include "EclBakedTwoPhaseTable.hpp"
 #include "EclEpsConfig.hpp"
 #include "EclEpsScalingPoints.hpp"
 
@@ -51,6 +52,7 @@ class EclEpsTwoPhaseLawParams : public EnsureFinalized
 public:
     using Traits = typename EffLawParams::Traits;
     using ScalingPoints = EclEpsScalingPoints<Scalar>;
+    using BakedTable = EclBakedTwoPhaseTable<Scalar>;
 
     EclEpsTwoPhaseLawParams()
     {
@@ -75,7 +77,10 @@ public:
      * \brief Set the endpoint scaling configuration object.
      */
     void setConfig(std::shared_ptr<EclEpsConfig> value)
-    { config_ = *value; }
+    {
+        config_ = *value;
+        bakedTable_ = nullptr;
+    }
 
     /*!
      * \brief Returns the endpoint scaling configuration object.
@@ -87,7 +92,10 @@ public:
      * \brief Set the scaling points which are seen by the nested material law
      */
     void setUnscaledPoints(std::shared_ptr<ScalingPoints> value)
-    { unscaledPoints_ = value.get(); }
+    {
+        unscaledPoints_ = value.get();
+        bakedTable_ = nullptr;
+    }
 
     /*!
      * \brief Returns the scaling points which are seen by the nested material law
@@ -99,7 +107,10 @@ public:
      * \brief Set the scaling points which are seen by the physical model
      */
     void setScaledPoints(const ScalingPoints& value)
-    { scaledPoints_ = value; }
+    {
+        scaledPoints_ = value;
+        bakedTable_ = nullptr;
+    }
 
     /*!
      * \brief Returns the scaling points which are seen by the physical model
@@ -109,15 +120,24 @@ public:
 
     /*!
      * \brief Returns the scaling points which are seen by the physical model
+     *
+     * The caller may modify the scaling points, so this discards the baked
+     * table.
      */
     ScalingPoints& scaledPoints()
-    { return scaledPoints_; }
+    {
+        bakedTable_ = nullptr;
+        return scaledPoints_;
+    }
 
     /*!
      * \brief Sets the parameter object for the effective/nested material law.
      */
     void setEffectiveLawParams(std::shared_ptr<EffLawParams> value)
-    { effectiveLawParams_ = value.get(); }
+    {
+        effectiveLawParams_ = value.get();
+        bakedTable_ = nullptr;
+    }
 
     /*!
      * \brief Returns the parameter object for the effective/nested material law.
@@ -125,8 +145,26 @@ public:
     const EffLawParams& effectiveLawParams() const
     { return *effectiveLawParams_; }
 
+    /*!
+     * \brief Set a table which replaces the evaluation of the scaled
+     *        curves for saturations in the range of the table.
+     *
+     * The table must represent the current configuration, scaling points
+     * and effective law parameters.  Changing any of those discards the
+     * table.  Pass a null pointer to use the regular evaluation.
+     */
+    void setBakedTable(std::shared_ptr<const BakedTable> value)
+    { bakedTable_ = value.get(); }
+
+    /*!
+     * \brief Returns the baked table, or a null pointer if none is set.
+     */
+    const BakedTable* bakedTable() const
+    { return bakedTable_; }
+
 private:
     EffLawParams* effectiveLawParams_{};
+    const BakedTable* bakedTable_{};
     EclEpsConfig config_;
     ScalingPoints* unscaledPoints_{};
     ScalingPoints scaledPoints_;
@@ -34,9 +34,170 @@
 #include <opm/material/fluidstates/SimpleModularFluidState.hpp>
 
 #include <algorithm>
+#include <map>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace Opm {
 
+namespace {
+
+/// Creates and shares the tables of
+/// EclMaterialLawManager::bakeSaturationFunctions().
+template <class Scalar, class Report>
+class SaturationFunctionBaker
+{
+public:
+    using Table = EclBakedTwoPhaseTable<Scalar>;
+    using TableVector = std::vector<std::shared_ptr<const Table>>;
+
+    SaturationFunctionBaker(const std::size_t minSegments,
+                            const std::size_t maxTables,
+                            TableVector&      tables,
+                            Report&           report)
+        : minSegments_ { minSegments }
+        , maxTables_   { maxTables }
+        , tables_      { tables }
+        , report_      { report }
+    {}
+
+    template <class HystParams>
+    void bake(HystParams& hystParams, const bool enableHysteresis)
+    {
+        this->bakeEps(hystParams.drainageParams());
+
+        if (enableHysteresis) {
+            this->bakeEps(hystParams.imbibitionParams());
+        }
+    }
+
+private:
+    using Key = std::tuple<const void*, const void*, std::vector<Scalar>>;
+
+    std::size_t minSegments_;
+    std::size_t maxTables_;
+    TableVector& tables_;
+    Report& report_;
+    std::map<Key, std::shared_ptr<const Table>> knownTables_{};
+
+    template <class EpsParams>
+    void bakeEps(EpsParams& params)
+    {
+        const auto& cparams = std::as_const(params);
+        auto key = makeKey(cparams);
+
+        auto pos = this->knownTables_.find(key);
+        if (pos == this->knownTables_.end()) {
+            if (this->tables_.size() >= this->maxTables_) {
+                params.setBakedTable(nullptr);
+                ++this->report_.numSkipped;
+                return;
+            }
+
+            pos = this->knownTables_.emplace(std::move(key), this->makeTable(cparams)).first;
+            this->tables_.push_back(pos->second);
+            this->updateReport(*pos->second);
+        }
+
+        params.setBakedTable(pos->second);
+        ++this->report_.numBaked;
+    }
+
+    /// Everything which enters the evaluation of the scaled curves.
+    template <class EpsParams>
+    static Key makeKey(const EpsParams& params)
+    {
+        const auto& config = params.config();
+        const auto& points = params.scaledPoints();
+
+        auto values = std::vector<Scalar> {
+            Scalar(config.enableSatScaling()),
+            Scalar(config.enableThreePointKrSatScaling()),
+            Scalar(config.enableKrwScaling()),
+            Scalar(config.enableThreePointKrwScaling()),
+            Scalar(config.enableKrnScaling()),
+            Scalar(config.enableThreePointKrnScaling()),
+            Scalar(config.enablePcScaling()),
+            Scalar(config.enableLeverettScaling()),
+            points.maxPcnw(), points.leverettFactor(),
+            points.krwr(), points.maxKrw(),
+            points.krnr(), points.maxKrn(),
+        };
+
+        for (const auto* satPoints : { &points.saturationPcPoints(),
+                                       &points.saturationKrwPoints(),
+                                       &points.saturationKrnPoints() })
+        {
+            values.insert(values.end(), satPoints->begin(), satPoints->end());
+        }
+
+        return { &params.effectiveLawParams(), &params.unscaledPoints(), std::move(values) };
+    }
+
+    template <class EpsParams>
+    std::shared_ptr<const Table> makeTable(const EpsParams& params) const
+    {
+        using EffParams = std::decay_t<decltype(params.effectiveLawParams())>;
+        using EpsLaw = EclEpsTwoPhaseLaw<SatCurveMultiplexer<typename EffParams::Traits>>;
+
+        const auto& points = params.scaledPoints();
+
+        auto breakpoints = std::vector<Scalar>{};
+        for (const auto* satPoints : { &points.saturationPcPoints(),
+                                       &points.saturationKrwPoints(),
+                                       &points.saturationKrnPoints() })
+        {
+            breakpoints.insert(breakpoints.end(), satPoints->begin(), satPoints->end());
+        }
+
+        // Kinks of the piecewise linear saturation functions, mapped to
+        // scaled saturations.
+        const auto& effParams = params.effectiveLawParams();
+        if (effParams.approach() == SatCurveMultiplexerApproach::PiecewiseLinear) {
+            const auto& plParams = effParams.template
+                getRealParams<SatCurveMultiplexerApproach::PiecewiseLinear>();
+
+            for (const auto& s : plParams.SwPcwnSamples()) {
+                breakpoints.push_back(EpsLaw::unscaledToScaledSatPc(params, s));
+            }
+            for (const auto& s : plParams.SwKrwSamples()) {
+                breakpoints.push_back(EpsLaw::unscaledToScaledSatKrw(params, s));
+            }
+            for (const auto& s : plParams.SwKrnSamples()) {
+                breakpoints.push_back(EpsLaw::unscaledToScaledSatKrn(params, s));
+            }
+        }
+
+        // The parameter object is not baked at this point, so the law
+        // provides the regular evaluation.
+        return std::make_shared<const Table>
+            (std::move(breakpoints), this->minSegments_,
+             [&params](const Scalar Sw)
+             {
+                 return std::array<Scalar, 3> {
+                     EpsLaw::twoPhaseSatPcnw(params, Sw),
+                     EpsLaw::twoPhaseSatKrw(params, Sw),
+                     EpsLaw::twoPhaseSatKrn(params, Sw),
+                 };
+             });
+    }
+
+    void updateReport(const Table& table)
+    {
+        const auto& acc = table.accuracy();
+        auto& maxError = this->report_.maxError;
+
+        maxError.pcnw = std::max(maxError.pcnw, acc.pcnw);
+        maxError.krw = std::max(maxError.krw, acc.krw);
+        maxError.krn = std::max(maxError.krn, acc.krn);
+
+        ++this->report_.numTables;
+    }
+};
+
+} // Anonymous namespace
+
 template<class TraitsT>
 EclMaterialLawManager<TraitsT>::EclMaterialLawManager() = default;
 
@@ -442,6 +603,83 @@ oilWaterScaledEpsPointsDrainage(unsigned elemIdx)
     }
 }
 
+template<class TraitsT>
+typename EclMaterialLawManager<TraitsT>::BakedSaturationFunctionReport
+EclMaterialLawManager<TraitsT>::
+bakeSaturationFunctions(const std::size_t minSegments,
+                        const std::size_t maxTables)
+{
+    OPM_TIMEFUNCTION();
+
+    auto report = BakedSaturationFunctionReport{};
+
+    this->bakedTables_.clear();
+    SaturationFunctionBaker<Scalar, BakedSaturationFunctionReport>
+        baker { minSegments, maxTables, this->bakedTables_, report };
+
+    const auto hyst = this->enableHysteresis();
+    auto bakeCell = [&baker, hyst](MaterialLawParams& mlp)
+    {
+        switch (mlp.approach()) {
+        case EclMultiplexerApproach::Stone1: {
+            auto& realParams = mlp.template getRealParams<EclMultiplexerApproach::Stone1>();
+            baker.bake(realParams.gasOilParams(), hyst);
+            baker.bake(realParams.oilWaterParams(), hyst);
+        }
+            break;
+
+        case EclMultiplexerApproach::Stone2: {
+            auto& realParams = mlp.template getRealParams<EclMultiplexerApproach::Stone2>();
+            baker.bake(realParams.gasOilParams(), hyst);
+            baker.bake(realParams.oilWaterParams(), hyst);
+        }
+            break;
+
+        case EclMultiplexerApproach::Default: {
+            auto& realParams = mlp.template getRealParams<EclMultiplexerApproach::Default>();
+            baker.bake(realParams.gasOilParams(), hyst);
+            baker.bake(realParams.oilWaterParams(), hyst);
+        }
+            break;
+
+        case EclMultiplexerApproach::TwoPhase: {
+            auto& realParams = mlp.template getRealParams<EclMultiplexerApproach::TwoPhase>();
+            if (realParams.approach() == EclTwoPhaseApproach::GasOil) {
+                baker.bake(realParams.gasOilParams(), hyst);
+            }
+            else if (realParams.approach() == EclTwoPhaseApproach::GasWater) {
+                baker.bake(realParams.gasWaterParams(), hyst);
+            }
+            else if (realParams.approach() == EclTwoPhaseApproach::OilWater) {
+                baker.bake(realParams.oilWaterParams(), hyst);
+            }
+        }
+            break;
+
+        default:
+            // Single phase.  Nothing to tabulate.
+            break;
+        }
+    };
+
+    for (auto& mlp : this->materialLawParams_) {
+        bakeCell(mlp);
+    }
+
+    if (this->dirMaterialLawParams_) {
+        for (auto* dirParams : { &this->dirMaterialLawParams_->materialLawParamsX_,
+                                 &this->dirMaterialLawParams_->materialLawParamsY_,
+                                 &this->dirMaterialLawParams_->materialLawParamsZ_ })
+        {
+            for (auto& mlp : *dirParams) {
+                bakeCell(mlp);
+            }
+        }
+    }
+
+    return report;
+}
+
 template<class TraitsT>
 const typename EclMaterialLawManager<TraitsT>::MaterialLawParams& EclMaterialLawManager<TraitsT>::
 materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const
@@ -42,6 +42,7 @@
 #include <opm/material/fluidmatrixinteractions/DirectionalMaterialLawParams.hpp>
 
 #include <cassert>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <tuple>
@@ -415,6 +416,45 @@ public:
 
     EclEpsScalingPoints<Scalar>& oilWaterScaledEpsPointsDrainage(unsigned elemIdx);
 
+    /*!
+     * \brief Summary of bakeSaturationFunctions().
+     */
+    struct BakedSaturationFunctionReport
+    {
+        //! Number of distinct tables which were created.
+        std::size_t numTables{};
+
+        //! Number of two-phase parameter objects which use a table.
+        std::size_t numBaked{};
+
+        //! Number of two-phase parameter objects which kept the regular
+        //! evaluation because the table limit was reached.
+        std::size_t numSkipped{};
+
+        //! Largest deviation of any table from the regular evaluation.
+        typename EclBakedTwoPhaseTable<Scalar>::Accuracy maxError{};
+    };
+
+    /*!
+     * \brief Replace the evaluation of the endpoint scaled two-phase
+     *        capillary pressure and relative permeability curves by
+     *        precomputed tables.
+     *
+     * Two-phase parameter objects with the same saturation functions, the
+     * same endpoint scaling configuration and the same scaled endpoints
+     * share a table.  The tables are exact up to rounding for piecewise
+     * linear saturation functions.  Call this once the scaled endpoints are
+     * final, i.e., after SWATINIT processing.  Later modifications of the
+     * scaled endpoints of a cell revert that cell to the regular evaluation.
+     *
+     * \param minSegments Minimum number of uniform segments per table.
+     *
+     * \param maxTables Upper limit on the number of distinct tables.
+     */
+    BakedSaturationFunctionReport
+    bakeSaturationFunctions(std::size_t minSegments = 64,
+                            std::size_t maxTables = 4096);
+
     const EclEpsScalingPointsInfo<Scalar>& oilWaterScaledEpsInfoDrainage(size_t elemIdx) const
     { return oilWaterScaledEpsInfoDrainage_[elemIdx]; }
 
@@ -486,6 +526,8 @@ private:
     std::shared_ptr<EclEpsConfig> gasOilConfig_;
     std::shared_ptr<EclEpsConfig> oilWaterConfig_;
     std::shared_ptr<EclEpsConfig> gasWaterConfig_;
+
+    std::vector<std::shared_ptr<const EclBakedTwoPhaseTable<Scalar>>> bakedTables_;
 };
 } // namespace Opm
 
@@ -26,10 +26,15 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/ParallelFor.hpp>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
 namespace Opm {
 
 template<class Scalar, class Params, class ContainerT>
@@ -229,6 +234,130 @@ setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa)
                              static_cast<Scalar>(viscaqa[0].getC2("NACL"))};
 }
 
+template<class Scalar, class Params, class ContainerT>
+Scalar BrineCo2Pvt<Scalar, Params, ContainerT>::
+tabulateSolubility(Scalar minTemperature, Scalar maxTemperature,
+                   Scalar minPressure, Scalar maxPressure,
+                   std::vector<Scalar> salinities,
+                   Scalar tolerance,
+                   unsigned maxSamples)
+{
+    if (!(minTemperature < maxTemperature) || !(minPressure < maxPressure)) {
+        OPM_THROW(std::invalid_argument,
+                  "Temperature and pressure ranges of the CO2 solubility tables must not be empty");
+    }
+
+    salinities.insert(salinities.end(), salinity_.begin(), salinity_.end());
+    if (salinities.empty()) {
+        OPM_THROW(std::invalid_argument, "No salinities to tabulate the CO2 solubility for");
+    }
+    std::sort(salinities.begin(), salinities.end());
+    salinities.erase(std::unique(salinities.begin(), salinities.end()), salinities.end());
+
+    using Table2D = UniformTabulated2DFunction<Scalar>;
+
+    // The exact evaluation interpolates bilinearly in the tabulated CO2
+    // density, so its derivatives jump at the nodes of that table.  Using
+    // grids whose nodes include those of the CO2 table keeps the kinks on
+    // grid nodes, where they do not degrade the interpolation.
+    const auto& co2Density = co2Tables_.tabulatedDensity;
+    const Scalar dT = (co2Density.xMax() - co2Density.xMin()) / (co2Density.numX() - 1);
+    const Scalar dp = (co2Density.yMax() - co2Density.yMin()) / (co2Density.numY() - 1);
+    const Scalar T0 = co2Density.xMin() + std::floor((minTemperature - co2Density.xMin()) / dT)*dT;
+    const Scalar p0 = co2Density.yMin() + std::floor((minPressure - co2Density.yMin()) / dp)*dp;
+    const unsigned numIntervalsT = std::max(1, static_cast<int>(std::ceil((maxTemperature - T0) / dT)));
+    const unsigned numIntervalsP = std::max(1, static_cast<int>(std::ceil((maxPressure - p0) / dp)));
+
+    auto tabulate = [&](const Scalar salinity, const unsigned refinement)
+    {
+        const unsigned m = numIntervalsT*refinement + 1;
+        const unsigned n = numIntervalsP*refinement + 1;
+        Table2D table(T0, T0 + numIntervalsT*dT, m, p0, p0 + numIntervalsP*dp, n);
+        utility::parallelFor(static_cast<int>(m*n), [&](const int idx)
+        {
+            const unsigned i = idx % m;
+            const unsigned j = idx / m;
+            table.setSamplePoint(i, j, equilibriumMoleFractionCO2_(table.iToX(i), table.jToY(j), salinity));
+        }, 16);
+
+        return table;
+    };
+
+    // Largest deviation at the centres of the cells of a (T, p) grid, where
+    // bilinear interpolation is least accurate.
+    auto centreError = [&](const Table2D& table, const Scalar salinity)
+    {
+        const unsigned m = table.numX() - 1;
+        const unsigned n = table.numY() - 1;
+        std::vector<Scalar> error(m*n);
+        utility::parallelFor(static_cast<int>(m*n), [&](const int idx)
+        {
+            const Scalar T = (table.iToX(idx % m) + table.iToX(idx % m + 1)) / 2;
+            const Scalar p = (table.jToY(idx / m) + table.jToY(idx / m + 1)) / 2;
+            error[idx] = std::abs(table.eval(T, p, /*extrapolate=*/false)
+                                  - equilibriumMoleFractionCO2_(T, p, salinity));
+        }, 16);
+
+        return *std::max_element(error.begin(), error.end());
+    };
+
+    auto table = std::make_shared<SolubilityTable>();
+    table->salinities = salinities;
+
+    // All (T, p) grids share a resolution, so that the grids of inserted
+    // salinities line up with those of their neighbours.
+    Scalar maxError{};
+    unsigned refinement = 1;
+    for (;; refinement *= 2) {
+        table->xlCO2.clear();
+        maxError = Scalar{0};
+        for (const auto& salinity : salinities) {
+            table->xlCO2.push_back(tabulate(salinity, refinement));
+            maxError = std::max(maxError, centreError(table->xlCO2.back(), salinity));
+        }
+
+        const auto nextSamples = 2*refinement*std::max(numIntervalsT, numIntervalsP) + 1;
+        if ((maxError <= tolerance) || (nextSamples > maxSamples)) {
+            break;
+        }
+    }
+
+    // Insert salinities where linear interpolation between neighbouring
+    // samples is not accurate enough.
+    constexpr std::size_t maxSalinities = 64;
+    for (std::size_t k = 0; k + 1 < table->salinities.size(); ) {
+        if (table->salinities.size() >= maxSalinities) {
+            break;
+        }
+
+        const Scalar salinity = (table->salinities[k] + table->salinities[k + 1]) / 2;
+        auto midTable = tabulate(salinity, refinement);
+
+        Scalar error{0};
+        for (unsigned i = 0; i < midTable.numX(); ++i) {
+            for (unsigned j = 0; j < midTable.numY(); ++j) {
+                const Scalar interp = (table->xlCO2[k].getSamplePoint(i, j)
+                                       + table->xlCO2[k + 1].getSamplePoint(i, j)) / 2;
+                error = std::max(error, std::abs(interp - midTable.getSamplePoint(i, j)));
+            }
+        }
+
+        if (error <= tolerance) {
+            maxError = std::max(maxError, error);
+            ++k;
+            continue;
+        }
+
+        maxError = std::max(maxError, centreError(midTable, salinity));
+        table->salinities.insert(table->salinities.begin() + k + 1, salinity);
+        table->xlCO2.insert(table->xlCO2.begin() + k + 1, std::move(midTable));
+    }
+
+    solubilityTable_ = std::move(table);
+
+    return maxError;
+}
+
 template class BrineCo2Pvt<double>;
 template class BrineCo2Pvt<float>;
 
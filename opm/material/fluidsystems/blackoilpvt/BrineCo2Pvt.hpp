@@ -45,7 +45,9 @@
 
 #include <opm/input/eclipse/EclipseState/Co2StoreConfig.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace Opm {
@@ -518,6 +520,100 @@ public:
             return 0.0;
         }
 
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (solubilityTable_ && solubilityTable_->applies(temperature, pressure, salinity)) {
+            const Evaluation xlCO2 = solubilityTable_->eval(temperature, pressure, salinity);
+            return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
+        }
+#endif
+
+        const Evaluation xlCO2 = equilibriumMoleFractionCO2_(temperature, pressure, salinity);
+        return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
+    }
+
+    /*!
+     * \brief Replace the evaluation of the CO2 solubility in rsSat() by
+     *        interpolation in precomputed tables.
+     *
+     * The equilibrium mole fraction of CO2 in brine is tabulated on uniform
+     * (temperature, pressure) grids, one per sampled salinity, and
+     * interpolated bilinearly in (T, p) and linearly in salinity.  The
+     * (T, p) grids start out with the nodes of the tabulated CO2 density
+     * covering the requested range and are refined by doubling the
+     * resolution until the largest deviation from the exact value at the
+     * cell centres is below the tolerance.  Additional salinities are
+     * inserted between samples whose midpoint deviates by more than the
+     * tolerance.  States outside the tabulated range use the exact
+     * evaluation.
+     *
+     * \param salinities Salinities [mass fraction] to tabulate.  The salinity
+     *                   of each PVT region is always included.  If salt
+     *                   concentration is enabled, this should cover the
+     *                   expected range of salinities.
+     * \param tolerance Absolute tolerance for the mole fraction of CO2.
+     * \param maxSamples Upper bound on the number of samples per axis of
+     *                   the (T, p) grids.
+     *
+     * \return Largest deviation of the tables from the exact mole fraction
+     *         at the points used for the error control.
+     */
+    Scalar tabulateSolubility(Scalar minTemperature, Scalar maxTemperature,
+                              Scalar minPressure, Scalar maxPressure,
+                              std::vector<Scalar> salinities = {},
+                              Scalar tolerance = 1e-5,
+                              unsigned maxSamples = 1025);
+
+    /*!
+     * \brief Whether rsSat() uses tables, see tabulateSolubility().
+     */
+    bool solubilityIsTabulated() const
+    { return solubilityTable_ != nullptr; }
+
+private:
+    /*!
+     * \brief Mole fraction of CO2 in brine tabulated over (T, p, salinity).
+     */
+    struct SolubilityTable
+    {
+        template <class Evaluation>
+        bool applies(const Evaluation& temperature,
+                     const Evaluation& pressure,
+                     const Evaluation& salinity) const
+        {
+            const Scalar s = scalarValue(salinity);
+            return (salinities.front() <= s) && (s <= salinities.back())
+                && xlCO2.front().applies(temperature, pressure);
+        }
+
+        template <class Evaluation>
+        Evaluation eval(const Evaluation& temperature,
+                        const Evaluation& pressure,
+                        const Evaluation& salinity) const
+        {
+            if (salinities.size() == 1) {
+                return xlCO2.front().eval(temperature, pressure, /*extrapolate=*/false);
+            }
+
+            // interval of the salinity, the last one includes its upper end
+            const auto upper = std::upper_bound(salinities.begin(), salinities.end() - 1,
+                                                scalarValue(salinity));
+            const auto k = static_cast<std::size_t>(upper - salinities.begin()) - 1;
+            const Evaluation x0 = xlCO2[k].eval(temperature, pressure, /*extrapolate=*/false);
+            const Evaluation x1 = xlCO2[k + 1].eval(temperature, pressure, /*extrapolate=*/false);
+            const Evaluation w = (salinity - salinities[k]) / (salinities[k + 1] - salinities[k]);
+
+            return x0 + w*(x1 - x0);
+        }
+
+        std::vector<Scalar> salinities{};
+        std::vector<UniformTabulated2DFunction<Scalar>> xlCO2{};
+    };
+
+    template <class Evaluation>
+    OPM_HOST_DEVICE Evaluation equilibriumMoleFractionCO2_(const Evaluation& temperature,
+                                                           const Evaluation& pressure,
+                                                           const Evaluation& salinity) const
+    {
         // calulate the equilibrium composition for the given
         // temperature and pressure.
         Evaluation xgH2O;
@@ -533,12 +629,9 @@ public:
                                                     extrapolate);
 
         // normalize the phase compositions
-        xlCO2 = max(0.0, min(1.0, xlCO2));
-
-        return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
+        return max(0.0, min(1.0, xlCO2));
     }
 
-private:
     template <class LhsEval>
     OPM_HOST_DEVICE LhsEval ezrokhiExponent_(const LhsEval& temperature,
                              const ContainerT& ezrokhiCoeff) const
@@ -789,6 +882,7 @@ private:
     Co2StoreConfig::LiquidMixingType liquidMixType_{};
     Co2StoreConfig::SaltMixingType saltMixType_{};
     Params co2Tables_;
+    std::shared_ptr<const SolubilityTable> solubilityTable_{};
 };
 
 } // namespace Opm
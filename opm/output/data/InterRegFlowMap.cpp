@@ -31,54 +31,65 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <exception>
 #include <iterator>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+namespace {
+
+    void checkRegionIndices(const int r1, const int r2)
+    {
+        if ((r1 < 0) || (r2 < 0)) {
+            throw std::invalid_argument {
+                "Region indices must be non-negative.  Got (r1,r2) = ("
+                + std::to_string(r1) + ", " + std::to_string(r2)
+                + ')'
+            };
+        }
+    }
+
+} // Anonymous namespace
+
 void
 Opm::data::InterRegFlowMap::
 addConnection(const int        r1,
               const int        r2,
               const FlowRates& rates)
 {
-    if ((r1 < 0) || (r2 < 0)) {
-        throw std::invalid_argument {
-            "Region indices must be non-negative.  Got (r1,r2) = ("
-            + std::to_string(r1) + ", " + std::to_string(r2)
-            + ')'
-        };
-    }
+    checkRegionIndices(r1, r2);
 
     if (r1 == r2) {
         // Internal to a region.  Skip.
         return;
     }
 
-    const auto one   = Window::ElmT{1};
-    const auto sign  = (r1 < r2) ? one : -one;
-    const auto start = this->rates_.size();
-
-    auto low = r1, high = r2;
-    if (std::signbit(sign)) {
-        std::swap(low, high);
+    if (! this->addCompressed(r1, r2, rates, this->rates_)) {
+        this->appendConnection(r1, r2, rates);
     }
-
-    this->connections_.addConnection(low, high);
-
-    this->rates_.insert(this->rates_.end(), Window::bufferSize(), Window::ElmT{0});
-    Window { this->rates_.begin() + start, this->rates_.end() }.addFlow(sign, rates);
 }
 
 void Opm::data::InterRegFlowMap::compress(const std::size_t numRegions)
 {
+    constexpr auto sz = Window::bufferSize();
+
+    if (! this->connections_.startPointers().empty() &&
+        (numRegions == this->numRegions()) &&
+        (this->rates_.size() == this->numCompressedRates()))
+    {
+        // All connections accumulated directly into existing structure.
+        return;
+    }
+
     this->connections_.compress(numRegions);
 
     const auto v = this->rates_;
-    constexpr auto sz = Window::bufferSize();
     const auto& dstIx = this->connections_.compressedIndexMap();
 
     if (v.size() != dstIx.size()*sz) {
@@ -121,13 +132,7 @@ std::optional<std::pair<
 >>
 Opm::data::InterRegFlowMap::getInterRegFlows(const int r1, const int r2) const
 {
-    if ((r1 < 0) || (r2 < 0)) {
-        throw std::invalid_argument {
-            "Region indices must be non-negative.  Got (r1,r2) = ("
-            + std::to_string(r1) + ", " + std::to_string(r2)
-            + ')'
-        };
-    }
+    checkRegionIndices(r1, r2);
 
     if (r1 == r2) {
         // Internal to a region.  Skip.
@@ -148,27 +153,171 @@ Opm::data::InterRegFlowMap::getInterRegFlows(const int r1, const int r2) const
         std::swap(low, high);
     }
 
+    const auto windowID = this->compressedConnection(low, high);
+    if (! windowID.has_value()) {
+        // High is not connected to low.
+        return std::nullopt;
+    }
+
+    const auto sz = ReadOnlyWindow::bufferSize();
+
+    auto rateStart = this->rates_.begin() + (*windowID)*sz;
+
+    return { std::pair { ReadOnlyWindow { rateStart, rateStart + sz }, sign } };
+}
+
+void Opm::data::InterRegFlowMap::clear()
+{
+    this->connections_.clear();
+    this->rates_.clear();
+}
+
+void Opm::data::InterRegFlowMap::resetRates()
+{
+    if (this->rates_.size() != this->numCompressedRates()) {
+        throw std::logic_error {
+            "Cannot reset flow rates of uncompressed connections"
+        };
+    }
+
+    std::fill(this->rates_.begin(), this->rates_.end(), Window::ElmT{0});
+}
+
+std::size_t Opm::data::InterRegFlowMap::numCompressedRates() const
+{
+    return this->connections_.columnIndices().size() * Window::bufferSize();
+}
+
+std::optional<Opm::data::InterRegFlowMap::Offset>
+Opm::data::InterRegFlowMap::compressedConnection(const int low, const int high) const
+{
     const auto& ia = this->connections_.startPointers();
     const auto& ja = this->connections_.columnIndices();
 
+    if (static_cast<Offset>(low) + 1 >= ia.size()) {
+        // Low is not a row of compressed structure.
+        return std::nullopt;
+    }
+
     auto begin = ja.begin() + ia[low + 0];
     auto end   = ja.begin() + ia[low + 1];
     auto pos   = std::lower_bound(begin, end, high);
     if ((pos == end) || (*pos > high)) {
-        // High is not connected to low.
         return std::nullopt;
     }
 
-    const auto sz = ReadOnlyWindow::bufferSize();
-    const auto windowID = pos - ja.begin();
+    return static_cast<Offset>(pos - ja.begin());
+}
 
-    auto rateStart = this->rates_.begin() + windowID*sz;
+bool
+Opm::data::InterRegFlowMap::
+addCompressed(const int        r1,
+              const int        r2,
+              const FlowRates& rates,
+              RateBuffer&      dst) const
+{
+    const auto one  = Window::ElmT{1};
+    const auto sign = (r1 < r2) ? one : -one;
 
-    return { std::pair { ReadOnlyWindow { rateStart, rateStart + sz }, sign } };
+    auto low = r1, high = r2;
+    if (std::signbit(sign)) {
+        std::swap(low, high);
+    }
+
+    const auto windowID = this->compressedConnection(low, high);
+    if (! windowID.has_value()) {
+        return false;
+    }
+
+    constexpr auto sz = Window::bufferSize();
+    auto begin = dst.begin() + (*windowID)*sz;
+
+    Window { begin, begin + sz }.addFlow(sign, rates);
+
+    return true;
 }
 
-void Opm::data::InterRegFlowMap::clear()
+void
+Opm::data::InterRegFlowMap::
+appendConnection(const int        r1,
+                 const int        r2,
+                 const FlowRates& rates)
 {
-    this->connections_.clear();
-    this->rates_.clear();
+    const auto one   = Window::ElmT{1};
+    const auto sign  = (r1 < r2) ? one : -one;
+    const auto start = this->rates_.size();
+
+    auto low = r1, high = r2;
+    if (std::signbit(sign)) {
+        std::swap(low, high);
+    }
+
+    this->connections_.addConnection(low, high);
+
+    this->rates_.insert(this->rates_.end(), Window::bufferSize(), Window::ElmT{0});
+    Window { this->rates_.begin() + start, this->rates_.end() }.addFlow(sign, rates);
+}
+
+void
+Opm::data::InterRegFlowMap::
+addConnection(const int        r1,
+              const int        r2,
+              const FlowRates& rates,
+              PartialRates&    partial) const
+{
+    checkRegionIndices(r1, r2);
+
+    if (r1 == r2) {
+        // Internal to a region.  Skip.
+        return;
+    }
+
+    if (! this->addCompressed(r1, r2, rates, partial.rates)) {
+        partial.newConnections.emplace_back(r1, r2, rates);
+    }
+}
+
+std::vector<Opm::data::InterRegFlowMap::PartialRates>
+Opm::data::InterRegFlowMap::makePartialRates(const std::size_t numConnections) const
+{
+    // Fixed block count, independent of the number of threads, to make
+    // the summation order reproducible.  Small ranges use fewer blocks to
+    // limit the cost of the private rate buffers.
+    constexpr auto maxNumBlocks = std::size_t{32};
+    constexpr auto minBlockSize = std::size_t{1} << 14;
+
+    const auto numBlocks = std::clamp((numConnections + minBlockSize - 1) / minBlockSize,
+                                      std::size_t{1}, maxNumBlocks);
+
+    const auto blockSize = (numConnections + numBlocks - 1) / numBlocks;
+
+    auto partial = std::vector<PartialRates>(numBlocks);
+    for (auto block = 0*numBlocks; block < numBlocks; ++block) {
+        partial[block].begin = std::min(block * blockSize, numConnections);
+        partial[block].end   = std::min(partial[block].begin + blockSize, numConnections);
+    }
+
+    return partial;
+}
+
+void
+Opm::data::InterRegFlowMap::
+mergePartialRates(const std::vector<PartialRates>& partial)
+{
+    const auto numRates = static_cast<long>(this->numCompressedRates());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (long i = 0; i < numRates; ++i) {
+        for (const auto& blockRates : partial) {
+            this->rates_[i] += blockRates.rates[i];
+        }
+    }
+
+    for (const auto& blockRates : partial) {
+        for (const auto& [r1, r2, rates] : blockRates.newConnections) {
+            this->appendConnection(r1, r2, rates);
+        }
+    }
 }
@@ -25,9 +25,11 @@
 #include <opm/output/data/InterRegFlow.hpp>
 
 #include <opm/common/utility/CSRGraphFromCoordinates.hpp>
+#include <opm/common/utility/ParallelFor.hpp>
 
 #include <cstddef>
 #include <optional>
+#include <tuple>
 #include <utility>
 #include <type_traits>
 #include <vector>
@@ -38,6 +40,12 @@
 /// (CSR) adjacency matrix representation of a graph.  Supports O(nnz)
 /// compression and, if applicable, accumulation of weight values for
 /// repeated entity pairs.
+///
+/// The connection structure is typically the same at every report step.
+/// Clients may therefore call resetRates() instead of clear() between
+/// steps, in which case the rates of already known region pairs are
+/// accumulated directly into the compressed structure and compress() has
+/// no sorting to do unless new region pairs appear.
 
 namespace Opm { namespace data {
 
@@ -83,8 +91,54 @@ namespace Opm { namespace data {
         /// \param[in] rates Flow rates associated to single connection.
         ///
         /// If both region IDs are the same then this function does nothing.
+        /// If the region pair already exists in the compressed structure,
+        /// e.g., following a call to resetRates(), then the rates are
+        /// accumulated directly into the existing connection.
         void addConnection(const int r1, const int r2, const FlowRates& rates);
 
+        /// Add a range of flow rate connections between regions.
+        ///
+        /// Equivalent to calling addConnection() for each connection in
+        /// turn, but runs in parallel when OpenMP is available.  The range
+        /// is split into a number of blocks which is independent of the
+        /// number of threads.  Each block accumulates into a private copy
+        /// of the compressed rates, and the copies are summed in block
+        /// order afterwards whence the result does not depend on the
+        /// number of threads.  Region pairs which are not in the compressed
+        /// structure are appended as if by addConnection().
+        ///
+        /// \tparam GetConnection Callable type.  Called as
+        ///    \code getConnection(i) \endcode for each connection index \c
+        ///    i in the range [0, numConnections) and must return a tuple
+        ///    \code (r1, r2, rates) \endcode of the source and sink region
+        ///    indices and the connection's flow rates.  Must be safe to
+        ///    call concurrently.
+        ///
+        /// \param[in] numConnections Number of connections in range.
+        ///
+        /// \param[in] getConnection Connection accessor.
+        template <typename GetConnection>
+        void addConnections(const std::size_t numConnections,
+                            GetConnection&&   getConnection)
+        {
+            auto partial = this->makePartialRates(numConnections);
+
+            utility::parallelFor(partial.size(),
+                [this, &partial, &getConnection](const std::size_t block)
+            {
+                auto& blockRates = partial[block];
+
+                blockRates.rates.assign(this->numCompressedRates(), Window::ElmT{0});
+
+                for (auto conn = blockRates.begin; conn < blockRates.end; ++conn) {
+                    const auto& [r1, r2, rates] = getConnection(conn);
+                    this->addConnection(r1, r2, rates, blockRates);
+                }
+            });
+
+            this->mergePartialRates(partial);
+        }
+
         /// Form CSR adjacency matrix representation of input graph from
         /// connections established in previous calls to addConnection().
         ///
@@ -137,13 +191,83 @@ namespace Opm { namespace data {
         /// Clear all internal buffers, but preserve allocated capacity.
         void clear();
 
+        /// Reset all accumulated flow rates to zero, but preserve the
+        /// compressed connection structure.
+        ///
+        /// Intended for repeated accumulation of flows over the same set
+        /// of region pairs, e.g., at each report step.  Throws an object
+        /// of type \code std::logic_error \endcode if there are
+        /// connections which have not yet been compressed.
+        void resetRates();
+
     private:
         // VertexID = int, TrackCompressedIdx = true.
         using Graph = utility::CSRGraphFromCoordinates<int, true>;
 
+        /// Flow rates accumulated by a single block of addConnections().
+        struct PartialRates
+        {
+            /// Beginning of block's connection index range.
+            std::size_t begin{};
+
+            /// One past the end of block's connection index range.
+            std::size_t end{};
+
+            /// Rates of region pairs in compressed structure.  Same layout
+            /// as the compressed part of \c rates_.
+            RateBuffer rates{};
+
+            /// Connections between region pairs not in compressed structure.
+            std::vector<std::tuple<int, int, FlowRates>> newConnections{};
+        };
+
         Graph connections_{};
         RateBuffer rates_{};
 
+        /// Number of rate elements backing the compressed connections.
+        std::size_t numCompressedRates() const;
+
+        /// Linear index of compressed connection between region pair.
+        ///
+        /// \param[in] low Smaller zero-based region index.
+        /// \param[in] high Larger zero-based region index.
+        ///
+        /// \return Connection index.  Nullopt if the region pair does not
+        ///    exist in the compressed structure.
+        std::optional<Offset> compressedConnection(const int low, const int high) const;
+
+        /// Accumulate flow rates into existing compressed connection.
+        ///
+        /// \param[in] r1 Primary (source) zero-based region index.
+        /// \param[in] r2 Secondary (sink) zero-based region index.  Must
+        ///    differ from \p r1.
+        /// \param[in] rates Flow rates associated to single connection.
+        /// \param[in,out] dst Rate buffer with compressed connection layout.
+        ///
+        /// \return Whether or not the region pair exists in the compressed
+        ///    structure.
+        bool addCompressed(const int         r1,
+                           const int         r2,
+                           const FlowRates&  rates,
+                           RateBuffer&       dst) const;
+
+        /// Add flow rate connection between regions at end of uncompressed
+        /// connection list.
+        void appendConnection(const int r1, const int r2, const FlowRates& rates);
+
+        /// Add flow rate connection between regions into block's private
+        /// buffers.  Thread safe.
+        void addConnection(const int        r1,
+                           const int        r2,
+                           const FlowRates& rates,
+                           PartialRates&    partial) const;
+
+        /// Split connection index range into blocks for addConnections().
+        std::vector<PartialRates> makePartialRates(const std::size_t numConnections) const;
+
+        /// Sum block-wise flow rates into internal rate buffer.
+        void mergePartialRates(const std::vector<PartialRates>& partial);
+
         template <typename T, class A, class MessageBufferType>
         void writeVector(const std::vector<T,A>& vec,
                          MessageBufferType&      buffer) const
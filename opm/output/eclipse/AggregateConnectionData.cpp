@@ -24,6 +24,8 @@
 
 #include <opm/output/data/Wells.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
@@ -80,6 +82,8 @@ namespace {
         }
     }
 
+    // Wells are processed in parallel.  The connections of a well are
+    // written to the well's own row of the connection arrays.
     template <class ConnOp>
     void wellConnectionLoop(const Opm::Schedule&    sched,
                             const std::size_t       sim_step,
@@ -87,14 +91,18 @@ namespace {
                             const Opm::data::Wells& xw,
                             ConnOp&&                connOp)
     {
-        for (const auto& wname : sched.wellNames(sim_step)) {
-            const auto  well_iter = xw.find(wname);
+        const auto& wells = sched.wellNames(sim_step);
+
+        Opm::utility::parallelFor(wells.size(),
+            [&wells, &sched, sim_step, &grid, &xw, &connOp](const std::size_t i)
+        {
+            const auto  well_iter = xw.find(wells[i]);
             const auto* wellRes   = (well_iter == xw.end())
                 ? nullptr : &well_iter->second;
 
-            connectionLoop(grid, sched.getWell(wname, sim_step),
+            connectionLoop(grid, sched.getWell(wells[i], sim_step),
                            wellRes, connOp);
-        }
+        }, 16);
     }
 
     namespace IConn {
@@ -335,6 +343,20 @@ AggregateConnectionData(const std::vector<int>& inteHead)
 
 // ---------------------------------------------------------------------
 
+void
+Opm::RestartIO::Helpers::AggregateConnectionData::
+reset(const std::vector<int>& inteHead)
+{
+    const auto nWells = numWells(inteHead);
+    const auto nConn  = maxNumConn(inteHead);
+
+    this->iConn_.reset({ nWells }, { nConn }, { IConn::entriesPerConn(inteHead) });
+    this->sConn_.reset({ nWells }, { nConn }, { SConn::entriesPerConn(inteHead) });
+    this->xConn_.reset({ nWells }, { nConn }, { XConn::entriesPerConn(inteHead) });
+}
+
+// ---------------------------------------------------------------------
+
 void
 Opm::RestartIO::Helpers::AggregateConnectionData::
 captureDeclaredConnData(const Schedule&     sched,
@@ -43,6 +43,13 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateConnectionData(const std::vector<int>& inteHead);
 
+        /// Prepare for capturing the connection data of another report
+        /// step.
+        ///
+        /// Reinitialises the arrays to the dimensions in \p inteHead,
+        /// reusing the existing storage where possible.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredConnData(const Opm::Schedule&        sched,
                                      const Opm::EclipseGrid&     grid,
                                      const Opm::UnitSystem&      units,
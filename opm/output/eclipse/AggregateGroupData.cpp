@@ -24,6 +24,8 @@
 #include <opm/output/eclipse/VectorItems/well.hpp>
 #include <opm/output/eclipse/VectorItems/intehead.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
 #include <opm/input/eclipse/Schedule/Network/ExtNetwork.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
@@ -105,20 +107,21 @@ int nwgmax(const std::vector<int>& inteHead)
 }
 
 
+// Groups are processed in parallel.  Every group writes to its own window
+// only.
 template <typename GroupOp>
 void groupLoop(const std::vector<const Opm::Group*>& groups,
                GroupOp&&                             groupOp)
 {
-    auto groupID = std::size_t {0};
-    for (const auto* group : groups) {
-        groupID += 1;
-
-        if (group == nullptr) {
-            continue;
+    Opm::utility::parallelFor(groups.size(),
+        [&groups, &groupOp](const std::size_t groupID)
+    {
+        if (groups[groupID] == nullptr) {
+            return;
         }
 
-        groupOp(*group, groupID - 1);
-    }
+        groupOp(*groups[groupID], groupID);
+    }, 16);
 }
 
 template <typename T>
@@ -1175,6 +1178,23 @@ AggregateGroupData(const std::vector<int>& inteHead)
 
 // ---------------------------------------------------------------------
 
+void
+Opm::RestartIO::Helpers::AggregateGroupData::
+reset(const std::vector<int>& inteHead)
+{
+    const auto nGroups = ngmaxz(inteHead);
+
+    this->iGroup_.reset({ nGroups }, { IGrp::entriesPerGroup(inteHead) });
+    this->sGroup_.reset({ nGroups }, { SGrp::entriesPerGroup(inteHead) });
+    this->xGroup_.reset({ nGroups }, { XGrp::entriesPerGroup(inteHead) });
+    this->zGroup_.reset({ nGroups }, { ZGrp::entriesPerGroup(inteHead) });
+
+    this->nWGMax_ = nwgmax(inteHead);
+    this->nGMaxz_ = ngmaxz(inteHead);
+}
+
+// ---------------------------------------------------------------------
+
 void
 Opm::RestartIO::Helpers::AggregateGroupData::
 captureDeclaredGroupData(const Opm::Schedule&                 sched,
@@ -1186,7 +1206,7 @@ captureDeclaredGroupData(const Opm::Schedule&                 sched,
     const auto& curGroups = sched.restart_groups(simStep);
     const auto& sched_state = sched[simStep];
 
-    groupLoop(curGroups, [&sched, simStep, sumState, this]
+    groupLoop(curGroups, [&sched, simStep, &sumState, this]
               (const Group& group, const std::size_t groupID) -> void
     {
         auto ig = this->iGroup_[groupID];
@@ -42,6 +42,12 @@ class AggregateGroupData
 public:
     explicit AggregateGroupData(const std::vector<int>& inteHead);
 
+    /// Prepare for capturing the group data of another report step.
+    ///
+    /// Reinitialises the arrays to the dimensions in \p inteHead, reusing
+    /// the existing storage where possible.
+    void reset(const std::vector<int>& inteHead);
+
     void captureDeclaredGroupData(const Opm::Schedule&        sched,
                          const Opm::UnitSystem&               units,
                          const std::size_t                    simStep,
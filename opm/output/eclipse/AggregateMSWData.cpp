@@ -22,6 +22,8 @@
 #include <opm/output/eclipse/InteHEAD.hpp>
 #include <opm/output/eclipse/VectorItems/msw.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
 #include <opm/input/eclipse/Schedule/MSW/AICD.hpp>
@@ -387,18 +389,19 @@ namespace {
         return (inFlowSegInd == -1) ? 0 : inFlowSegInd;
     }
 
+    // Multi-segment wells are processed in parallel.  Every well writes
+    // to its own window only.
     template <typename MSWOp>
     void MSWLoop(const std::vector<const Opm::Well*>& wells,
                  MSWOp&&                              mswOp)
     {
-        auto mswID = std::size_t{0};
-        for (const auto* well : wells) {
-            mswID += 1;
-
-            if (well == nullptr) { continue; }
+        Opm::utility::parallelFor(wells.size(),
+            [&wells, &mswOp](const std::size_t mswID)
+        {
+            if (wells[mswID] == nullptr) { return; }
 
-            mswOp(*well, mswID - 1);
-        }
+            mswOp(*wells[mswID], mswID);
+        }, 16);
     }
 
     namespace ISeg {
@@ -1319,6 +1322,20 @@ AggregateMSWData(const std::vector<int>& inteHead)
 
 // ---------------------------------------------------------------------
 
+void
+Opm::RestartIO::Helpers::AggregateMSWData::
+reset(const std::vector<int>& inteHead)
+{
+    const auto nMSW = nswlmx(inteHead);
+
+    this->iSeg_.reset({ nMSW }, { ISeg::entriesPerMSW(inteHead) });
+    this->rSeg_.reset({ nMSW }, { RSeg::entriesPerMSW(inteHead) });
+    this->iLBS_.reset({ nMSW }, { ILBS::entriesPerMSW(inteHead) });
+    this->iLBR_.reset({ nMSW }, { ILBR::maxBranchesPerMSWell(inteHead) }, { nilbrz(inteHead) });
+}
+
+// ---------------------------------------------------------------------
+
 void
 Opm::RestartIO::Helpers::AggregateMSWData::
 captureDeclaredMSWData(const Schedule&          sched,
@@ -40,6 +40,12 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateMSWData(const std::vector<int>& inteHead);
 
+        /// Prepare for capturing the segment data of another report step.
+        ///
+        /// Reinitialises the arrays to the dimensions in \p inteHead,
+        /// reusing the existing storage where possible.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredMSWData(const Opm::Schedule&     sched,
                                     const std::size_t        rptStep,
                                     const Opm::UnitSystem&   units,
@@ -20,6 +20,7 @@
 #include <opm/output/eclipse/AggregateUDQData.hpp>
 
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/ParallelFor.hpp>
 
 #include <opm/output/eclipse/AggregateGroupData.hpp>
 #include <opm/output/eclipse/InteHEAD.hpp>
@@ -1053,27 +1054,33 @@ collectSegmentUDQValues(const std::vector<UDQInput>&    udqInput,
 {
     assert (msWells.size() <= this->dUDS_->numCols());
 
-    auto udqIdx = WindowedMatrix<double>::Idx{0};
+    auto segmentUDQs = std::vector<const UDQInput*>{};
     for (const auto& udq_input : udqInput) {
-        if (udq_input.var_type() != UDQVarType::SEGMENT_VAR) {
-            continue;
+        if (udq_input.var_type() == UDQVarType::SEGMENT_VAR) {
+            segmentUDQs.push_back(&udq_input);
         }
+    }
 
-        if (udqIdx >= this->dUDS_->numRows()) {
-            throw std::logic_error {
-                fmt::format("UDQ variable index {} exceeds number "
-                            "of declared segment level UDQs {}",
-                            udqIdx, this->dUDS_->numRows())
-            };
-        }
+    if (segmentUDQs.size() > this->dUDS_->numRows()) {
+        throw std::logic_error {
+            fmt::format("Number of segment level UDQs {} exceeds number "
+                        "of declared segment level UDQs {}",
+                        segmentUDQs.size(), this->dUDS_->numRows())
+        };
+    }
 
-        for (auto mswIdx = 0*msWells.size(); mswIdx < msWells.size(); ++mswIdx) {
-            auto duds = (*this->dUDS_)(udqIdx, mswIdx);
-            udqState.exportSegmentUDQ(udq_input.keyword(), msWells[mswIdx], duds);
-        }
+    // Every (UDQ, well) pair has its own window.
+    const auto numMsWells = msWells.size();
+    Opm::utility::parallelFor(segmentUDQs.size() * numMsWells,
+                              [&segmentUDQs, &msWells, &udqState, numMsWells, this]
+                              (const std::size_t i)
+    {
+        const auto udqIdx = i / numMsWells;
+        const auto mswIdx = i % numMsWells;
 
-        ++udqIdx;
-    }
+        auto duds = (*this->dUDS_)(udqIdx, mswIdx);
+        udqState.exportSegmentUDQ(segmentUDQs[udqIdx]->keyword(), msWells[mswIdx], duds);
+    }, 16);
 }
 
 // ---------------------------------------------------------------------------
@@ -1086,22 +1093,24 @@ collectWellUDQValues(const std::vector<UDQInput>&    udqInput,
                      const std::vector<std::string>& wells,
                      const int                       expectedNumWellUDQs)
 {
-    auto ix = std::size_t {0};
-
-    int cnt = 0;
+    auto wellUDQs = std::vector<const UDQInput*>{};
     for (const auto& udq_input : udqInput) {
         if (udq_input.var_type() == UDQVarType::WELL_VAR) {
-            auto dudw = (*this->dUDW_)[ix];
-
-            dUdw::staticContrib(udqState, wells,
-                                udq_input.keyword(),
-                                nwmax, dudw);
-
-            ++ix;
-            ++cnt;
+            wellUDQs.push_back(&udq_input);
         }
     }
 
+    Opm::utility::parallelFor(wellUDQs.size(),
+                              [&wellUDQs, &udqState, &wells, nwmax, this](const std::size_t ix)
+    {
+        auto dudw = (*this->dUDW_)[ix];
+
+        dUdw::staticContrib(udqState, wells,
+                            wellUDQs[ix]->keyword(),
+                            nwmax, dudw);
+    }, 16);
+
+    const auto cnt = static_cast<int>(wellUDQs.size());
     if (cnt != expectedNumWellUDQs) {
         OpmLog::error(fmt::format("Inconsistent number of DUDW elements: {}, "
                                   "expected number of DUDW elements {}.",
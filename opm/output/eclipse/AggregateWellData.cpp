@@ -25,6 +25,8 @@
 
 #include <opm/output/data/Wells.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/Schedule/Action/ActionAST.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
@@ -101,16 +103,20 @@ namespace {
         return s.substr(b, e - b + 1);
     }
 
+    // Wells are processed in parallel.  Every well writes to its own
+    // window only.
     template <typename WellOp>
     void wellLoop(const std::vector<std::string>& wells,
                   const Opm::Schedule&            sched,
                   const std::size_t               simStep,
                   WellOp&&                        wellOp)
     {
-        for (const auto& wname : wells) {
-            const auto& well = sched.getWell(wname, simStep);
+        Opm::utility::parallelFor(wells.size(),
+            [&wells, &sched, simStep, &wellOp](const std::size_t i)
+        {
+            const auto& well = sched.getWell(wells[i], simStep);
             wellOp(well, well.seqIndex());
-        }
+        }, 16);
     }
 
     namespace IWell {
@@ -1496,6 +1502,22 @@ AggregateWellData(const std::vector<int>& inteHead)
 
 // ---------------------------------------------------------------------
 
+void
+Opm::RestartIO::Helpers::AggregateWellData::
+reset(const std::vector<int>& inteHead)
+{
+    const auto nWells = numWells(inteHead);
+
+    this->iWell_.reset({ nWells }, { IWell::entriesPerWell(inteHead) });
+    this->sWell_.reset({ nWells }, { SWell::entriesPerWell(inteHead) });
+    this->xWell_.reset({ nWells }, { XWell::entriesPerWell(inteHead) });
+    this->zWell_.reset({ nWells }, { ZWell::entriesPerWell(inteHead) });
+
+    this->nWGMax_ = maxNumGroups(inteHead);
+}
+
+// ---------------------------------------------------------------------
+
 void
 Opm::RestartIO::Helpers::AggregateWellData::
 captureDeclaredWellData(const Schedule&             sched,
@@ -1514,21 +1536,31 @@ captureDeclaredWellData(const Schedule&             sched,
         const auto groupMapNameIndex =
             IWell::currentGroupMapNameIndex(sched, sim_step, inteHead);
 
-        auto msWellID = std::size_t{0};
+        // 1-based multi-segment well index, counted in the order of
+        // 'wells'.  Assigned up front since wells are processed in
+        // parallel.
+        auto msWellID = std::vector<std::size_t>(this->iWell_.numWindows(), 0);
+        {
+            auto mswID = std::size_t{0};
+            for (const auto& wname : wells) {
+                const auto& well = sched.getWell(wname, sim_step);
+
+                mswID += well.isMultiSegment();
+                msWellID[well.seqIndex()] = mswID;
+            }
+        }
+
+        const auto& wtest_config = sched[sim_step].wtest_config();
 
         wellLoop(wells, sched, sim_step,
                  [&groupMapNameIndex, &msWellID,
-                  &step_glo, &wtest_state, &smry,
-                  &sched, &sim_step, this]
+                  &step_glo, &wtest_config, &wtest_state, &smry, this]
                  (const Well& well, const std::size_t wellID) -> void
         {
-            const auto& wtest_config = sched[sim_step].wtest_config();
-
-            msWellID += well.isMultiSegment();  // 1-based index.
-            auto iw   = this->iWell_[wellID];
+            auto iw = this->iWell_[wellID];
 
             IWell::staticContrib(well, step_glo, wtest_config, wtest_state,
-                                 smry, msWellID, groupMapNameIndex, iw);
+                                 smry, msWellID[wellID], groupMapNameIndex, iw);
         });
     }
 
@@ -49,6 +49,12 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateWellData(const std::vector<int>& inteHead);
 
+        /// Prepare for capturing the well data of another report step.
+        ///
+        /// Reinitialises the arrays to the dimensions in \p inteHead,
+        /// reusing the existing storage where possible.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredWellData(const Schedule&   	       sched,
                                      const TracerConfig&       tracer,
                                      const std::size_t 		     sim_step,
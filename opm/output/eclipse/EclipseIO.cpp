@@ -47,6 +47,7 @@
 #include <opm/output/eclipse/WriteRFT.hpp>
 #include <opm/output/eclipse/WriteRPT.hpp>
 
+#include <opm/io/eclipse/AsyncWriter.hpp>
 #include <opm/io/eclipse/ESmry.hpp>
 #include <opm/io/eclipse/OutputStream.hpp>
 
@@ -62,6 +63,7 @@
 #include <optional>
 #include <stdexcept>
 #include <sstream>
+#include <string>
 #include <unordered_map>
 #include <utility>    // move
 #include <vector>
@@ -107,6 +109,8 @@ public:
          const std::string& baseName,
          const bool writeEsmry);
 
+    ~Impl();
+
     void writeINITFile(const data::Solution&                   simProps,
                        std::map<std::string, std::vector<int>> int_data,
                        const std::vector<NNCdata>&             nnc) const;
@@ -133,6 +137,17 @@ public:
 
     std::optional<RestartIO::Helpers::AggregateAquiferData> aquiferData{std::nullopt};
 
+    /// Restart array aggregators, retained between report steps.
+    RestartIO::AggregateBuffers restartBuffers{};
+
+    /// Background writer for restart, RFT and summary output.  Null in
+    /// the default, synchronous, output mode.
+    std::shared_ptr<EclIO::AsyncWriter> asyncWriter{};
+
+    /// Whether or not to maintain array index sidecars of restart, RFT
+    /// and summary output.
+    EclIO::OutputStream::Indexed arrayIndex{ false };
+
 private:
     mutable bool sumthin_active_{false};
     mutable bool sumthin_triggered_{false};
@@ -167,13 +182,28 @@ Opm::EclipseIO::Impl::Impl(const EclipseState& eclipseState,
     }
 }
 
+Opm::EclipseIO::Impl::~Impl()
+{
+    if (this->asyncWriter == nullptr) {
+        return;
+    }
+
+    try {
+        this->asyncWriter->fence();
+    }
+    catch (const std::exception& e) {
+        OpmLog::error(std::string { "Failed to write result files: " } + e.what());
+    }
+}
+
 void Opm::EclipseIO::Impl::writeINITFile(const data::Solution&                   simProps,
                                          std::map<std::string, std::vector<int>> int_data,
                                          const std::vector<NNCdata>&             nnc) const
 {
     EclIO::OutputStream::Init initFile {
         EclIO::OutputStream::ResultSet { this->outputDir, this->baseName },
-        EclIO::OutputStream::Formatted { this->es.cfg().io().getFMTOUT() }
+        EclIO::OutputStream::Formatted { this->es.cfg().io().getFMTOUT() },
+        this->asyncWriter
     };
 
     InitIO::write(this->es, this->grid, this->schedule,
@@ -329,6 +359,9 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
     }
 
     if (final_step && !isSubstep && this->impl->summaryConfig.createRunSummary()) {
+        // The RSM file is generated from the summary files on disk.
+        this->flushAsyncOutput();
+
         std::filesystem::path outputDir { this->impl->outputDir } ;
         std::filesystem::path outputFile { outputDir / this->impl->baseName } ;
         EclIO::ESmry(outputFile.generic_string()).write_rsm_file();
@@ -340,12 +373,15 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
                                              this->impl->baseName },
             report_index,
             EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
+            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() },
+            this->impl->asyncWriter,
+            this->impl->arrayIndex
         };
 
         RestartIO::save(rstFile, report_step, secs_elapsed, value,
                         es, grid, schedule, action_state, wtest_state, st,
-                        udq_state, this->impl->aquiferData, write_double);
+                        udq_state, this->impl->aquiferData,
+                        this->impl->restartBuffers, write_double);
     }
 
     // RFT file written only if requested and never for substeps.
@@ -362,7 +398,9 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
             EclIO::OutputStream::ResultSet { this->impl->outputDir,
                                              this->impl->baseName },
             EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            openExisting
+            openExisting,
+            this->impl->asyncWriter,
+            this->impl->arrayIndex
         };
 
         RftIO::write(report_step, secs_elapsed, es.getUnits(),
@@ -409,3 +447,24 @@ const Opm::SummaryConfig& Opm::EclipseIO::finalSummaryConfig() const
 {
     return this->impl->summaryConfig;
 }
+
+void Opm::EclipseIO::enableAsyncOutput(const std::size_t maxPendingBytes)
+{
+    this->flushAsyncOutput();
+
+    this->impl->asyncWriter = std::make_shared<EclIO::AsyncWriter>(maxPendingBytes);
+    this->impl->summary.setAsyncWriter(this->impl->asyncWriter);
+}
+
+void Opm::EclipseIO::flushAsyncOutput()
+{
+    if (this->impl->asyncWriter != nullptr) {
+        this->impl->asyncWriter->fence();
+    }
+}
+
+void Opm::EclipseIO::enableArrayIndex()
+{
+    this->impl->arrayIndex.set = true;
+    this->impl->summary.enableArrayIndex();
+}
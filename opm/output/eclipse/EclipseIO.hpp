@@ -27,6 +27,7 @@
 #include <opm/output/data/Solution.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
@@ -189,6 +190,34 @@ public:
     const out::Summary& summary() const;
     const SummaryConfig& finalSummaryConfig() const;
 
+    /// \brief Write INIT, restart, RFT and summary files on a background
+    /// thread.
+    ///
+    /// Subsequent calls to writeInitial() and writeTimeStep() encode their
+    /// output arrays on the calling thread, but return without waiting for
+    /// the encoded data to reach the file system.  The contents and
+    /// ordering of all output files are unchanged.  Opening a restart or
+    /// RFT file waits for the output of earlier report steps to complete.
+    ///
+    /// \param[in] maxPendingBytes Upper bound on the amount of encoded but
+    ///    not yet written output data.  Calls to writeInitial() and
+    ///    writeTimeStep() block while this limit is exceeded.
+    void enableAsyncOutput(const std::size_t maxPendingBytes);
+
+    /// \brief Wait for all pending background output to complete.
+    ///
+    /// Throws if any pending write operation failed.  No-op unless
+    /// enableAsyncOutput() has been called.
+    void flushAsyncOutput();
+
+    /// \brief Accompany unified restart and summary files, and the RFT
+    /// file, with array index sidecars.
+    ///
+    /// The sidecar <filename>.ARRIDX spares later readers of large result
+    /// files the scan over all array headers (see EclIO::ArrayIndexEntry).
+    /// Applies to output files opened after this call.
+    void enableArrayIndex();
+
 private:
     class Impl;
     std::unique_ptr<Impl> impl;
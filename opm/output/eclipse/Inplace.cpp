@@ -82,6 +82,18 @@ void Inplace::add(const std::string&   region,
     this->phase_values[region][phase][region_id] = value;
 }
 
+void Inplace::add(const std::string&         region,
+                  const Inplace::Phase       phase,
+                  const std::vector<double>& values)
+{
+    auto& region_values = this->phase_values[region][phase];
+    region_values.reserve(values.size());
+
+    for (auto i = 0*values.size(); i < values.size(); ++i) {
+        region_values[i + 1] = values[i];
+    }
+}
+
 void Inplace::add(Inplace::Phase phase, double value)
 {
     this->add(FIELD_NAME, phase, FIELD_ID, value);
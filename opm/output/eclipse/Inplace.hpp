@@ -98,6 +98,19 @@ public:
              std::size_t        region_number,
              double             value);
 
+    /// Assign values of particular quantity in all regions of named
+    /// region set.
+    ///
+    /// \param[in] region Region set name such as FIPNUM or FIPABC.
+    ///
+    /// \param[in] phase In-place quantity.
+    ///
+    /// \param[in] values Numerical values of \p phase quantity, indexed by
+    ///   (region_number - 1).
+    void add(const std::string&         region,
+             Phase                      phase,
+             const std::vector<double>& values);
+
     /// Assign field-level value of particular quantity.
     ///
     /// \param[in] phase In-place quantity.
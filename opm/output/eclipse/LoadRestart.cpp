@@ -27,6 +27,8 @@
 #include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/RestartFileView.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/output/data/Aquifer.hpp>
 #include <opm/output/data/Cells.hpp>
 #include <opm/output/data/Solution.hpp>
@@ -605,42 +607,6 @@ namespace {
         return {};
     }
 
-    void insertSolutionVector(const std::vector<double>&           vector,
-                              const Opm::RestartKey&               value,
-                              const std::vector<double>::size_type numcells,
-                              Opm::data::Solution&                 sol)
-    {
-        if (vector.size() != numcells) {
-            throw std::runtime_error {
-                "Restart file: Could not restore '"
-                + value.key
-                + "', mismatched number of cells"
-            };
-        }
-
-        sol.insert(value.key, value.dim, vector,
-                   Opm::data::TargetType::RESTART_SOLUTION);
-    }
-
-    void loadIfAvailable(const Opm::RestartKey&               value,
-                         const std::vector<double>::size_type numcells,
-                         const Opm::EclIO::RestartFileView&   rst_view,
-                         Opm::data::Solution&                 sol)
-    {
-        const auto& kwdata = double_vector(value.key, rst_view);
-
-        if (kwdata.empty()) {
-            throwIfMissingRequired(value);
-
-            // If we get here, the requested value was not available in the
-            // result set.  However, the client does not actually require
-            // the value for restart purposes so we can safely skip this.
-            return;
-        }
-
-        insertSolutionVector(kwdata, value, numcells, sol);
-    }
-
     std::vector<double>
     getOpmExtraFromDoubHEAD(const bool                         required,
                             const Opm::UnitSystem&             usys,
@@ -659,16 +625,73 @@ namespace {
         return { usys.to_si(M::time, TsInit) };
     }
 
+    // Vectors of the restart file which are read when restoring the
+    // simulator state, in addition to the solution and extra vectors.
+    std::vector<std::string> restartStateVectors()
+    {
+        return {
+            "INTEHEAD", "LOGIHEAD", "DOUBHEAD",
+            "IWEL", "XWEL", "ICON", "XCON",
+            "IGRP", "XGRP", "ISEG", "RSEG",
+            "IAAQ", "SAAQ", "XAAQ", "IAQN", "RAQN",
+            "ZUDN", "DUDF", "DUDG", "DUDS", "DUDW",
+        };
+    }
+
+    // Run the tasks concurrently.  If any of them fail, the exception of
+    // the first failed task in 'tasks' is rethrown once all have finished.
+    void runConcurrently(const std::vector<std::function<void()>>& tasks)
+    {
+        Opm::utility::parallelFor(tasks.size(),
+                                  [&tasks](const std::size_t task) { tasks[task](); });
+    }
+
+    // The solution vectors are copied out of the restart file and
+    // converted to SI units in parallel, one vector per thread.
     Opm::data::Solution
     restoreSOLUTION(const std::vector<Opm::RestartKey>& solution_keys,
                     const int                           numcells,
+                    const Opm::UnitSystem&              usys,
                     const Opm::EclIO::RestartFileView&  rst_view)
     {
-        Opm::data::Solution sol(/* init_si = */ false);
+        std::vector<std::vector<double>> kwdata(solution_keys.size());
+
+        Opm::utility::parallelFor(solution_keys.size(),
+            [&solution_keys, &kwdata, numcells, &usys, &rst_view](const std::size_t key)
+        {
+            const auto& value = solution_keys[key];
+
+            kwdata[key] = double_vector(value.key, rst_view);
+            if (kwdata[key].empty()) {
+                throwIfMissingRequired(value);
+
+                // Requested value is not available in the result set,
+                // but the client does not require it for restart
+                // purposes.
+                return;
+            }
+
+            if (kwdata[key].size() != static_cast<std::size_t>(numcells)) {
+                throw std::runtime_error {
+                    "Restart file: Could not restore '"
+                    + value.key
+                    + "', mismatched number of cells"
+                };
+            }
 
-        for (const auto& value : solution_keys) {
-            // Load vector if available.
-            loadIfAvailable(value, numcells, rst_view, sol);
+            if (value.dim != Opm::UnitSystem::measure::identity) {
+                usys.to_si(value.dim, kwdata[key]);
+            }
+        });
+
+        Opm::data::Solution sol(/* init_si = */ true);
+
+        for (auto key = 0*solution_keys.size(); key < solution_keys.size(); ++key) {
+            if (! kwdata[key].empty()) {
+                sol.insert(solution_keys[key].key, solution_keys[key].dim,
+                           std::move(kwdata[key]),
+                           Opm::data::TargetType::RESTART_SOLUTION);
+            }
         }
 
         return sol;
@@ -1610,17 +1633,37 @@ namespace Opm { namespace RestartIO  {
          const Schedule&                schedule,
          const std::vector<RestartKey>& extra_keys)
     {
+        // Only the requested report step is read from the restart file
         auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>
-            (std::make_shared<Opm::EclIO::ERst>(filename), report_step);
+            (std::make_shared<Opm::EclIO::ERst>(filename, report_step), report_step);
+
+        {
+            auto vectors = restartStateVectors();
+            for (const auto* keys : { &solution_keys, &extra_keys }) {
+                std::transform(keys->begin(), keys->end(), std::back_inserter(vectors),
+                               [](const RestartKey& key) { return key.key; });
+            }
 
-        auto xr = restoreSOLUTION(solution_keys, grid.getNumActive(), *rst_view);
-        xr.convertToSI(es.getUnits());
+            rst_view->prefetch(vectors);
+        }
 
-        auto xw = restore_wells(es, grid, schedule, summary_state, rst_view);
-        auto xgrp_nwrk = restore_grp_nwrk(schedule, es.getUnits(), rst_view);
+        auto xr = restoreSOLUTION(solution_keys, grid.getNumActive(), es.getUnits(), *rst_view);
 
-        auto aquifers = hasAquifers(*rst_view)
-            ? restore_aquifers(es, rst_view) : data::Aquifers{};
+        // Independent parts of the state.  Only restore_wells() updates
+        // the summary state.
+        auto xw = data::Wells{};
+        auto xgrp_nwrk = data::GroupAndNetworkValues{};
+        auto aquifers = data::Aquifers{};
+
+        runConcurrently({
+            [&]() { xw = restore_wells(es, grid, schedule, summary_state, rst_view); },
+            [&]() { xgrp_nwrk = restore_grp_nwrk(schedule, es.getUnits(), rst_view); },
+            [&]() {
+                if (hasAquifers(*rst_view)) {
+                    aquifers = restore_aquifers(es, rst_view);
+                }
+            },
+        });
 
         auto rst_value = RestartValue {
             std::move(xr), std::move(xw), std::move(xgrp_nwrk), std::move(aquifers)
@@ -31,9 +31,12 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
-#include <map>
+#include <iterator>
+#include <numeric>
 #include <set>
+#include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 Opm::out::RegionCache::RegionCache(const std::set<std::string>& fip_regions,
@@ -49,6 +52,10 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
                                        const EclipseGrid&           grid,
                                        const Schedule&              schedule)
 {
+    this->region_set_names.assign(fip_regions.begin(), fip_regions.end());
+    this->region_sets.assign(fip_regions.size(), RegionSet{});
+    this->num_cells = grid.getNumActive();
+
     if (fip_regions.empty()) {
         return;
     }
@@ -61,12 +68,46 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
                        return std::cref(fp.get_int(fipReg));
                    });
 
+    // Cells of each region, sorted by region ID (counting sort).
+    const auto numSets = static_cast<int>(regions.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int set = 0; set < numSets; ++set) {
+        const auto& regID = regions[set].get();
+        auto& regSet = this->region_sets[set];
+
+        const auto maxID = regID.empty() ? 0
+            : std::max(0, *std::max_element(regID.begin(), regID.end()));
+
+        regSet.offset.assign(maxID + 1, 0);
+        for (const auto& region : regID) {
+            if (region > 0) {
+                ++regSet.offset[region];
+            }
+        }
+
+        std::partial_sum(regSet.offset.begin(), regSet.offset.end(), regSet.offset.begin());
+
+        auto pos = regSet.offset;
+        regSet.cells.resize(regSet.offset.back());
+        for (auto cell = 0*regID.size(); cell < regID.size(); ++cell) {
+            if (regID[cell] > 0) {
+                regSet.cells[pos[regID[cell] - 1]++] = static_cast<int>(cell);
+            }
+        }
+
+        regSet.connections.resize(maxID + 1);
+        regSet.wells.resize(maxID + 1);
+    }
+
     for (const auto& wname : schedule.back().well_order()) {
         const auto& conns = schedule.back().wells(wname).getConnections();
         if (conns.empty()) { continue; }
 
         auto regID = regions.begin();
-        for (const auto& fipReg : fip_regions) {
+        for (auto& regSet : this->region_sets) {
             auto first = true;
 
             for (const auto& conn : conns) {
@@ -75,13 +116,14 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
                 }
 
                 const auto region = regID->get()[grid.activeIndex(conn.global_index())];
-                const auto reg_pair = std::make_pair(fipReg, region);
+                if (region < 0) {
+                    continue;
+                }
 
-                this->connection_map[reg_pair]
-                    .emplace_back(wname, conn.global_index());
+                regSet.connections[region].emplace_back(wname, conn.global_index());
 
                 if (first) {
-                    this->well_map[reg_pair].push_back(wname);
+                    regSet.wells[region].push_back(wname);
 
                     first = false;
                 }
@@ -93,26 +135,125 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
 }
 
 
+const Opm::out::RegionCache::RegionSet*
+Opm::out::RegionCache::findRegionSet(const std::string& region_name) const
+{
+    auto pos = std::lower_bound(this->region_set_names.begin(),
+                                this->region_set_names.end(), region_name);
+
+    return ((pos == this->region_set_names.end()) || (*pos != region_name))
+        ? nullptr
+        : &this->region_sets[std::distance(this->region_set_names.begin(), pos)];
+}
+
+
 const std::vector<std::pair<std::string, std::size_t>>&
 Opm::out::RegionCache::connections(const std::string& region_name,
                                    const int          region_id) const
 {
-    const auto key = std::make_pair(region_name, region_id);
-    auto iter = this->connection_map.find(key);
+    const auto* regSet = this->findRegionSet(region_name);
 
-    return (iter == this->connection_map.end())
+    return ((regSet == nullptr) || (region_id < 0) ||
+            (static_cast<std::size_t>(region_id) >= regSet->connections.size()))
         ? this->connections_empty
-        : iter->second;
+        : regSet->connections[region_id];
 }
 
 std::vector<std::string>
 Opm::out::RegionCache::wells(const std::string& region_name,
                              const int          region_id) const
 {
-    const auto key = std::make_pair(region_name, region_id);
-    auto iter = this->well_map.find(key);
+    const auto* regSet = this->findRegionSet(region_name);
 
-    return (iter == this->well_map.end())
+    return ((regSet == nullptr) || (region_id < 0) ||
+            (static_cast<std::size_t>(region_id) >= regSet->wells.size()))
         ? std::vector<std::string> {}
-        : iter->second;
+        : regSet->wells[region_id];
+}
+
+std::size_t
+Opm::out::RegionCache::maxRegion(const std::string& region_name) const
+{
+    const auto* regSet = this->findRegionSet(region_name);
+
+    return (regSet == nullptr) ? 0 : regSet->offset.size() - 1;
+}
+
+std::vector<std::vector<double>>
+Opm::out::RegionCache::regionSums(const CellValues& cell_values) const
+{
+    const auto numValues = cell_values.size();
+
+    for (const auto& values : cell_values) {
+        if (values.get().size() < this->num_cells) {
+            throw std::invalid_argument {
+                "Cell value array is shorter than number of active cells"
+            };
+        }
+    }
+
+    auto sums = std::vector<std::vector<double>>(this->region_sets.size());
+
+    // One work item for each non-empty region of every region set.
+    auto items = std::vector<std::pair<std::size_t, std::size_t>>{};
+    for (auto set = 0*this->region_sets.size(); set < this->region_sets.size(); ++set) {
+        const auto& offset = this->region_sets[set].offset;
+        const auto maxID = offset.size() - 1;
+
+        sums[set].assign(numValues * maxID, 0.0);
+
+        for (auto region = std::size_t{1}; region <= maxID; ++region) {
+            if (offset[region] > offset[region - 1]) {
+                items.emplace_back(set, region);
+            }
+        }
+    }
+
+    const auto numItems = static_cast<int>(items.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int item = 0; item < numItems; ++item) {
+        const auto [set, region] = items[item];
+        const auto& regSet = this->region_sets[set];
+        const auto maxID = regSet.offset.size() - 1;
+
+        for (auto q = 0*numValues; q < numValues; ++q) {
+            const auto& values = cell_values[q].get();
+
+            auto sum = 0.0;
+            for (auto i = regSet.offset[region - 1]; i < regSet.offset[region]; ++i) {
+                sum += values[regSet.cells[i]];
+            }
+
+            sums[set][q*maxID + region - 1] = sum;
+        }
+    }
+
+    return sums;
+}
+
+void Opm::out::RegionCache::addInplace(const std::vector<Inplace::Phase>& phases,
+                                       const CellValues&                  cell_values,
+                                       Inplace&                           inplace) const
+{
+    if (phases.size() != cell_values.size()) {
+        throw std::invalid_argument {
+            "Number of in-place quantities does not match number of cell value arrays"
+        };
+    }
+
+    const auto sums = this->regionSums(cell_values);
+
+    for (auto set = 0*sums.size(); set < sums.size(); ++set) {
+        const auto maxID = this->region_sets[set].offset.size() - 1;
+
+        for (auto q = 0*phases.size(); q < phases.size(); ++q) {
+            const auto first = sums[set].begin() + q*maxID;
+
+            inplace.add(this->region_set_names[set], phases[q],
+                        std::vector<double>(first, first + maxID));
+        }
+    }
 }
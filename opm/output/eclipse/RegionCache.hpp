@@ -20,8 +20,10 @@
 #ifndef OPM_REGION_CACHE_HPP
 #define OPM_REGION_CACHE_HPP
 
+#include <opm/output/eclipse/Inplace.hpp>
+
 #include <cstddef>
-#include <map>
+#include <functional>
 #include <set>
 #include <string>
 #include <vector>
@@ -52,13 +54,51 @@ namespace Opm { namespace out {
         // A well is assigned to the region_id of its first connection.
         std::vector<std::string> wells(const std::string& region_name, int region_id) const;
 
+        using CellValues = std::vector<std::reference_wrapper<const std::vector<double>>>;
+
+        // Region set names in the order used by regionSums().
+        const std::vector<std::string>& regionSets() const
+        {
+            return this->region_set_names;
+        }
+
+        // Largest region ID of a region set, zero for unknown sets.
+        std::size_t maxRegion(const std::string& region_name) const;
+
+        // Sums of per-cell quantities, indexed by active cell, over the
+        // regions of all region sets, computed in parallel in a single
+        // pass.  Element q*maxRegion(set) + region_id - 1 of the vector
+        // for a region set holds the sum of cell_values[q] in region_id.
+        // Throws std::invalid_argument if any of the cell_values arrays
+        // has fewer elements than there are active cells.
+        std::vector<std::vector<double>> regionSums(const CellValues& cell_values) const;
+
+        // Region sums of the per-cell values of 'phases' for all region
+        // sets, assigned to 'inplace'.
+        void addInplace(const std::vector<Inplace::Phase>& phases,
+                        const CellValues&                  cell_values,
+                        Inplace&                           inplace) const;
+
     private:
-        using RegID = std::pair<std::string, int>;            // { Region set, region ID }
         using WellConn = std::pair<std::string, std::size_t>; // { Well name, cell ID }
 
+        struct RegionSet
+        {
+            // Active cells of region ID r are cells[offset[r-1] .. offset[r]).
+            std::vector<std::size_t> offset{};
+            std::vector<int> cells{};
+
+            // Indexed by region ID.
+            std::vector<std::vector<WellConn>> connections{};
+            std::vector<std::vector<std::string>> wells{};
+        };
+
         std::vector<WellConn> connections_empty{};
-        std::map<RegID, std::vector<WellConn>> connection_map{};
-        std::map<RegID, std::vector<std::string>> well_map{};
+        std::size_t num_cells{0};
+        std::vector<std::string> region_set_names{};
+        std::vector<RegionSet> region_sets{};
+
+        const RegionSet* findRegionSet(const std::string& region_name) const;
     };
 }} // namespace Opm::out
 
@@ -65,6 +65,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -155,6 +156,22 @@ namespace {
         }
     }
 
+    // Aggregator for the current report step.  Reuses the aggregator,
+    // and thereby its array storage, of the previous report step if any.
+    template <class Aggregator>
+    Aggregator& prepareAggregator(std::optional<Aggregator>& aggregator,
+                                  const std::vector<int>&    ih)
+    {
+        if (aggregator.has_value()) {
+            aggregator->reset(ih);
+        }
+        else {
+            aggregator.emplace(ih);
+        }
+
+        return *aggregator;
+    }
+
     std::vector<int>
     writeHeader(const int                     report_step,
                 const int                     sim_step,
@@ -190,12 +207,13 @@ namespace {
                     const Schedule&               schedule,
                     const Opm::SummaryState&      sumState,
                     const std::vector<int>&       ih,
+                    AggregateBuffers&             buffers,
                     EclIO::OutputStream::Restart& rstFile)
     {
         // write IGRP to restart file
         const size_t simStep = static_cast<size_t> (sim_step);
 
-        auto  groupData = Helpers::AggregateGroupData(ih);
+        auto& groupData = prepareAggregator(buffers.groupData, ih);
 
         groupData.captureDeclaredGroupData(schedule, units, simStep, sumState, ih);
 
@@ -235,12 +253,13 @@ namespace {
                       const Opm::SummaryState&      sumState,
                       const Opm::data::Wells&       wells,
                       const std::vector<int>&       ih,
+                      AggregateBuffers&             buffers,
                       EclIO::OutputStream::Restart& rstFile)
     {
         // write ISEG, RSEG, ILBS and ILBR to restart file
         const auto simStep = static_cast<std::size_t> (sim_step);
 
-        auto  MSWData = Helpers::AggregateMSWData(ih);
+        auto& MSWData = prepareAggregator(buffers.mswData, ih);
         MSWData.captureDeclaredMSWData(schedule, simStep, units,
                                        ih, grid, sumState, wells);
 
@@ -339,9 +358,10 @@ namespace {
                    const Opm::WellTestState&     wtest_state,
                    const Opm::SummaryState&      sumState,
                    const std::vector<int>&       ih,
+                   AggregateBuffers&             buffers,
                    EclIO::OutputStream::Restart& rstFile)
     {
-        auto wellData = Helpers::AggregateWellData(ih);
+        auto& wellData = prepareAggregator(buffers.wellData, ih);
         wellData.captureDeclaredWellData(schedule, tracers, sim_step, action_state, wtest_state, sumState, ih);
         wellData.captureDynamicWellData(schedule, tracers, sim_step, wells, sumState);
 
@@ -356,7 +376,7 @@ namespace {
         rstFile.write("ZWLS", wListData.getZWls());
         rstFile.write("IWLS", wListData.getIWls());
 
-        auto connectionData = Helpers::AggregateConnectionData(ih);
+        auto& connectionData = prepareAggregator(buffers.connectionData, ih);
         connectionData.captureDeclaredConnData(schedule, grid, schedule.getUnits(),
                                                wells, sumState, sim_step);
 
@@ -432,9 +452,11 @@ namespace {
                           const std::vector<int>&                       inteHD,
                           const data::Aquifers&                         aquDynData,
                           std::optional<Helpers::AggregateAquiferData>& aquiferData,
+                          AggregateBuffers&                             buffers,
                           EclIO::OutputStream::Restart&                 rstFile)
     {
-        writeGroup(sim_step, schedule.getUnits(), schedule, sumState, inteHD, rstFile);
+        writeGroup(sim_step, schedule.getUnits(), schedule, sumState, inteHD,
+                   buffers, rstFile);
 
         // Write network data if the network option is used and network defined
         const auto& network = schedule[sim_step].network();
@@ -456,11 +478,12 @@ namespace {
 
             if (haveMSW) {
                 writeMSWData(sim_step, schedule.getUnits(), schedule, grid,
-                             sumState, wellSol, inteHD, rstFile);
+                             sumState, wellSol, inteHD, buffers, rstFile);
             }
 
             writeWell(sim_step, grid, schedule, es.tracer(), wellSol,
-                      action_state, wtest_state, sumState, inteHD, rstFile);
+                      action_state, wtest_state, sumState, inteHD, buffers,
+                      rstFile);
         }
 
         if (const auto& aqCfg = es.aquifer();
@@ -782,6 +805,28 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
           const UDQState&                               udqState,
           std::optional<Helpers::AggregateAquiferData>& aquiferData,
           bool                                          write_double)
+{
+    auto buffers = AggregateBuffers{};
+
+    save(rstFile, report_step, seconds_elapsed, std::move(value), es, grid,
+         schedule, action_state, wtest_state, sumState, udqState,
+         aquiferData, buffers, write_double);
+}
+
+void save(EclIO::OutputStream::Restart&                 rstFile,
+          int                                           report_step,
+          double                                        seconds_elapsed,
+          RestartValue                                  value,
+          const EclipseState&                           es,
+          const EclipseGrid&                            grid,
+          const Schedule&                               schedule,
+          const Action::State&                          action_state,
+          const WellTestState&                          wtest_state,
+          const SummaryState&                           sumState,
+          const UDQState&                               udqState,
+          std::optional<Helpers::AggregateAquiferData>& aquiferData,
+          AggregateBuffers&                             buffers,
+          bool                                          write_double)
 {
     ::Opm::RestartIO::checkSaveArguments(es, value, grid);
 
@@ -805,7 +850,7 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
     if (report_step > 0) {
         writeDynamicData(sim_step, grid, es, schedule, value.wells,
                          action_state, wtest_state, sumState, inteHD,
-                         value.aquifer, aquiferData, rstFile);
+                         value.aquifer, aquiferData, buffers, rstFile);
     }
 
     writeActionx(report_step, sim_step, schedule, action_state, sumState, rstFile);
@@ -25,6 +25,10 @@
 #define RESTART_IO_HPP
 
 #include <opm/output/eclipse/AggregateAquiferData.hpp>
+#include <opm/output/eclipse/AggregateConnectionData.hpp>
+#include <opm/output/eclipse/AggregateGroupData.hpp>
+#include <opm/output/eclipse/AggregateMSWData.hpp>
+#include <opm/output/eclipse/AggregateWellData.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 
 #include <optional>
@@ -77,6 +81,31 @@ namespace Opm { namespace Action {
 */
 namespace Opm { namespace RestartIO {
 
+    /// Restart array aggregators which are retained between calls to
+    /// save().  The well, connection, group and segment arrays then reuse
+    /// their storage at every report step rather than being reallocated.
+    struct AggregateBuffers
+    {
+        std::optional<Helpers::AggregateWellData>       wellData{};
+        std::optional<Helpers::AggregateConnectionData> connectionData{};
+        std::optional<Helpers::AggregateGroupData>      groupData{};
+        std::optional<Helpers::AggregateMSWData>        mswData{};
+    };
+
+    void save(EclIO::OutputStream::Restart&                 rstFile,
+              int                                           report_step,
+              double                                        seconds_elapsed,
+              RestartValue                                  value,
+              const EclipseState&                           es,
+              const EclipseGrid&                            grid,
+              const Schedule&                               schedule,
+              const Action::State&                          action_state,
+              const WellTestState&                          wtest_state,
+              const SummaryState&                           sumState,
+              const UDQState&                               udqState,
+              std::optional<Helpers::AggregateAquiferData>& aquiferData,
+              bool                                          write_double = false);
+
     void save(EclIO::OutputStream::Restart&                 rstFile,
               int                                           report_step,
               double                                        seconds_elapsed,
@@ -89,6 +118,7 @@ namespace Opm { namespace RestartIO {
               const SummaryState&                           sumState,
               const UDQState&                               udqState,
               std::optional<Helpers::AggregateAquiferData>& aquiferData,
+              AggregateBuffers&                             buffers,
               bool                                          write_double = false);
 
 
@@ -23,6 +23,7 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/KeywordLocation.hpp>
+#include <opm/common/TimingMacros.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
@@ -4322,11 +4323,13 @@ public:
                                           const Opm::UnitSystem::UnitType utype);
 
     std::unique_ptr<Spec>
-    createStream(const ResultSet& rset, const Formatted& fmt) const
+    createStream(const ResultSet& rset,
+                 const Formatted& fmt,
+                 std::shared_ptr<Opm::EclIO::AsyncWriter> writer) const
     {
         return std::make_unique<Spec>(rset, fmt, this->uconv(),
                                       this->cartDims_, this->restart_,
-                                      this->start_);
+                                      this->start_, std::move(writer));
     }
 
 private:
@@ -4460,6 +4463,16 @@ public:
     void internal_store(const SummaryState& st, const int report_step, bool isSubstep);
     void write(const bool is_final_summary);
 
+    void setAsyncWriter(std::shared_ptr<EclIO::AsyncWriter> writer)
+    {
+        this->writer_ = std::move(writer);
+    }
+
+    void enableArrayIndex()
+    {
+        this->index_.set = true;
+    }
+
 private:
     struct MiniStep
     {
@@ -4481,6 +4494,7 @@ private:
     Opm::EclIO::OutputStream::ResultSet rset_;
     Opm::EclIO::OutputStream::Formatted fmt_;
     Opm::EclIO::OutputStream::Unified   unif_;
+    Opm::EclIO::OutputStream::Indexed   index_{ false };
 
     mutable int miniStepID_{0};
     mutable double prevEvalTime_{std::numeric_limits<double>::lowest()};
@@ -4497,6 +4511,7 @@ private:
 
     std::unique_ptr<Opm::EclIO::OutputStream::SummarySpecification> smspec_{};
     std::unique_ptr<Opm::EclIO::EclOutput> stream_{};
+    std::shared_ptr<Opm::EclIO::AsyncWriter> writer_{};
 
     std::unique_ptr<Opm::EclIO::ExtSmryOutput> esmry_;
 
@@ -5033,7 +5048,7 @@ void Opm::out::Summary::SummaryImplementation::createSMSpecIfNecessary()
         // We need an SMSPEC file and none exists.  Create it and release
         // the resources captured to make the deferred creation call.
         this->smspec_ = this->deferredSMSpec_
-            ->createStream(this->rset_, this->fmt_);
+            ->createStream(this->rset_, this->fmt_, this->writer_);
 
         this->deferredSMSpec_.reset();
     }
@@ -5054,7 +5069,8 @@ createSmryStreamIfNecessary(const int report_step)
     if (do_create) {
         this->stream_ = Opm::EclIO::OutputStream::
             createSummaryFile(this->rset_, report_step,
-                              this->fmt_, this->unif_);
+                              this->fmt_, this->unif_, this->writer_,
+                              this->index_);
 
         this->prevCreate_ = report_step;
     }
@@ -5085,6 +5101,8 @@ void Summary::eval(SummaryState&                          st,
                    const Opm::data::Aquifers&             aquifer_values,
                    const InterRegFlowValues&              interreg_flows) const
 {
+    OPM_TIMEFUNCTION();
+
     // Report_step is the one-based sequence number of the containing report.
     // Report_step = 0 for the initial condition, before simulation starts.
     // We typically don't get reports_step = 0 here.  When outputting
@@ -5108,14 +5126,26 @@ void Summary::eval(SummaryState&                          st,
 
 void Summary::add_timestep(const SummaryState& st, const int report_step, bool isSubstep)
 {
+    OPM_TIMEFUNCTION();
     this->pImpl_->internal_store(st, report_step, isSubstep);
 }
 
 void Summary::write(const bool is_final_summary) const
 {
+    OPM_TIMEFUNCTION();
     this->pImpl_->write(is_final_summary);
 }
 
+void Summary::setAsyncWriter(std::shared_ptr<EclIO::AsyncWriter> writer)
+{
+    this->pImpl_->setAsyncWriter(std::move(writer));
+}
+
+void Summary::enableArrayIndex()
+{
+    this->pImpl_->enableArrayIndex();
+}
+
 Summary::~Summary() {}
 
 }} // namespace Opm::out
@@ -39,6 +39,10 @@ namespace Opm {
     class SummaryState;
 } // namespace Opm
 
+namespace Opm { namespace EclIO {
+    class AsyncWriter;
+}} // namespace Opm::EclIO
+
 namespace Opm { namespace data {
     class GroupAndNetworkValues;
     class InterRegFlowMap;
@@ -83,6 +87,19 @@ public:
 
     void write(const bool is_final_summary = false) const;
 
+    /// Route SMSPEC and summary file output through a background writer.
+    ///
+    /// Applies to output streams created after this call.
+    ///
+    /// \param[in] writer Background writer.  Pass nullptr to revert to
+    ///    synchronous output.
+    void setAsyncWriter(std::shared_ptr<EclIO::AsyncWriter> writer);
+
+    /// Accompany unified summary files with an array index sidecar.
+    ///
+    /// Applies to output streams created after this call.
+    void enableArrayIndex();
+
 private:
     class SummaryImplementation;
     std::unique_ptr<SummaryImplementation> pImpl_;
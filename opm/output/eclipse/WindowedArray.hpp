@@ -21,6 +21,7 @@
 #define OPM_WINDOWED_ARRAY_HPP
 
 #include <cassert>
+#include <cstddef>
 #include <exception>
 #include <iterator>
 #include <stdexcept>
@@ -89,6 +90,28 @@ namespace Opm { namespace RestartIO { namespace Helpers {
         WindowedArray& operator=(const WindowedArray& rhs) = delete;
         WindowedArray& operator=(WindowedArray&& rhs) = default;
 
+        /// Reinitialise all data items and redefine the window
+        /// structure.
+        ///
+        /// Reuses the existing storage when it is large enough, which
+        /// spares reallocating the restart arrays at every report step.
+        ///
+        /// \param[in] n Number of windows.
+        /// \param[in] sz Number of data items per window.
+        void reset(const NumWindows n,
+                   const WindowSize sz,
+                   const T          initial = T{})
+        {
+            if (sz.value == 0) {
+                throw std::invalid_argument {
+                    "Zero-sized windows are not permitted"
+                };
+            }
+
+            this->x_.assign(n.value * sz.value, initial);
+            this->windowSize_ = sz.value;
+        }
+
         /// Retrieve number of windows allocated for this array.
         Idx numWindows() const
         {
@@ -203,6 +226,29 @@ namespace Opm { namespace RestartIO { namespace Helpers {
             }
         }
 
+        /// Reinitialise all data items and redefine the matrix
+        /// structure.
+        ///
+        /// Reuses the existing storage when it is large enough.
+        ///
+        /// \param[in] nRows Number of rows.
+        /// \param[in] nCols Number of columns.
+        /// \param[in] sz Number of data items per (row,column) window.
+        void reset(const NumRows&    nRows,
+                   const NumCols&    nCols,
+                   const WindowSize& sz,
+                   const T           initial = T{})
+        {
+            if (nCols.value == 0) {
+                throw std::invalid_argument {
+                    "Zero-columned windowed matrices are not permitted"
+                };
+            }
+
+            this->data_.reset(NumWindows{ nRows.value * nCols.value }, sz, initial);
+            this->numCols_ = nCols.value;
+        }
+
         /// Retrieve number of columns allocated for this matrix.
         Idx numCols() const
         {
@@ -42,6 +42,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <stdexcept>
 #include <utility>
@@ -236,9 +237,43 @@ namespace {
 
     // =================================================================
 
+    // Most INIT arrays hold one value per active cell, so the element-wise
+    // conversions below run in parallel when OpenMP is available.
+
     std::vector<float> singlePrecision(const std::vector<double>& x)
     {
-        return { x.begin(), x.end() };
+        auto y = std::vector<float>(x.size());
+
+        const auto n = static_cast<std::int64_t>(x.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (std::int64_t i = 0; i < n; ++i) {
+            y[i] = static_cast<float>(x[i]);
+        }
+
+        return y;
+    }
+
+    // Single precision copy of SI valued array 'x' in output units.  Spares
+    // callers a separate double precision copy for the unit conversion.
+    std::vector<float> singlePrecision(const std::vector<double>&       x,
+                                       const ::Opm::UnitSystem&         units,
+                                       const ::Opm::UnitSystem::measure unit)
+    {
+        auto y = std::vector<float>(x.size());
+
+        const auto n = static_cast<std::int64_t>(x.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (std::int64_t i = 0; i < n; ++i) {
+            y[i] = static_cast<float>(units.from_si(unit, x[i]));
+        }
+
+        return y;
     }
 
     ::Opm::RestartIO::LogiHEAD::PVTModel
@@ -321,9 +356,8 @@ namespace {
                          const ::Opm::UnitSystem&          units,
                          ::Opm::EclIO::OutputStream::Init& initFile)
     {
-        auto porv = es.globalFieldProps().porv(true);
-        units.from_si(::Opm::UnitSystem::measure::volume, porv);
-        initFile.write("PORV", singlePrecision(porv));
+        initFile.write("PORV", singlePrecision(es.globalFieldProps().porv(true),
+                                               units, ::Opm::UnitSystem::measure::volume));
     }
 
     void writeIntegerCellProperties(const ::Opm::EclipseState&        es,
@@ -354,19 +388,24 @@ namespace {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
 
-        auto dx    = std::vector<float>{};  dx   .reserve(nAct);
-        auto dy    = std::vector<float>{};  dy   .reserve(nAct);
-        auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = std::vector<float>{};  depth.reserve(nAct);
+        auto dx    = std::vector<float>(nAct);
+        auto dy    = std::vector<float>(nAct);
+        auto dz    = std::vector<float>(nAct);
+        auto depth = std::vector<float>(nAct);
+
+        const auto numActive = static_cast<std::int64_t>(nAct);
 
-        for (auto cell = 0*nAct; cell < nAct; ++cell) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (std::int64_t cell = 0; cell < numActive; ++cell) {
             const auto  globCell = grid.getGlobalIndex(cell);
             const auto& dims     = grid.getCellDims(globCell);
 
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
+            dx   [cell] = units.from_si(length, dims[0]);
+            dy   [cell] = units.from_si(length, dims[1]);
+            dz   [cell] = units.from_si(length, dims[2]);
+            depth[cell] = units.from_si(length, grid.getCellDepth(globCell));
         }
 
         initFile.write("DEPTH", depth);
@@ -385,10 +424,9 @@ namespace {
                 continue;
             }
 
-            auto data = fp.get_double(prop.name);
-            auto defaulted = fp.defaulted<double>(prop.name);
+            const auto defaulted = fp.defaulted<double>(prop.name);
 
-            write(prop, std::move(defaulted), std::move(data));
+            write(prop, defaulted, fp.get_double(prop.name));
         }
     }
 
@@ -402,8 +440,7 @@ namespace {
                 continue;
             }
 
-            auto data = fp.get_double(prop.name);
-            write(prop, std::move(data));
+            write(prop, fp.get_double(prop.name));
         }
     }
 
@@ -415,33 +452,29 @@ namespace {
     {
         if (needDflt) {
             writeCellDoublePropertiesWithDefaultFlag(propList, fp,
-                [&units, &initFile](const CellProperty&   prop,
-                                    std::vector<bool>&&   dflt,
-                                    std::vector<double>&& value)
+                [&units, &initFile](const CellProperty&        prop,
+                                    const std::vector<bool>&   dflt,
+                                    const std::vector<double>& value)
             {
-                units.from_si(prop.unit, value);
+                auto output = singlePrecision(value, units, prop.unit);
 
                 for (auto n = dflt.size(), i = 0*n; i < n; ++i) {
                     if (dflt[i]) {
                         // Element defaulted.  Output sentinel value
                         // (-1.0e+20) to signify defaulted element.
-                        //
-                        // Note: Start as float for roundtripping through
-                        // function singlePrecision().
-                        value[i] = static_cast<double>(-1.0e+20f);
+                        output[i] = -1.0e+20f;
                     }
                 }
 
-                initFile.write(prop.name, singlePrecision(value));
+                initFile.write(prop.name, output);
             });
         }
         else {
             writeCellPropertiesValuesOnly(propList, fp,
-                [&units, &initFile](const CellProperty&   prop,
-                                    std::vector<double>&& value)
+                [&units, &initFile](const CellProperty&        prop,
+                                    const std::vector<double>& value)
             {
-                units.from_si(prop.unit, value);
-                initFile.write(prop.name, singlePrecision(value));
+                initFile.write(prop.name, singlePrecision(value, units, prop.unit));
             });
         }
     }
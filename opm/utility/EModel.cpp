@@ -22,6 +22,8 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <bitset>
+#include <cstddef>
 #include <cstring>
 #include <filesystem>
 #include <iterator>
@@ -30,6 +32,100 @@
 using EclEntry = std::tuple<std::string, Opm::EclIO::eclArrType, long int>;
 using ParamEntry = std::tuple<std::string, Opm::EclIO::eclArrType>;
 
+namespace {
+
+constexpr std::size_t bitsPerWord = 64;
+
+std::vector<std::uint64_t> allSelected(const std::size_t numCells)
+{
+    auto selection = std::vector<std::uint64_t>((numCells + bitsPerWord - 1) / bitsPerWord,
+                                                ~std::uint64_t{0});
+
+    if (const auto tail = numCells % bitsPerWord; tail > 0)
+        selection.back() = (std::uint64_t{1} << tail) - 1;
+
+    return selection;
+}
+
+// Deselect the cells for which keep(cell) is false.  The cells of a word
+// are tested without branches, which allows the compiler to vectorise the
+// inner loop, and words without selected cells are skipped.
+template <typename Keep>
+void restrictSelection(std::vector<std::uint64_t>& selection, const std::size_t numCells, Keep&& keep)
+{
+    const auto numWords = static_cast<int>(selection.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for if(numWords > 256)
+#endif
+    for (int w = 0; w < numWords; w++) {
+        if (selection[w] == 0)
+            continue;
+
+        const auto first = static_cast<std::size_t>(w) * bitsPerWord;
+        const auto last = std::min(first + bitsPerWord, numCells);
+
+        std::uint64_t bits = 0;
+        for (auto i = first; i < last; i++)
+            bits |= static_cast<std::uint64_t>(keep(i)) << (i - first);
+
+        selection[w] &= bits;
+    }
+}
+
+template <typename Op>
+void forEachSelected(const std::vector<std::uint64_t>& selection, Op&& op)
+{
+    for (std::size_t w = 0; w < selection.size(); w++) {
+        const auto bits = selection[w];
+
+        for (std::size_t b = 0; (b < bitsPerWord) && ((bits >> b) != 0); b++)
+            if ((bits >> b) & 1)
+                op(w*bitsPerWord + b);
+    }
+}
+
+std::size_t countSelected(const std::vector<std::uint64_t>& selection)
+{
+    std::size_t count = 0;
+
+    for (const auto& bits : selection)
+        count += std::bitset<bitsPerWord>(bits).count();
+
+    return count;
+}
+
+double sumProduct(const std::vector<std::uint64_t>& selection,
+                  const std::vector<const float*>& columns)
+{
+    const auto numWords = static_cast<int>(selection.size());
+    double sum = 0.0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:sum) if(numWords > 256)
+#endif
+    for (int w = 0; w < numWords; w++) {
+        const auto bits = selection[w];
+
+        for (std::size_t b = 0; (b < bitsPerWord) && ((bits >> b) != 0); b++) {
+            if (((bits >> b) & 1) == 0)
+                continue;
+
+            const auto cell = static_cast<std::size_t>(w)*bitsPerWord + b;
+
+            double value = 1.0;
+            for (const auto* column : columns)
+                value *= column[cell];
+
+            sum += value;
+        }
+    }
+
+    return sum;
+}
+
+} // Anonymous namespace
+
 
 EModel::EModel(const std::string& filename) :
     initfile(filename)
@@ -69,7 +165,7 @@ EModel::EModel(const std::string& filename) :
     J.reserve(nActive);
     K.reserve(nActive);
 
-    ActFilter.resize(nActive, true);
+    ActFilter = allSelected(nActive);
 
     std::vector<float> porv_all = initfile.get<float>("PORV");
 
@@ -222,7 +318,7 @@ std::vector<ParamEntry> EModel::getListOfParameters() const
 
 int EModel::getNumberOfActiveCells()
 {
-    return std::count(ActFilter.begin(), ActFilter.end(), true);
+    return static_cast<int>(countSelected(ActFilter));
 }
 
 bool EModel::hasInitParameter(const std::string &name) const
@@ -255,52 +351,87 @@ bool EModel::hasReportStep(int rstep)
 void EModel::resetFilter()
 {
     activeFilter=false;
-    std::fill(ActFilter.begin(), ActFilter.end(), true);
+    ActFilter = allSelected(nActive);
+    stepFilters.clear();
 }
 
 
-template <typename T>
-void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value)
+EModel::FilterOp EModel::filterOperator(const std::string& opperator, int numValues)
 {
-    if ((opperator == "eq") || (opperator == "==")){
-       for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] != value))
-                ActFilter[i] = false;
+    if (numValues == 1) {
+        if ((opperator == "eq") || (opperator == "=="))
+            return FilterOp::Equal;
+        else if ((opperator=="lt") || (opperator=="<"))
+            return FilterOp::Less;
+        else if ((opperator == "gt") || (opperator == ">"))
+            return FilterOp::Greater;
+
+    } else if ((opperator == "in") || (opperator == "between")) {
+        return FilterOp::Between;
+    }
 
-    } else if ((opperator=="lt") || (opperator=="<")) {
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] >= value))
-                ActFilter[i] = false;
+    const std::string message =
+        fmt::format("Unknown operator {} used to set filter", opperator);
+    throw std::invalid_argument(message);
+}
 
-    } else if ((opperator == "gt") || (opperator == ">")){
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] <= value))
-                ActFilter[i] = false;
 
-    } else {
-        const std::string message =
-            fmt::format("Unknown operator {} used to set filter", opperator);
-        throw std::invalid_argument(message);
+template <typename T>
+void EModel::applyFilter(std::vector<std::uint64_t>& selection, const std::vector<T>& paramVect,
+                         FilterOp op, T value1, T value2)
+{
+    const auto* values = paramVect.data();
+    const auto numCells = paramVect.size();
+
+    switch (op) {
+    case FilterOp::Equal:
+        restrictSelection(selection, numCells, [values, value1](std::size_t i)
+                          { return !(values[i] != value1); });
+        break;
+
+    case FilterOp::Less:
+        restrictSelection(selection, numCells, [values, value1](std::size_t i)
+                          { return !(values[i] >= value1); });
+        break;
+
+    case FilterOp::Greater:
+        restrictSelection(selection, numCells, [values, value1](std::size_t i)
+                          { return !(values[i] <= value1); });
+        break;
+
+    case FilterOp::Between:
+        restrictSelection(selection, numCells, [values, value1, value2](std::size_t i)
+                          { return !((values[i] <= value1) | (values[i] >= value2)); });
+        break;
     }
+}
+
 
+template <typename T>
+void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value)
+{
+    applyFilter(ActFilter, paramVect, filterOperator(opperator, 1), value, value);
     activeFilter = true;
 }
 
 template <typename T>
 void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2)
 {
-    if ((opperator == "in") || (opperator == "between")) {
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && ((paramVect[i] <= value1) || (paramVect[i] >= value2)))
-                ActFilter[i] = false;
+    applyFilter(ActFilter, paramVect, filterOperator(opperator, 2), value1, value2);
+    activeFilter = true;
+}
 
-    } else {
-        const std::string message =
-            fmt::format("Unknown operator {} used to set filter", opperator);
-        throw std::invalid_argument(message);
-    }
 
-    activeFilter = true;
+template <typename T>
+const std::vector<T>& EModel::gatherSelected(const std::vector<T>& paramVect, std::vector<T>& filtered) const
+{
+    filtered.clear();
+    filtered.reserve(countSelected(ActFilter));
+
+    forEachSelected(ActFilter, [&paramVect, &filtered](std::size_t i)
+                    { filtered.push_back(paramVect[i]); });
+
+    return filtered;
 }
 
 template <typename T>
@@ -347,21 +478,21 @@ const std::vector<T>& EModel::get_filter_param(const std::string& param)
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);
+    const auto& paramVect = get_filter_param<int>(param1);
     updateActiveFilter(paramVect, opperator, num);
 }
 
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num1, int num2)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);;
+    const auto& paramVect = get_filter_param<int>(param1);
     updateActiveFilter(paramVect, opperator, num1, num2);
 }
 
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
+    const auto& paramVect = get_filter_param<float>(param1);
     updateActiveFilter(paramVect, opperator, num);
 }
 
@@ -369,7 +500,7 @@ void EModel::addFilter<float>(const std::string& param1, const std::string& oppe
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num1, float num2)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
+    const auto& paramVect = get_filter_param<float>(param1);
     updateActiveFilter(paramVect, opperator, num1, num2);
 }
 
@@ -381,17 +512,90 @@ void EModel::addHCvolFilter()
                                  "function setDepthfwl before using "
                                  "filter HC filter");
 
-    auto eqlnum = initfile.get<int>("EQLNUM");
-    auto depth = initfile.get<float>("DEPTH");
+    const auto& eqlnum = initfile.get<int>("EQLNUM");
+    const auto& depth = initfile.get<float>("DEPTH");
+    const auto& fwl = FreeWaterlevel;
     activeFilter = true;
 
-    for (size_t n = 0; n < eqlnum.size();n++){
-        int eql = eqlnum[n];
-        float fwl = FreeWaterlevel[eql-1];
+    restrictSelection(ActFilter, eqlnum.size(), [&eqlnum, &depth, &fwl](std::size_t n)
+                      { return !(depth[n] > fwl[eqlnum[n] - 1]); });
+}
+
 
-        if ((ActFilter[n]) && (depth[n] > fwl))
-            ActFilter[n] = false;
+void EModel::addStepFilter(const std::string& param, const std::string& opperator, float num)
+{
+    if (!hasParameter(param)) {
+        const std::string message =
+            fmt::format("parameter {}, used to set filter, could not be found",
+                        param);
+        throw std::invalid_argument(message);
     }
+
+    stepFilters.push_back({ param, filterOperator(opperator, 1), num, num });
+}
+
+
+void EModel::addStepFilter(const std::string& param, const std::string& opperator, float num1, float num2)
+{
+    if (!hasParameter(param)) {
+        const std::string message =
+            fmt::format("parameter {}, used to set filter, could not be found",
+                        param);
+        throw std::invalid_argument(message);
+    }
+
+    stepFilters.push_back({ param, filterOperator(opperator, 2), num1, num2 });
+}
+
+
+std::vector<double> EModel::sumOverReportSteps(const std::vector<std::string>& params,
+                                               const std::vector<int>& rsteps)
+{
+    for (const auto& rstep : rsteps) {
+        if (!hasReportStep(rstep)) {
+            const std::string message =
+                fmt::format("report step {} not found in restart file", rstep);
+            throw std::invalid_argument(message);
+        }
+    }
+
+    std::vector<std::string> solutionNames;
+    for (const auto& name : params)
+        if (!hasInitParameter(name))
+            solutionNames.push_back(name);
+
+    for (const auto& filter : stepFilters)
+        if (!hasInitParameter(filter.param))
+            solutionNames.push_back(filter.param);
+
+    std::vector<double> result;
+    result.reserve(rsteps.size());
+
+    if (rsteps.empty())
+        return result;
+
+    rstfile->loadReportStepNumbers(rsteps, solutionNames);
+
+    const int currentReportStep = activeReportStep;
+    std::vector<const float*> columns(params.size());
+
+    for (const auto& rstep : rsteps) {
+        initSolutionData(rstep);
+
+        auto selection = ActFilter;
+        for (const auto& filter : stepFilters)
+            applyFilter(selection, get_filter_param<float>(filter.param),
+                        filter.op, filter.value1, filter.value2);
+
+        for (std::size_t p = 0; p < params.size(); p++)
+            columns[p] = get_filter_param<float>(params[p]).data();
+
+        result.push_back(sumProduct(selection, columns));
+    }
+
+    initSolutionData(currentReportStep);
+
+    return result;
 }
 
 
@@ -399,14 +603,7 @@ template <>
 const std::vector<float>& EModel::getParam<float>(const std::string& name)
 {
     if (activeFilter) {
-        std::vector<float> param = get_filter_param<float>(name);
-        filteredFloatVect.clear();
-
-        for (size_t i = 0; i < param.size(); i++)
-            if (ActFilter[i])
-                filteredFloatVect.push_back(param[i]);
-
-        return filteredFloatVect;
+        return gatherSelected(get_filter_param<float>(name), filteredFloatVect);
 
     } else {
 
@@ -419,14 +616,7 @@ template <>
 const std::vector<int>& EModel::getParam<int>(const std::string& name)
 {
     if (activeFilter) {
-        std::vector<int> param = get_filter_param<int>(name);
-        filteredIntVect.clear();
-
-        for (size_t i = 0; i < param.size(); i++)
-            if (ActFilter[i])
-                filteredIntVect.push_back(param[i]);
-
-        return filteredIntVect;
+        return gatherSelected(get_filter_param<int>(name), filteredIntVect);
 
     } else {
 
@@ -25,6 +25,7 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <ctime>
@@ -64,6 +65,24 @@ public:
 
     int getNumberOfActiveCells();
 
+    // Filter on a solution parameter which is evaluated separately at each
+    // report step by sumOverReportSteps(), on top of the current filter.
+    void addStepFilter(const std::string& param, const std::string& opperator, float num);
+    void addStepFilter(const std::string& param, const std::string& opperator, float num1, float num2);
+
+    // Sum over the selected cells of the product of the float parameters
+    // 'params', e.g. {"PORV", "SGAS"}, for each of the report steps
+    // 'rsteps'.  The solution arrays needed for all steps are read in one
+    // pass.  The active report step is left unchanged.
+    //
+    // Memory: the arrays read stay loaded in the restart file object, as
+    // for setReportStep(), so the cost is roughly one float per active
+    // cell for each solution parameter in 'params' and in the step
+    // filters, times the number of report steps.  Call repeatedly with
+    // subsets of the report steps on a new EModel object to bound it.
+    std::vector<double> sumOverReportSteps(const std::vector<std::string>& params,
+                                           const std::vector<int>& rsteps);
+
 
     std::tuple<int, int, int> gridDims(){ return std::make_tuple(nI, nJ, nK); };
 
@@ -83,7 +102,21 @@ private:
     std::vector<float> PORV;
     std::vector<float> CELLVOL;
     std::vector<int> I, J, K;
-    std::vector<bool> ActFilter;
+
+    // Selected cells, one bit per active cell.
+    std::vector<std::uint64_t> ActFilter;
+
+    enum class FilterOp { Equal, Less, Greater, Between };
+
+    struct StepFilter
+    {
+        std::string param;
+        FilterOp op;
+        float value1;
+        float value2;
+    };
+
+    std::vector<StepFilter> stepFilters;
 
     Opm::EclIO::EclFile initfile;
     std::optional<Opm::EclipseGrid> grid;
@@ -122,6 +155,15 @@ private:
     template <typename T>
     void updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2);
 
+    static FilterOp filterOperator(const std::string& opperator, int numValues);
+
+    template <typename T>
+    static void applyFilter(std::vector<std::uint64_t>& selection, const std::vector<T>& paramVect,
+                            FilterOp op, T value1, T value2);
+
+    template <typename T>
+    const std::vector<T>& gatherSelected(const std::vector<T>& paramVect, std::vector<T>& filtered) const;
+
 };
 
 #endif
@@ -2,6 +2,9 @@
 #define SUNBEAM_CONVERTERS_HPP
 
 #include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 
@@ -48,6 +51,40 @@ py::array_t<T> numpy_array(const std::vector<T>& input) {
     return output;
 }
 
+/*
+  Hand the contents of 'input' over to numpy without copying them.  The
+  vector is moved to the heap and released together with the array.
+*/
+template <class T>
+py::array_t<T> numpy_array(std::vector<T>&& input) {
+    if constexpr (std::is_same_v<T, bool>) {
+        // std::vector<bool> is bit packed and must be copied.
+        return numpy_array(static_cast<const std::vector<T>&>(input));
+    } else {
+        auto* data = new std::vector<T>(std::move(input));
+        py::capsule owner(data, [](void* ptr) { delete static_cast<std::vector<T>*>(ptr); });
+
+        return py::array_t<T>(data->size(), data->data(), owner);
+    }
+}
+
+/*
+  Read-only numpy view of 'input', which must be owned by the C++ object
+  wrapped by 'owner'.  The view keeps 'owner' alive, so 'input' must stay
+  in place for the life time of that object.  LOGI arrays are copied.
+*/
+template <class T>
+py::array_t<T> numpy_view(const std::vector<T>& input, py::handle owner) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return numpy_array(input);
+    } else {
+        auto output = py::array_t<T>(input.size(), input.data(), owner);
+        py::detail::array_proxy(output.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+
+        return output;
+    }
+}
+
 }
 
 #endif //SUNBEAM_CONVERTERS_HPP
@@ -2,8 +2,12 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 #include <pybind11/chrono.h>
+#include <algorithm>
 #include <filesystem>
 #include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
@@ -73,9 +77,9 @@ public:
     py::array get_smry_vector(const std::string& key)
     {
         if (m_esmry != nullptr)
-            return convert::numpy_array( m_esmry->get(key) );
+            return convert::numpy_view( m_esmry->get(key), py::cast(this) );
         else
-            return convert::numpy_array( m_ext_esmry->get(key) );
+            return convert::numpy_view( m_ext_esmry->get(key), py::cast(this) );
     }
 
     py::array get_smry_vector_at_rsteps(const std::string& key)
@@ -86,6 +90,52 @@ public:
             return convert::numpy_array( m_ext_esmry->get_at_rstep(key) );
     }
 
+    py::array get_smry_vectors(const std::vector<std::string>& keys, bool at_rsteps)
+    {
+        // Read all requested vectors in one pass over the summary files
+        // before assembling the (keys x time steps) result.  A key may be
+        // requested more than once, but is loaded only once.
+        auto unique_keys = std::vector<std::string>{};
+        {
+            auto seen = std::unordered_set<std::string>{};
+            for (const auto& key : keys) {
+                if (seen.insert(key).second)
+                    unique_keys.push_back(key);
+            }
+        }
+
+        if (m_esmry != nullptr)
+            m_esmry->loadData(unique_keys);
+        else
+            m_ext_esmry->loadData(unique_keys);
+
+        const auto num_steps = keys.empty() ? std::size_t{0}
+            : (at_rsteps ? this->smry_vector_at_rsteps(keys.front()).size()
+                         : this->smry_vector(keys.front()).size());
+
+        auto result = py::array_t<float>({ keys.size(), num_steps });
+        auto* result_ptr = static_cast<float*>(result.request().ptr);
+
+        auto copy_row = [num_steps, result_ptr, &keys](const std::size_t k, const auto& values)
+        {
+            if (values.size() != num_steps)
+                throw std::runtime_error("Summary vector " + keys[k] + " has "
+                                         + std::to_string(values.size()) + " values, expected "
+                                         + std::to_string(num_steps));
+
+            std::copy(values.begin(), values.end(), result_ptr + k*num_steps);
+        };
+
+        for (std::size_t k = 0; k < keys.size(); ++k) {
+            if (at_rsteps)
+                copy_row(k, this->smry_vector_at_rsteps(keys[k]));
+            else
+                copy_row(k, this->smry_vector(keys[k]));
+        }
+
+        return result;
+    }
+
     time_point smry_start_date()
     {
         time_point utc_chrono;
@@ -150,6 +200,22 @@ public:
 private:
     std::unique_ptr<Opm::EclIO::ESmry> m_esmry;
     std::unique_ptr<Opm::EclIO::ExtESmry> m_ext_esmry;
+
+    const std::vector<float>& smry_vector(const std::string& key)
+    {
+        if (m_esmry != nullptr)
+            return m_esmry->get(key);
+        else
+            return m_ext_esmry->get(key);
+    }
+
+    std::vector<float> smry_vector_at_rsteps(const std::string& key)
+    {
+        if (m_esmry != nullptr)
+            return m_esmry->get_at_rstep(key);
+        else
+            return m_ext_esmry->get_at_rstep(key);
+    }
 };
 
 
@@ -191,18 +257,19 @@ private:
 npArray get_vector_index(Opm::EclIO::EclFile * file_ptr, std::size_t array_index)
 {
     auto array_type = std::get<1>(file_ptr->getList()[array_index]);
+    const auto owner = py::cast(file_ptr);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<int>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<int>(array_index), owner ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<float>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<float>(array_index), owner ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<double>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<double>(array_index), owner ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<bool>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<bool>(array_index), owner ), array_type);
 
     if ((array_type == Opm::EclIO::CHAR) || (array_type == Opm::EclIO::C0NN))
         return std::make_tuple (convert::numpy_string_array( file_ptr->get<std::string>(array_index)), array_type);
@@ -262,18 +329,19 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
         throw std::out_of_range("Array index out of range. ");
 
     auto array_type = std::get<1>(arrList[index]);
+    const auto owner = py::cast(file_ptr);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<int>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<int>(index, rstep), owner ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<float>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<float>(index, rstep), owner ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<double>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<double>(index, rstep), owner ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<bool>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<bool>(index, rstep), owner ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRestartData<std::string>(index, rstep)), array_type);
@@ -360,7 +428,7 @@ py::array get_cellvolumes_mask(Opm::EclIO::EGrid * file_ptr, std::vector<int> ma
         }
     }
 
-    return convert::numpy_array( celvol );
+    return convert::numpy_array( std::move(celvol) );
 }
 
 py::array get_cellvolumes(Opm::EclIO::EGrid * file_ptr)
@@ -377,21 +445,22 @@ npArray get_rft_vector_WellDate(Opm::EclIO::ERft * file_ptr,const std::string& n
     auto arrList = file_ptr->listOfRftArrays(well, y, m, d);
     size_t array_index = get_array_index(arrList, name, 0);
     Opm::EclIO::eclArrType array_type = std::get<1>(arrList[array_index]);
+    const auto owner = py::cast(file_ptr);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<int>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<int>(name, well, y, m, d), owner ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<float>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<float>(name, well, y, m, d), owner ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<double>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<double>(name, well, y, m, d), owner ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRft<std::string>(name, well, y, m, d) ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<bool>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<bool>(name, well, y, m, d), owner ), array_type);
 
     throw std::logic_error("Data type not supported");
 }
@@ -401,21 +470,22 @@ npArray get_rft_vector_Index(Opm::EclIO::ERft * file_ptr,const std::string& name
     auto arrList = file_ptr->listOfRftArrays(reportIndex);
     size_t array_index = get_array_index(arrList, name, 0);
     Opm::EclIO::eclArrType array_type = std::get<1>(arrList[array_index]);
+    const auto owner = py::cast(file_ptr);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<int>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<int>(name, reportIndex), owner ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<float>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<float>(name, reportIndex), owner ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<double>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<double>(name, reportIndex), owner ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRft<std::string>(name, reportIndex) ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<bool>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<bool>(name, reportIndex), owner ), array_type);
 
     throw std::logic_error("Data type not supported");
 }
@@ -483,6 +553,7 @@ void python::common::export_IO(py::module& m) {
         .def("__len__", &ESmryBind::numberOfTimeSteps)
         .def("__get_all", &ESmryBind::get_smry_vector)
         .def("__get_at_rstep", &ESmryBind::get_smry_vector_at_rsteps)
+        .def("get_many", &ESmryBind::get_smry_vectors, py::arg("keys"), py::arg("at_rsteps") = false)
         .def_property_readonly("start_date", &ESmryBind::smry_start_date)
         .def("keys", (const std::vector<std::string>& (ESmryBind::*) (void) const)
             &ESmryBind::keywordList)
@@ -77,6 +77,22 @@ void add_float_filter_2values(EModel * file_ptr, std::string key, std::string op
     file_ptr->addFilter<float>(key, opr, value1, value2);
 }
 
+void add_step_filter_1value(EModel * file_ptr, std::string key, std::string opr, float value)
+{
+    file_ptr->addStepFilter(key, opr, value);
+}
+
+void add_step_filter_2values(EModel * file_ptr, std::string key, std::string opr, float value1, float value2)
+{
+    file_ptr->addStepFilter(key, opr, value1, value2);
+}
+
+py::array sum_over_report_steps(EModel * file_ptr, const std::vector<std::string>& params,
+                                const std::vector<int>& rsteps)
+{
+    return convert::numpy_array( file_ptr->sumOverReportSteps(params, rsteps) );
+}
+
 } // name space
 
 
@@ -101,6 +117,14 @@ void python::common::export_EModel(py::module& m) {
         .def("__add_filter", &add_int_filter_1value)
         .def("__add_filter", &add_float_filter_1value)
         .def("__add_filter", &add_int_filter_2values)
-        .def("__add_filter", &add_float_filter_2values);
+        .def("__add_filter", &add_float_filter_2values)
+        .def("__add_step_filter", &add_step_filter_1value)
+        .def("__add_step_filter", &add_step_filter_2values)
+        .def("sum_over_report_steps", &sum_over_report_steps, py::arg("params"), py::arg("rsteps"),
+             "Sum over the selected cells of the product of the float parameters 'params' for each\n"
+             "of the report steps 'rsteps'.  The solution arrays of all the report steps are read in\n"
+             "one pass and stay in memory, about 4 bytes per active cell for each solution parameter\n"
+             "and step filter parameter times the number of report steps.  Use a new EModel object\n"
+             "for each subset of the report steps to bound the memory use.");
 
 }
@@ -29,4 +29,13 @@ def emodel_add_filter(self, key, operator, val1, val2 = None):
             self.__add_filter(key, operator, float(val1), float(val2))
 
 
+def emodel_add_step_filter(self, key, operator, val1, val2 = None):
+
+    if val2 is None:
+        self.__add_step_filter(key, operator, float(val1))
+    else:
+        self.__add_step_filter(key, operator, float(val1), float(val2))
+
+
 setattr(EModel, "add_filter", emodel_add_filter)
+setattr(EModel, "add_step_filter", emodel_add_step_filter)
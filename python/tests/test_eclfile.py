@@ -90,6 +90,21 @@ class TestEclFile(unittest.TestCase):
             self.assertLess(abs(1.0 - val1/val2), 1e-6)
 
 
+    def test_get_function_view(self):
+
+        file1 = EclFile(test_path("data/SPE9.INIT"))
+        porv_index = array_index(file1, "PORV")[0]
+
+        porv1 = file1[porv_index]
+        porv2 = file1["PORV"]
+        self.assertFalse(porv1.flags.writeable)
+        self.assertTrue(np.shares_memory(porv1, porv2))
+
+        del file1
+        self.assertEqual(len(porv1), 9000)
+        self.assertGreater(porv1.sum(), 0.0)
+
+
     def test_get_function_double(self):
 
         refTabData=[0.147E+02, 0.2E+21, 0.4E+03, 0.2E+21, 0.8E+03, 0.2E+21, 0.12E+04, 0.2E+21, 0.16E+04, 0.2E+21, 0.2E+04, 0.2E+21, 0.24E+04, 0.2E+21, 0.28E+04, 0.2E+21, 0.32E+04, 0.2E+21, 0.36E+04, 0.2E+21, 0.4E+04, 0.5E+04, 0.1E+01, 0.2E+21, 0.98814229249012E+00, 0.2E+21, 0.97513408093613E+00]
@@ -178,6 +178,40 @@ class TestEModel(unittest.TestCase):
         ivect = mod1.get("I")
 
 
+    def test_sum_over_report_steps(self):
+
+        mod1 = EModel(test_path("data/9_EDITNNC.INIT"))
+        mod1.add_filter("EQLNUM","eq", 1);
+        mod1.add_filter("DEPTH","lt", 2645.21);
+
+        rsteps = mod1.get_report_steps()
+        mod1.set_report_step(7)
+
+        pvw = mod1.sum_over_report_steps(["PORV", "SWAT"], rsteps)
+        self.assertEqual(len(pvw), len(rsteps))
+        self.assertEqual(mod1.active_report_step(), 7)
+
+        mod1.add_step_filter("PRESSURE", "lt", 302.0)
+        pv = mod1.sum_over_report_steps(["PORV"], rsteps)
+
+        for n, step in enumerate(rsteps):
+            mod1.set_report_step(step)
+            porv = mod1.get("PORV")
+            swat = mod1.get("SWAT")
+            pres = mod1.get("PRESSURE")
+
+            ref_pvw = sum(porv.astype("float64") * swat)
+            ref_pv = sum(porv[pres < 302.0].astype("float64"))
+
+            self.assertTrue(abs(pvw[n] - ref_pvw)/ref_pvw < 1.0e-6)
+            self.assertTrue(abs(pv[n] - ref_pv)/ref_pv < 1.0e-6)
+
+        self.assertLess(pv[-1], pv[0])
+
+        with self.assertRaises(ValueError):
+            mod1.sum_over_report_steps(["PORV"], [2])
+
+
 if __name__ == "__main__":
 
     unittest.main()
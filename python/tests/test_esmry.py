@@ -109,6 +109,48 @@ class TestEclFile(unittest.TestCase):
             self.assertEqual(key, ref)
 
 
+    def test_get_many(self):
+
+        smry1 = ESmry(test_path("data/SPE1CASE1.SMSPEC"))
+        keys = ["TIME", "FOPR", "WBHP:PROD"]
+
+        data = smry1.get_many(keys)
+        self.assertTrue(isinstance(data, np.ndarray))
+        self.assertEqual(data.dtype, "float32")
+        self.assertEqual(data.shape, (3, len(smry1)))
+
+        for row, key in zip(data, keys):
+            self.assertTrue(np.array_equal(row, smry1[key]))
+
+        data_rstep = smry1.get_many(keys, at_rsteps = True)
+        self.assertEqual(data_rstep.shape, (3, 64))
+        self.assertTrue(np.array_equal(data_rstep[1], smry1["FOPR", True]))
+
+        self.assertEqual(smry1.get_many([]).shape, (0, 0))
+
+        keys = ["FGOR", "FOPR", "FOPR"]
+        data = smry1.get_many(keys)
+        self.assertEqual(data.shape, (3, len(smry1)))
+
+        for row, key in zip(data, keys):
+            self.assertTrue(np.array_equal(row, smry1[key]))
+
+
+    def test_view(self):
+
+        smry1 = ESmry(test_path("data/SPE1CASE1.SMSPEC"))
+        time = smry1["TIME"]
+        del smry1
+
+        # The array is a read-only view which keeps the summary alive.
+        self.assertFalse(time.flags.writeable)
+        self.assertEqual(len(time), 67)
+        self.assertEqual(time[0], 1.0)
+
+        with self.assertRaises(ValueError):
+            time[0] = 2.0
+
+
     def test_base_runs_ext(self):
 
         smry1 = ESmry(test_path("data/SPE1CASE1.SMSPEC"))
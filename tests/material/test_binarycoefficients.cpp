@@ -257,3 +257,57 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(BrineDensityWithCO2, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(TabulatedSolubility)
+{
+    using Evaluation = Opm::DenseAd::Evaluation<double, 3>;
+
+    // Two regions with fixed salinity and salt concentration from the
+    // fluid state for the salinities in between.
+    const std::vector<double> salinity = {0.0, 0.1};
+    Opm::BrineCo2Pvt<double> exact(salinity);
+    Opm::BrineCo2Pvt<double> tabulated(salinity);
+
+    // Above the critical temperature of CO2, the solubility is smooth
+    const double tol = 2e-5;
+    const double error = tabulated.tabulateSolubility(/*T=*/310.0, 400.0,
+                                                      /*p=*/5e6, 40e6,
+                                                      /*salinities=*/{0.05},
+                                                      tol);
+    BOOST_CHECK(tabulated.solubilityIsTabulated());
+    BOOST_CHECK_LE(error, tol);
+
+    for (const double T : {311.3, 323.2, 355.7, 373.2, 399.1}) {
+        for (const double p : {5.5e6, 10e6, 17.3e6, 28.4e6, 39e6}) {
+            for (const double s : {0.0, 0.025, 0.07, 0.1}) {
+                const Evaluation Tv = Evaluation::createVariable(T, 0);
+                const Evaluation pv = Evaluation::createVariable(p, 1);
+                const Evaluation sv = Evaluation::createVariable(s, 2);
+
+                const auto rsExact = exact.rsSat(/*regionIdx=*/0, Tv, pv, sv);
+                const auto rsTab = tabulated.rsSat(/*regionIdx=*/0, Tv, pv, sv);
+
+                // A deviation of tol in the mole fraction is roughly a
+                // relative deviation of 1e-3 in Rs.
+                BOOST_CHECK_CLOSE(rsTab.value(), rsExact.value(), 0.1);
+
+                // The tabulated derivatives are the slopes of the grid cells
+                BOOST_CHECK_CLOSE(rsTab.derivative(0), rsExact.derivative(0), 10.0);
+                BOOST_CHECK_CLOSE(rsTab.derivative(1), rsExact.derivative(1), 10.0);
+
+                // The derivative of the exact evaluation with respect to
+                // salinity is not continuous at zero salinity.
+                if (s > 0.0) {
+                    BOOST_CHECK_CLOSE(rsTab.derivative(2), rsExact.derivative(2), 10.0);
+                }
+            }
+        }
+    }
+
+    // Outside of the tables the exact evaluation is used
+    const Evaluation T{450.0};
+    const Evaluation p{20e6};
+    const Evaluation s{salinity[1]};
+    BOOST_CHECK_EQUAL(tabulated.rsSat(/*regionIdx=*/1, T, p, s).value(),
+                      exact.rsSat(/*regionIdx=*/1, T, p, s).value());
+}
@@ -964,3 +964,75 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Let, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BakedSaturationFunctions, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    Opm::Parser parser;
+
+    for (const auto* deckString : { fam2DeckString, hysterDeckString }) {
+        const auto deck = parser.parseString(deckString);
+        const Opm::EclipseState eclState(deck);
+
+        const size_t n = eclState.getInputGrid().getCartesianSize();
+
+        MaterialLawManager regular;
+        regular.initFromState(eclState);
+        regular.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+        MaterialLawManager baked;
+        baked.initFromState(eclState);
+        baked.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+        const auto report = baked.bakeSaturationFunctions();
+
+        // All cells share the saturation functions of a single region
+        BOOST_CHECK_GT(report.numTables, 0u);
+        BOOST_CHECK_LE(report.numTables, baked.enableHysteresis() ? 4u : 2u);
+        BOOST_CHECK_GE(report.numBaked, 2*n);
+        BOOST_CHECK_EQUAL(report.numSkipped, 0u);
+
+        // Piecewise linear saturation functions are tabulated exactly
+        BOOST_CHECK_SMALL(report.maxError.krw, Scalar{1e-5});
+        BOOST_CHECK_SMALL(report.maxError.krn, Scalar{1e-5});
+
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            for (int i = -10; i < 120; i += 3) {
+                const Scalar Sw = Scalar(i) / 100;
+                for (int j = i; j < 120; j += 3) {
+                    const Scalar So = Scalar(j) / 100;
+
+                    typename Fixture<Scalar>::FluidState fs;
+                    fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, Sw);
+                    fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, So);
+                    fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, 1 - Sw - So);
+
+                    std::array<Scalar,numPhases> pcRegular{}, pcBaked{};
+                    MaterialLaw::capillaryPressures(pcRegular, regular.materialLawParams(elemIdx), fs);
+                    MaterialLaw::capillaryPressures(pcBaked, baked.materialLawParams(elemIdx), fs);
+
+                    std::array<Scalar,numPhases> krRegular{}, krBaked{};
+                    MaterialLaw::relativePermeabilities(krRegular, regular.materialLawParams(elemIdx), fs);
+                    MaterialLaw::relativePermeabilities(krBaked, baked.materialLawParams(elemIdx), fs);
+
+                    for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                        BOOST_CHECK_MESSAGE(std::abs(pcRegular[phaseIdx] - pcBaked[phaseIdx])
+                                            <= 1e-4*(1 + std::abs(pcRegular[phaseIdx])),
+                                            "Baked capillary pressure differs from regular evaluation");
+                        BOOST_CHECK_MESSAGE(std::abs(krRegular[phaseIdx] - krBaked[phaseIdx]) <= 1e-5,
+                                            "Baked relative permeability differs from regular evaluation");
+                    }
+                }
+            }
+        }
+
+        // Without room for tables every cell keeps the regular evaluation
+        const auto again = baked.bakeSaturationFunctions(64, 0);
+        BOOST_CHECK_EQUAL(again.numTables, 0u);
+        BOOST_CHECK_EQUAL(again.numBaked, 0u);
+        BOOST_CHECK_GE(again.numSkipped, 2*n);
+    }
+}
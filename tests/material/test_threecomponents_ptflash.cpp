@@ -38,6 +38,7 @@
 #endif
 
 #include <opm/material/constraintsolvers/PTFlash.hpp>
+#include <opm/material/eos/PengRobinsonMixtureBatch.hpp>
 #include <opm/material/fluidsystems/ThreeComponentFluidSystem.hh>
 
 #include <opm/material/densead/Evaluation.hpp>
@@ -180,3 +181,171 @@ for (const auto& sample : test_methods) {
 }
 #endif
 }
+
+namespace {
+
+FluidState makeFluidState(const Scalar p, const Scalar z0, const Scalar z1)
+{
+    ComponentVector comp;
+    comp[0] = Evaluation::createVariable(z0, 1);
+    comp[1] = Evaluation::createVariable(z1, 2);
+    comp[2] = 1. - comp[0] - comp[1];
+
+    FluidState fluid_state;
+    fluid_state.setPressure(FluidSystem::oilPhaseIdx, Evaluation::createVariable(p, 0));
+    fluid_state.setPressure(FluidSystem::gasPhaseIdx, Evaluation::createVariable(p, 0));
+    for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+        fluid_state.setMoleFraction(compIdx, comp[compIdx]);
+    }
+    fluid_state.setTemperature(300.0);
+
+    for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+        fluid_state.setKvalue(compIdx, fluid_state.wilsonK_(compIdx));
+    }
+    fluid_state.setLvalue(1.);
+
+    return fluid_state;
+}
+
+bool isSameFlash(const FluidState& fs, const FluidState& ref, const Scalar tol)
+{
+    if (! Opm::MathToolbox<Evaluation>::isSame(fs.L(), ref.L(), tol)) {
+        return false;
+    }
+
+    for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+        for (const auto phaseIdx : { FluidSystem::oilPhaseIdx, FluidSystem::gasPhaseIdx }) {
+            if (! Opm::MathToolbox<Evaluation>::isSame(fs.moleFraction(phaseIdx, compIdx),
+                                                       ref.moleFraction(phaseIdx, compIdx), tol)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(PtFlashBatch)
+{
+    using Flash = Opm::PTFlash<double, FluidSystem>;
+
+    const double flash_tolerance = 1.e-8;
+
+    const std::string method = "ssi+newton";
+
+    // Cold started cells
+    std::vector<FluidState> batch;
+    for (int i = 0; i < 20; ++i) {
+        batch.push_back(makeFluidState(10e5 + i*1e4, 0.5 - i*0.005, 0.3));
+    }
+
+    std::vector<FluidState> reference = batch;
+    for (auto& fluid_state : reference) {
+        Flash::solve(fluid_state, method, flash_tolerance);
+    }
+
+    Flash::solveBatch(batch, method, flash_tolerance);
+
+    for (std::size_t cellIdx = 0; cellIdx < batch.size(); ++cellIdx) {
+        BOOST_CHECK_MESSAGE(isSameFlash(batch[cellIdx], reference[cellIdx], 1e-6),
+                            "cell " << cellIdx << " does not match");
+    }
+
+    // Warm start from the previous solution after a small change of pressure
+    for (std::size_t cellIdx = 0; cellIdx < batch.size(); ++cellIdx) {
+        const auto p = Evaluation::createVariable(batch[cellIdx].pressure(0).value() + 1e3, 0);
+        for (auto* fs : { &batch[cellIdx], &reference[cellIdx] }) {
+            fs->setPressure(FluidSystem::oilPhaseIdx, p);
+            fs->setPressure(FluidSystem::gasPhaseIdx, p);
+        }
+        Flash::solve(reference[cellIdx], method, flash_tolerance);
+    }
+
+    Flash::solveBatch(batch, method, flash_tolerance);
+
+    for (std::size_t cellIdx = 0; cellIdx < batch.size(); ++cellIdx) {
+        BOOST_CHECK_MESSAGE(isSameFlash(batch[cellIdx], reference[cellIdx], 1e-6),
+                            "cell " << cellIdx << " does not match");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(PtFlashBatchCriticalRegion)
+{
+    using Flash = Opm::PTFlash<double, FluidSystem>;
+
+    const double flash_tolerance = 1.e-8;
+    const std::string method = "ssi+newton";
+
+    // Single-phase state, but the stored solution is two-phase with
+    // K-values close to the trivial solution.
+    auto reference = makeFluidState(10e5, 0.7, 0.3);
+    auto warm = reference;
+    warm.setKvalue(0, 1.05);
+    warm.setKvalue(1, 0.97);
+    warm.setKvalue(2, 1.02);
+    warm.setLvalue(0.5);
+
+    Flash::solve(reference, method, flash_tolerance);
+    BOOST_CHECK_EQUAL(reference.L().value(), 0.0);
+
+    // Without the stability test the two-phase solver starts from the
+    // stored K-values and does not find the single-phase solution.
+    auto plain = warm;
+    Flash::solve(plain, method, flash_tolerance);
+    BOOST_CHECK(! isSameFlash(plain, reference, 1e-6));
+
+    // The batched flash restarts from Wilson's K-values and tests stability.
+    std::vector<FluidState> batch { warm };
+    Flash::solveBatch(batch, method, flash_tolerance);
+    BOOST_CHECK(isSameFlash(batch[0], reference, 1e-6));
+}
+
+BOOST_AUTO_TEST_CASE(PengRobinsonBatch)
+{
+    constexpr std::size_t numCells = 50;
+    const Scalar temp = 320.0;
+
+    std::vector<Evaluation> p(numCells);
+    std::vector<Evaluation> x(numComponents*numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        p[cellIdx] = Evaluation::createVariable(5e5 + cellIdx*1e5, 0);
+        x[0*numCells + cellIdx] = Evaluation::createVariable(0.01*cellIdx, 1);
+        x[1*numCells + cellIdx] = Evaluation::createVariable(0.3, 2);
+        x[2*numCells + cellIdx] = 1. - x[cellIdx] - x[numCells + cellIdx];
+    }
+
+    Opm::PengRobinsonMixtureBatch<Scalar, FluidSystem> batch;
+    batch.updatePure(temp);
+
+    for (const auto phaseIdx : { FluidSystem::oilPhaseIdx, FluidSystem::gasPhaseIdx }) {
+        std::vector<Evaluation> Vm(numCells);
+        std::vector<Evaluation> phi(numComponents*numCells);
+        batch.computeFugacityCoefficients(numCells, p.data(), x.data(),
+                                          phaseIdx == FluidSystem::gasPhaseIdx,
+                                          Vm.data(), phi.data());
+
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            FluidState fluid_state;
+            fluid_state.setTemperature(temp);
+            fluid_state.setPressure(phaseIdx, p[cellIdx]);
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                fluid_state.setMoleFraction(phaseIdx, compIdx, x[compIdx*numCells + cellIdx]);
+            }
+
+            typename FluidSystem::template ParameterCache<Evaluation> paramCache;
+            paramCache.updatePhase(fluid_state, phaseIdx);
+
+            BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(Vm[cellIdx],
+                                                                     paramCache.molarVolume(phaseIdx), 1e-8),
+                                "molar volume of cell " << cellIdx << " does not match");
+
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                const Evaluation ref = FluidSystem::fugacityCoefficient(fluid_state, paramCache, phaseIdx, compIdx);
+                BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(phi[compIdx*numCells + cellIdx], ref, 1e-8),
+                                    "fugacity coefficient of component " << compIdx << " in cell " << cellIdx << " does not match");
+            }
+        }
+    }
+}
@@ -42,6 +42,8 @@
 #include <array>
 #include <initializer_list>
 #include <stdexcept>
+#include <string>
+#include <utility>
 #include <vector>
 
 BOOST_AUTO_TEST_SUITE(Basic)
@@ -267,6 +269,112 @@ BOOST_AUTO_TEST_CASE(DefaultedRegions) {
   BOOST_CHECK_EQUAL( scanner1.getRegionMultiplier(grid.getGlobalIndex(2,0,0), grid.getGlobalIndex(2,0,1), Opm::FaceDir::ZPlus), 0.75);
 }
 
+BOOST_AUTO_TEST_CASE(BatchedConnections) {
+  Opm::Deck deck = createDefaultedRegions();
+  Opm::EclipseGrid grid( deck );
+  Opm::TableManager tm(deck);
+  Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, tm);
+
+  const auto keywords = deck.getKeywordList<Opm::ParserKeywords::MULTREGT>();
+  const Opm::MULTREGTScanner original(grid, &fp, keywords);
+  const Opm::MULTREGTScanner scanner = original;
+
+  std::vector<Opm::MULTREGTScanner::Connection> connections;
+  std::vector<std::pair<std::size_t, std::size_t>> cellPairs;
+  for (std::size_t c1 = 0; c1 < grid.getCartesianSize(); ++c1) {
+      for (std::size_t c2 = 0; c2 < grid.getCartesianSize(); ++c2) {
+          for (const auto faceDir : { Opm::FaceDir::XPlus, Opm::FaceDir::YMinus, Opm::FaceDir::ZPlus }) {
+              connections.push_back({ c1, c2, faceDir });
+          }
+          cellPairs.emplace_back(c1, c2);
+      }
+  }
+
+  const auto mult = scanner.getRegionMultipliers(connections);
+  BOOST_REQUIRE_EQUAL(mult.size(), connections.size());
+  for (std::size_t i = 0; i < connections.size(); ++i) {
+      const auto& conn = connections[i];
+      BOOST_CHECK_EQUAL(mult[i], original.getRegionMultiplier(conn.globalCellIdx1, conn.globalCellIdx2, conn.faceDir));
+  }
+
+  const auto multNNC = scanner.getRegionMultipliersNNC(cellPairs);
+  BOOST_REQUIRE_EQUAL(multNNC.size(), cellPairs.size());
+  for (std::size_t i = 0; i < cellPairs.size(); ++i) {
+      BOOST_CHECK_EQUAL(multNNC[i], original.getRegionMultiplierNNC(cellPairs[i].first, cellPairs[i].second));
+  }
+}
+
+namespace {
+    Opm::Deck createSparseRegionsDeck(const int maxRegion)
+    {
+        const auto r = std::to_string(maxRegion);
+
+        return Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+2 2 1 /
+GRID
+DX
+4*0.25 /
+DY
+4*0.25 /
+DZ
+4*0.25 /
+TOPS
+4*0.25 /
+FLUXNUM
+1 )" + r + R"(
+1 )" + r + R"(
+/
+MULTREGT
+1  )" + r + R"(   0.50   X    ALL    F /
+)" + r + "  " + r + R"(   0.25   XY   ALL    F /
+/
+EDIT
+)");
+    }
+
+    void checkSparseRegionMultipliers(const int maxRegion)
+    {
+        Opm::Deck deck = createSparseRegionsDeck(maxRegion);
+        Opm::EclipseGrid grid( deck );
+        Opm::TableManager tm(deck);
+        Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, tm);
+
+        const auto keywords = deck.getKeywordList<Opm::ParserKeywords::MULTREGT>();
+        const Opm::MULTREGTScanner scanner(grid, &fp, keywords);
+
+        // Regions 1 to maxRegion, pair and same region multipliers
+        BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(grid.getGlobalIndex(0,0,0), grid.getGlobalIndex(1,0,0),
+                                                       Opm::FaceDir::XPlus ), 0.125);
+        // Region maxRegion to maxRegion
+        BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(grid.getGlobalIndex(1,0,0), grid.getGlobalIndex(1,1,0),
+                                                       Opm::FaceDir::YPlus ), 0.25);
+        // Region 1 to 1
+        BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(grid.getGlobalIndex(0,0,0), grid.getGlobalIndex(0,1,0),
+                                                       Opm::FaceDir::YPlus ), 1.0);
+
+        const auto mult = scanner.getRegionMultipliers({
+            { grid.getGlobalIndex(0,0,0), grid.getGlobalIndex(1,0,0), Opm::FaceDir::XPlus },
+            { grid.getGlobalIndex(1,0,0), grid.getGlobalIndex(1,1,0), Opm::FaceDir::YPlus },
+            { grid.getGlobalIndex(0,0,0), grid.getGlobalIndex(0,1,0), Opm::FaceDir::YPlus },
+        });
+        BOOST_CHECK( mult == (std::vector<double>{ 0.125, 0.25, 1.0 }) );
+    }
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(SparseRegionIds) {
+    // The range of region IDs is too large for dense lookup tables of
+    // either the region pairs or the regions.
+    checkSparseRegionMultipliers(2000000000);
+}
+
+BOOST_AUTO_TEST_CASE(DenseRegionPairLimit) {
+    // At most 2^20 region pairs are stored densely, i.e., 1024 regions.
+    // One more region switches to hashed lookup.
+    checkSparseRegionMultipliers(1024);
+    checkSparseRegionMultipliers(1025);
+}
+
 namespace {
     Opm::Deck createCopyMULTNUMDeck()
     {
@@ -304,6 +304,48 @@ DATES             -- 7
 /
 )";
 
+std::string WELPI_deck = R"(
+START             -- 0
+10 MAI 2007 /
+GRID
+PORO
+    1000*0.1 /
+PERMX
+    1000*1 /
+PERMY
+    1000*0.1 /
+PERMZ
+    1000*0.01 /
+SCHEDULE
+WELSPECS
+     'P'          'OP'    1    1  1*         'OIL'  /
+/
+
+COMPDAT
+ 'P'  1  1   1   3 'OPEN' 1*    100 /
+/
+
+WCONPROD
+     'P'      'OPEN'      'ORAT'      100.0 /
+/
+
+DATES             -- 1
+ 10  JUN 2007 /
+/
+
+WELPI
+     'P'      200.0 /
+/
+
+DATES             -- 2
+ 15  JUN 2007 /
+/
+
+DATES             -- 3
+ 20  JUN 2007 /
+/
+)";
+
 static Schedule make_schedule(const std::string& deck_string)
 {
     const auto& deck = Parser{}.parseString(deck_string);
@@ -470,3 +512,99 @@ BOOST_AUTO_TEST_CASE(SerializeGROUPS)
     BOOST_CHECK( groups2 == sched0[4].groups);
     BOOST_CHECK( groups2 == sched0[5].groups);
 }
+
+BOOST_AUTO_TEST_CASE(SerializeDelta)
+{
+    auto sched = make_schedule(WTEST_deck);
+    const auto base = sched;
+
+    // Receiving side, holding the schedule before the update
+    Opm::Schedule sched0;
+    std::size_t full_size = 0;
+    {
+        Opm::Serialization::MemPacker packer;
+        Opm::Serializer ser(packer);
+        ser.pack(sched);
+        full_size = ser.position();
+        ser.unpack(sched0);
+    }
+
+    {
+        const auto deck = Parser{}.parseString(R"(
+WCONPROD
+     'W1'      'OPEN'      'ORAT'      100.0 /
+/
+
+WTEST
+   'W2'  1  'P' /
+/
+)");
+        std::vector<std::unique_ptr<DeckKeyword>> keywords;
+        for (const auto& keyword : deck) {
+            keywords.push_back(std::make_unique<DeckKeyword>(keyword));
+        }
+        sched.applyKeywords(keywords, 3);
+    }
+
+    BOOST_CHECK(!(sched == sched0));
+
+    std::size_t delta_size = 0;
+    {
+        Opm::Serialization::MemPacker packer;
+        Opm::Serializer ser(packer);
+        ser.pack(Schedule::Delta(sched, base));
+        delta_size = ser.position();
+
+        Schedule::Delta delta(sched0);
+        ser.unpack(delta);
+        BOOST_CHECK_EQUAL(ser.position(), delta_size);
+    }
+
+    BOOST_CHECK(sched == sched0);
+    BOOST_CHECK_LT(delta_size, full_size);
+
+    // Unchanged report steps keep their storage
+    const auto& w1 = sched0[1].wells.get_ptr("W1");
+    BOOST_CHECK(sched0[0].wells.get_ptr("W1") == w1);
+    BOOST_CHECK(sched0[2].wells("W1").getProductionProperties().controlMode != Well::ProducerCMode::ORAT);
+    BOOST_CHECK(sched0[3].wells("W1").getProductionProperties().controlMode == Well::ProducerCMode::ORAT);
+    BOOST_CHECK(!sched0[2].wtest_config().has("W2"));
+    BOOST_CHECK(sched0[3].wtest_config().has("W2"));
+}
+
+BOOST_AUTO_TEST_CASE(SerializeDeltaWellPIScaling)
+{
+    auto sched = make_schedule(WELPI_deck);
+    const auto base = sched;
+
+    Opm::Schedule sched0;
+    {
+        Opm::Serialization::MemPacker packer;
+        Opm::Serializer ser(packer);
+        ser.pack(sched);
+        ser.unpack(sched0);
+    }
+
+    const auto cf = sched[1].wells("P").getConnections()[0].CF();
+    const auto wellPI = sched[1].wells("P").convertDeckPI(200.0) / 2.0;
+    sched.applyWellProdIndexScaling("P", 1, wellPI);
+
+    // The scaling must not change the objects shared with 'base'
+    BOOST_CHECK_CLOSE(sched[1].wells("P").getConnections()[0].CF(), 2*cf, 1.0e-8);
+    BOOST_CHECK_CLOSE(sched[3].wells("P").getConnections()[0].CF(), 2*cf, 1.0e-8);
+    BOOST_CHECK_CLOSE(sched[0].wells("P").getConnections()[0].CF(), cf, 1.0e-8);
+    BOOST_CHECK_CLOSE(base[1].wells("P").getConnections()[0].CF(), cf, 1.0e-8);
+    BOOST_CHECK(sched[2].wells.get_ptr("P") == sched[1].wells.get_ptr("P"));
+
+    {
+        Opm::Serialization::MemPacker packer;
+        Opm::Serializer ser(packer);
+        ser.pack(Schedule::Delta(sched, base));
+
+        Schedule::Delta delta(sched0);
+        ser.unpack(delta);
+    }
+
+    BOOST_CHECK(sched == sched0);
+    BOOST_CHECK_CLOSE(sched0[3].wells("P").getConnections()[0].CF(), 2*cf, 1.0e-8);
+}
@@ -322,3 +322,25 @@ BOOST_AUTO_TEST_CASE( Test_LINEAR_DEFAULT ) {
     BOOST_CHECK_CLOSE( valueColumn[3] , 1.00 , 1e-6);
     BOOST_CHECK_CLOSE( valueColumn[5] , 0.25 , 1e-6);
 }
+
+BOOST_AUTO_TEST_CASE( Test_APPLIED_DEFAULTS_EQUAL ) {
+    ColumnSchema argSchema("COLUMN" , Table::INCREASING , Table::DEFAULT_NONE);
+    ColumnSchema valueSchema("COLUMN" , Table::RANDOM , Table::DEFAULT_LINEAR);
+    TableColumn argColumn( argSchema );
+    TableColumn valueColumn( valueSchema );
+    TableColumn explicitColumn( valueSchema );
+
+    argColumn.addValue( 0.0, "TableTested"  ); valueColumn.addValue( 0.0, "TableTested" );
+    argColumn.addValue( 0.5, "TableTested"  ); valueColumn.addDefault( "TableTested" );
+    argColumn.addValue( 1.0, "TableTested"  ); valueColumn.addValue( 2.0, "TableTested" );
+    valueColumn.applyDefaults( argColumn, "TableTested"  );
+
+    explicitColumn.addValue( 0.0, "TableTested" );
+    explicitColumn.addValue( 1.0, "TableTested" );
+    explicitColumn.addValue( 2.0, "TableTested" );
+
+    // Once all defaults are resolved the column is indistinguishable from
+    // one which never had any.
+    BOOST_CHECK( !valueColumn.defaultApplied( 1 ) );
+    BOOST_CHECK( valueColumn == explicitColumn );
+}
@@ -316,6 +316,75 @@ BOOST_AUTO_TEST_CASE(TestERst_4) {
 }
 
 
+
+BOOST_AUTO_TEST_CASE(TestERst_SingleReportStep) {
+
+    WorkArea work;
+
+    for (const std::string testFile : { "SPE1_TESTCASE.UNRST", "SPE1_TESTCASE.FUNRST" }) {
+        work.copyIn(testFile);
+
+        ERst rst1(testFile);
+        rst1.loadReportStepNumber(25);
+
+        // First use scans the file and leaves it alone, second use reads
+        // the explicitly created array index.
+        for (int i = 0; i < 2; i++) {
+            if (i == 1) {
+                EclFile(testFile).writeArrayIndex();
+            }
+
+            ERst rst2(testFile, 25);
+
+            BOOST_CHECK_EQUAL(std::filesystem::exists(arrayIndexFilename(testFile)), i == 1);
+            BOOST_CHECK_EQUAL(rst2.listOfReportStepNumbers() == std::vector<int>{25}, true);
+            BOOST_CHECK_EQUAL(rst2.listOfRstArrays(25) == rst1.listOfRstArrays(25), true);
+
+            rst2.loadReportStepNumber(25, { "PRESSURE", "SWAT", "IWEL", "XXXX" });
+
+            BOOST_CHECK_EQUAL(rst2.getRestartData<float>("PRESSURE", 25, 0) ==
+                              rst1.getRestartData<float>("PRESSURE", 25, 0), true);
+            BOOST_CHECK_EQUAL(rst2.getRestartData<float>("SWAT", 25, 0) ==
+                              rst1.getRestartData<float>("SWAT", 25, 0), true);
+            BOOST_CHECK_EQUAL(rst2.getRestartData<int>("IWEL", 25, 0) ==
+                              rst1.getRestartData<int>("IWEL", 25, 0), true);
+
+            // Not loaded by loadReportStepNumber(), read on demand
+            BOOST_CHECK_EQUAL(rst2.getRestartData<double>("XCON", 25, 0) ==
+                              rst1.getRestartData<double>("XCON", 25, 0), true);
+        }
+
+        ERst rst3(testFile, 4);
+        BOOST_CHECK_EQUAL(rst3.hasReportStepNumber(4), false);
+        BOOST_CHECK_EQUAL(rst3.listOfReportStepNumbers().empty(), true);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(TestERst_SingleReportStep_NotLast) {
+
+    // Scan stops at the SEQNUM array of the next report step
+    ERst rst1("LGR_TESTMOD.UNRST");
+
+    for (const int number : { 0, 1, 2, 3 }) {
+        ERst rst2("LGR_TESTMOD.UNRST", number);
+
+        BOOST_CHECK_EQUAL(rst2.listOfReportStepNumbers() == std::vector<int>{number}, true);
+        BOOST_CHECK_EQUAL(rst2.listOfRstArrays(number) == rst1.listOfRstArrays(number), true);
+        BOOST_CHECK_EQUAL(rst2.getRestartData<float>("PRESSURE", number, "LGR1") ==
+                          rst1.getRestartData<float>("PRESSURE", number, "LGR1"), true);
+    }
+
+    // All arrays of a separate restart file
+    ERst rst3("LGR_TESTMOD.X0002");
+    ERst rst4("LGR_TESTMOD.X0002", 2);
+
+    BOOST_CHECK_EQUAL(rst4.listOfRstArrays(2) == rst3.listOfRstArrays(2), true);
+    BOOST_CHECK_EQUAL(rst4.getRestartData<float>("PRESSURE", 2, "LGR1") ==
+                      rst3.getRestartData<float>("PRESSURE", 2, "LGR1"), true);
+}
+
+
 BOOST_AUTO_TEST_CASE(TestERst_5a) {
 
     std::string testRstFile = "LGR_TESTMOD.X0002";
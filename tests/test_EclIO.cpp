@@ -28,6 +28,8 @@
 #include <tuple>
 #include <cmath>
 #include <numeric>
+#include <cstdint>
+#include <vector>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
@@ -549,3 +551,151 @@ BOOST_AUTO_TEST_CASE(CombinedVectorID) {
         BOOST_CHECK_EQUAL(n2,  1);
     }
 }
+
+BOOST_AUTO_TEST_CASE(FlipEndianArray) {
+    // Odd element counts to exercise both vector kernels and scalar tail.
+    for (const auto n : { 0, 1, 3, 4, 5, 17, 1001 }) {
+        std::vector<int> ints(n);
+        std::iota(ints.begin(), ints.end(), -7);
+
+        std::vector<int> expect_ints(n);
+        std::transform(ints.begin(), ints.end(), expect_ints.begin(), flipEndianInt);
+
+        flipEndianArray32(ints.data(), ints.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(ints.begin(), ints.end(),
+                                      expect_ints.begin(), expect_ints.end());
+
+        std::vector<std::int64_t> longs(n);
+        std::iota(longs.begin(), longs.end(), std::int64_t{1} << 40);
+
+        std::vector<std::int64_t> expect_longs(n);
+        std::transform(longs.begin(), longs.end(), expect_longs.begin(), flipEndianLongInt);
+
+        flipEndianArray64(longs.data(), longs.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(longs.begin(), longs.end(),
+                                      expect_longs.begin(), expect_longs.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEcl_Write_Read_Large_Binary) {
+    // Large enough to span several write and read buffers.
+    const auto n = std::size_t{1'234'567};
+
+    std::vector<int> inte(n);
+    std::iota(inte.begin(), inte.end(), -17);
+
+    std::vector<float> real(n);
+    std::transform(inte.begin(), inte.end(), real.begin(),
+                   [](const int i) { return 0.25f * i; });
+
+    std::vector<double> doub(n);
+    std::transform(inte.begin(), inte.end(), doub.begin(),
+                   [](const int i) { return 1.0e-3 * i; });
+
+    std::vector<bool> logi(n);
+    for (auto i = 0*n; i < n; ++i) {
+        logi[i] = (i % 3) == 0;
+    }
+
+    WorkArea work;
+    {
+        EclOutput eclTest("LARGE.DAT", false);
+
+        eclTest.write("INTE", inte);
+        eclTest.write("REAL", real);
+        eclTest.write("DOUB", doub);
+        eclTest.write("LOGI", logi);
+    }
+
+    EclFile file1("LARGE.DAT");
+
+    BOOST_CHECK_MESSAGE(file1.get<int>("INTE") == inte, "INTE array must survive round trip");
+    BOOST_CHECK_MESSAGE(file1.get<float>("REAL") == real, "REAL array must survive round trip");
+    BOOST_CHECK_MESSAGE(file1.get<double>("DOUB") == doub, "DOUB array must survive round trip");
+    BOOST_CHECK_MESSAGE(file1.get<bool>("LOGI") == logi, "LOGI array must survive round trip");
+}
+
+BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted_exponents) {
+    const std::vector<double> doub { 0.5, -2.5e+120, 1.0e-101, 1.0e+99 };
+    const std::vector<float> real { 0.5f, -1.25e-30f, 3.0e+38f };
+
+    WorkArea work;
+    {
+        EclOutput eclTest("EXPONENTS.FDAT", true);
+
+        eclTest.write("DOUB", doub);
+        eclTest.write("REAL", real);
+    }
+
+    {
+        std::ifstream is("EXPONENTS.FDAT");
+        const std::string text { std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{} };
+
+        const std::string expect =
+            " 'DOUB    '           4 'DOUB'\n"
+            "   0.50000000000000D+00  -0.25000000000000+121   0.10000000000000-100\n"
+            "   0.10000000000000+100\n"
+            " 'REAL    '           3 'REAL'\n"
+            "   0.50000000E+00  -0.12500000E-29   0.30000000E+39\n";
+
+        BOOST_CHECK_EQUAL(text, expect);
+    }
+
+    EclFile file1("EXPONENTS.FDAT");
+
+    BOOST_CHECK_MESSAGE(file1.get<double>("DOUB") == doub, "DOUB array must survive round trip");
+    BOOST_CHECK_MESSAGE(file1.get<float>("REAL") == real, "REAL array must survive round trip");
+}
+
+BOOST_AUTO_TEST_CASE(TestEcl_Write_Read_Large_Formatted) {
+    // Large enough to span several output blocks and input chunks.
+    const auto n = std::size_t{54'321};
+
+    std::vector<int> inte(n);
+    std::iota(inte.begin(), inte.end(), -17);
+
+    std::vector<float> real(n);
+    std::transform(inte.begin(), inte.end(), real.begin(),
+                   [](const int i) { return 0.25f * i; });
+
+    std::vector<double> doub(n);
+    std::transform(inte.begin(), inte.end(), doub.begin(),
+                   [](const int i) { return 0.125 * i; });
+
+    std::vector<bool> logi(n);
+    for (auto i = 0*n; i < n; ++i) {
+        logi[i] = (i % 3) == 0;
+    }
+
+    WorkArea work;
+    {
+        EclOutput eclTest("LARGE.FDAT", true);
+
+        eclTest.write("INTE", inte);
+        eclTest.write("REAL", real);
+        eclTest.write("DOUB", doub);
+        eclTest.write("LOGI", logi);
+    }
+
+    EclFile file1("LARGE.FDAT");
+
+    BOOST_CHECK_MESSAGE(file1.get<int>("INTE") == inte, "INTE array must survive round trip");
+    BOOST_CHECK_MESSAGE(file1.get<float>("REAL") == real, "REAL array must survive round trip");
+    BOOST_CHECK_MESSAGE(file1.get<double>("DOUB") == doub, "DOUB array must survive round trip");
+    BOOST_CHECK_MESSAGE(file1.get<bool>("LOGI") == logi, "LOGI array must survive round trip");
+}
+
+BOOST_AUTO_TEST_CASE(TestEcl_Read_Formatted_Trailing_Characters) {
+    const std::string good = "   0.15000000000000D+04  -0.25000000000000-101         17\n";
+
+    const auto doub = readFormattedDoubArray(good, 2, 0);
+    BOOST_CHECK_EQUAL(doub[0], 1.5e+03);
+    BOOST_CHECK_EQUAL(doub[1], -2.5e-102);
+
+    const auto inte = readFormattedInteArray(good, 1, good.find("17"));
+    BOOST_CHECK_EQUAL(inte[0], 17);
+
+    BOOST_CHECK_THROW(readFormattedDoubArray("   1.5E+03xyz  2.0\n", 2, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(readFormattedRealArray("   1.5E+03xyz  2.0\n", 2, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(readFormattedInteArray("   12abc  3\n", 2, 0), std::invalid_argument);
+}
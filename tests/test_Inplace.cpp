@@ -66,6 +66,24 @@ BOOST_AUTO_TEST_CASE(TESTInplace)
     }
 }
 
+BOOST_AUTO_TEST_CASE(TESTInplace_Vector)
+{
+    Inplace oip;
+
+    oip.add("FIPNUM", Inplace::Phase::OIL, 7, 1.0);
+    oip.add("FIPNUM", Inplace::Phase::OIL, { 10.0, 0.0, 30.0 });
+
+    BOOST_CHECK_EQUAL( oip.get("FIPNUM", Inplace::Phase::OIL, 1) , 10.0);
+    BOOST_CHECK_EQUAL( oip.get("FIPNUM", Inplace::Phase::OIL, 2) , 0.0);
+    BOOST_CHECK_EQUAL( oip.get("FIPNUM", Inplace::Phase::OIL, 3) , 30.0);
+    BOOST_CHECK_EQUAL( oip.get("FIPNUM", Inplace::Phase::OIL, 7) , 1.0);
+    BOOST_CHECK_EQUAL( oip.max_region("FIPNUM"), 7);
+
+    const auto v1 = oip.get_vector("FIPNUM", Inplace::Phase::OIL);
+    const std::vector<double> e1 = {10,0,30,0,0,0,1};
+    BOOST_CHECK_MESSAGE(v1 == e1, "In-place oil content must match expected");
+}
+
 BOOST_AUTO_TEST_CASE(InPlace_Phases)
 {
     const auto& phases = Inplace::phases();
@@ -23,6 +23,8 @@
 
 #include <opm/io/eclipse/OutputStream.hpp>
 
+#include <opm/io/eclipse/ArrayIndex.hpp>
+#include <opm/io/eclipse/AsyncWriter.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ERst.hpp>
@@ -33,9 +35,15 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <ctime>
+#include <filesystem>
+#include <fstream>
 #include <iterator>
+#include <memory>
 #include <ostream>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -2425,3 +2433,327 @@ BOOST_AUTO_TEST_CASE(Formatted_Restarted)
 }
 
 BOOST_AUTO_TEST_SUITE_END() // Class_SummarySpecification
+
+// ==========================================================================
+
+namespace {
+    std::string fileContents(const std::string& fname)
+    {
+        std::ifstream is(fname, std::ios_base::binary);
+
+        return { std::istreambuf_iterator<char>{is},
+                 std::istreambuf_iterator<char>{} };
+    }
+
+    void writeRestartSteps(const ::Opm::EclIO::OutputStream::ResultSet& rset,
+                           const bool                                   formatted,
+                           const std::vector<int>&                      steps,
+                           std::shared_ptr<::Opm::EclIO::AsyncWriter>   writer,
+                           const bool                                   indexed = true)
+    {
+        using Char8 = ::Opm::EclIO::PaddedOutputString<8>;
+
+        const auto fmt   = ::Opm::EclIO::OutputStream::Formatted{ formatted };
+        const auto unif  = ::Opm::EclIO::OutputStream::Unified  { true };
+        const auto index = ::Opm::EclIO::OutputStream::Indexed  { indexed };
+
+        for (const auto& step : steps) {
+            auto rst = ::Opm::EclIO::OutputStream::Restart {
+                rset, step, fmt, unif, writer, index
+            };
+
+            rst.write("I", std::vector<int>(1000, step));
+            rst.write("L", std::vector<bool>{ true, false, (step % 2) == 0 });
+            rst.write("S", std::vector<float>(2500, 1.25f * step));
+            rst.message("STARTSOL");
+            rst.write("D", std::vector<double>(1500, 0.5 * step));
+            rst.write("Z", std::vector<Char8>{ Char8{"W1"}, Char8{"W2"}, Char8{"GROUP"} });
+            rst.write("C", std::vector<std::string>{ "A long string value" });
+            rst.message("ENDSOL");
+        }
+    }
+
+    void writeRestartCase(const ::Opm::EclIO::OutputStream::ResultSet& rset,
+                          const bool                                   formatted,
+                          std::shared_ptr<::Opm::EclIO::AsyncWriter>   writer)
+    {
+        // Write steps 1..4, then restart from step 3 which truncates the
+        // unified restart file at the start of that step.
+        writeRestartSteps(rset, formatted, { 1, 2, 3, 4 }, writer);
+        writeRestartSteps(rset, formatted, { 3, 5 }, writer);
+    }
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Async_Output)
+
+BOOST_AUTO_TEST_CASE(Unified_Restart_Same_As_Synchronous)
+{
+    for (const auto formatted : { false, true }) {
+        const auto rsetSync  = RSet("SYNC");
+        const auto rsetAsync = RSet("ASYNC");
+
+        writeRestartCase(rsetSync, formatted, {});
+
+        {
+            // Tiny limit to force producer to wait for background thread.
+            auto writer = std::make_shared<::Opm::EclIO::AsyncWriter>(1024);
+
+            writeRestartCase(rsetAsync, formatted, writer);
+            writer->fence();
+
+            BOOST_CHECK_EQUAL(writer->pendingBytes(), std::size_t{0});
+        }
+
+        const auto ext = std::string { formatted ? "FUNRST" : "UNRST" };
+
+        const auto expect = fileContents(::Opm::EclIO::OutputStream::outputFileName(rsetSync, ext));
+        const auto actual = fileContents(::Opm::EclIO::OutputStream::outputFileName(rsetAsync, ext));
+
+        BOOST_CHECK_GT(expect.size(), std::string::size_type{0});
+        BOOST_CHECK_MESSAGE(actual == expect,
+                            "Asynchronous " << ext << " output must match synchronous output");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Init_Same_As_Synchronous)
+{
+    auto writeInit = [](const ::Opm::EclIO::OutputStream::ResultSet& rset,
+                        const bool                                   formatted,
+                        std::shared_ptr<::Opm::EclIO::AsyncWriter>   writer)
+    {
+        auto init = ::Opm::EclIO::OutputStream::Init {
+            rset, ::Opm::EclIO::OutputStream::Formatted { formatted }, writer
+        };
+
+        init.write("I", std::vector<int>(1000, 17));
+        init.write("L", std::vector<bool>{ true, false, true });
+        init.write("S", std::vector<float>(2500, 1.25f));
+        init.write("D", std::vector<double>(1500, 0.5));
+    };
+
+    for (const auto formatted : { false, true }) {
+        const auto rsetSync  = RSet("SYNC_INIT");
+        const auto rsetAsync = RSet("ASYNC_INIT");
+
+        writeInit(rsetSync, formatted, {});
+
+        {
+            auto writer = std::make_shared<::Opm::EclIO::AsyncWriter>(1024);
+
+            writeInit(rsetAsync, formatted, writer);
+            writer->fence();
+        }
+
+        const auto ext = std::string { formatted ? "FINIT" : "INIT" };
+
+        const auto expect = fileContents(::Opm::EclIO::OutputStream::outputFileName(rsetSync, ext));
+        const auto actual = fileContents(::Opm::EclIO::OutputStream::outputFileName(rsetAsync, ext));
+
+        BOOST_CHECK_GT(expect.size(), std::string::size_type{0});
+        BOOST_CHECK_MESSAGE(actual == expect,
+                            "Asynchronous " << ext << " output must match synchronous output");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Task_Error_Reported_By_Fence)
+{
+    auto writer = ::Opm::EclIO::AsyncWriter{};
+
+    auto executed = std::vector<int>{};
+
+    writer.submit([&executed]() { executed.push_back(1); }, 0);
+    writer.submit([]() { throw std::runtime_error { "Disk full" }; }, 0);
+    writer.submit([&executed]() { executed.push_back(3); }, 0);
+
+    BOOST_CHECK_THROW(writer.fence(), std::runtime_error);
+
+    // Tasks following a failed task are discarded until the error has
+    // been reported.
+    BOOST_CHECK_EQUAL(executed.size(), std::size_t{1});
+
+    writer.submit([&executed]() { executed.push_back(4); }, 0);
+    BOOST_CHECK_NO_THROW(writer.fence());
+
+    const auto expect = std::vector<int> { 1, 4 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(executed.begin(), executed.end(),
+                                  expect.begin(), expect.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Async_Output
+
+// ==========================================================================
+
+BOOST_AUTO_TEST_SUITE(Array_Index)
+
+BOOST_AUTO_TEST_CASE(Unified_Restart_Matches_Scan)
+{
+    for (const auto formatted : { false, true }) {
+        for (const auto async : { false, true }) {
+            const auto rset = RSet("INDEX");
+
+            {
+                auto writer = async
+                    ? std::make_shared<::Opm::EclIO::AsyncWriter>(1024)
+                    : std::shared_ptr<::Opm::EclIO::AsyncWriter>{};
+
+                writeRestartCase(rset, formatted, writer);
+
+                if (writer != nullptr) {
+                    writer->fence();
+                }
+            }
+
+            const auto fname = ::Opm::EclIO::OutputStream::
+                outputFileName(rset, formatted ? "FUNRST" : "UNRST");
+
+            const auto sidecar = ::Opm::EclIO::arrayIndexFilename(fname);
+            BOOST_REQUIRE_MESSAGE(std::filesystem::exists(sidecar),
+                                  "Unified restart file must have an array index");
+            BOOST_CHECK(::Opm::EclIO::readArrayIndex(fname, std::filesystem::file_size(fname), formatted).has_value());
+
+            const auto indexed = ::Opm::EclIO::EclFile{ fname }.arrayIndex();
+
+            std::filesystem::remove(sidecar);
+            const auto scanned = ::Opm::EclIO::EclFile{ fname }.arrayIndex();
+
+            BOOST_REQUIRE_EQUAL(indexed.size(), scanned.size());
+            for (auto i = 0*indexed.size(); i < indexed.size(); ++i) {
+                BOOST_TEST_CONTEXT("Array " << i << " of " << fname) {
+                    BOOST_CHECK_EQUAL(indexed[i].arrayName(), scanned[i].arrayName());
+                    BOOST_CHECK_EQUAL(indexed[i].dataPosition, scanned[i].dataPosition);
+                    BOOST_CHECK_EQUAL(indexed[i].size, scanned[i].size);
+                    BOOST_CHECK_EQUAL(indexed[i].type, scanned[i].type);
+                    BOOST_CHECK_EQUAL(indexed[i].elementSize, scanned[i].elementSize);
+                    BOOST_CHECK_EQUAL(indexed[i].reportStep, scanned[i].reportStep);
+                }
+            }
+
+            // Steps 1 and 2, and steps 3 and 5 from the restarted run
+            BOOST_CHECK_EQUAL(indexed.front().reportStep, 1);
+            BOOST_CHECK_EQUAL(indexed.back().reportStep, 5);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Stale_Index_Ignored)
+{
+    const auto rset = RSet("STALE");
+
+    writeRestartSteps(rset, false, { 1, 2 }, {});
+
+    const auto fname = ::Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+    const auto expect = ::Opm::EclIO::EclFile{ fname }.getList();
+
+    // Appending without maintaining the index invalidates it
+    {
+        auto stream = ::Opm::EclIO::EclOutput{ fname, false, std::ios_base::app };
+        stream.write("SEQNUM", std::vector<int>{ 3 });
+        stream.write("I", std::vector<int>(10, 3));
+    }
+
+    auto rst = ::Opm::EclIO::ERst{ fname };
+    BOOST_CHECK_EQUAL(rst.getList().size(), expect.size() + 2);
+    BOOST_CHECK(rst.hasReportStepNumber(3));
+}
+
+BOOST_AUTO_TEST_CASE(Modified_File_Index_Ignored)
+{
+    const auto rset = RSet("REWRITE");
+
+    writeRestartSteps(rset, false, { 1, 2 }, {});
+
+    const auto fname = ::Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+    const auto fileSize = std::filesystem::file_size(fname);
+    BOOST_REQUIRE(::Opm::EclIO::readArrayIndex(fname, fileSize, false).has_value());
+
+    // Same size, different first array.  The index matches the file size
+    // only.  The array name follows the four byte record marker.
+    {
+        std::fstream os(fname, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        os.seekp(4);
+        os.write("XEQNUM", 6);
+    }
+
+    BOOST_REQUIRE_EQUAL(std::filesystem::file_size(fname), fileSize);
+    BOOST_CHECK(! ::Opm::EclIO::readArrayIndex(fname, fileSize, false).has_value());
+
+    const auto arrays = ::Opm::EclIO::EclFile{ fname }.getList();
+    BOOST_REQUIRE(! arrays.empty());
+    BOOST_CHECK_EQUAL(std::get<0>(arrays.front()), "XEQNUM");
+}
+
+BOOST_AUTO_TEST_CASE(Rewritten_File_Index_Ignored)
+{
+    const auto rset = RSet("INPLACE");
+
+    writeRestartSteps(rset, false, { 1, 2 }, {});
+
+    const auto fname = ::Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+    const auto fileSize = std::filesystem::file_size(fname);
+
+    const auto index = ::Opm::EclIO::readArrayIndex(fname, fileSize, false);
+    BOOST_REQUIRE(index.has_value());
+    BOOST_REQUIRE(index->size() > std::size_t{2});
+
+    // Same size, first and last arrays unchanged, different second array.
+    // Timestamp resolution may be coarser than the time between writing
+    // the sidecar and rewriting the file, so move the modification time
+    // forward explicitly.
+    const auto modified = std::filesystem::last_write_time(fname);
+    {
+        std::fstream os(fname, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        os.seekp(static_cast<std::streamoff>((*index)[1].headerPosition + 4));
+        os.write("X", 1);
+    }
+    std::filesystem::last_write_time(fname, modified + std::chrono::seconds(1));
+
+    BOOST_REQUIRE_EQUAL(std::filesystem::file_size(fname), fileSize);
+    BOOST_CHECK(! ::Opm::EclIO::readArrayIndex(fname, fileSize, false).has_value());
+
+    const auto arrays = ::Opm::EclIO::EclFile{ fname }.getList();
+    BOOST_REQUIRE(arrays.size() > std::size_t{1});
+    BOOST_CHECK_EQUAL(std::get<0>(arrays[1]).front(), 'X');
+}
+
+BOOST_AUTO_TEST_CASE(Corrupt_Index_Count_Ignored)
+{
+    const auto rset = RSet("COUNT");
+
+    writeRestartSteps(rset, false, { 1, 2 }, {});
+
+    const auto fname = ::Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+    const auto fileSize = std::filesystem::file_size(fname);
+
+    const auto index = ::Opm::EclIO::readArrayIndex(fname, fileSize, false);
+    BOOST_REQUIRE(index.has_value());
+
+    // Entry count whose byte size wraps around to the actual size of the
+    // sidecar.  Count follows magic, version, file size and modification
+    // time.
+    const auto count = static_cast<std::uint64_t>(index->size()) + (std::uint64_t{1} << 60);
+    {
+        std::fstream os(::Opm::EclIO::arrayIndexFilename(fname),
+                        std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        os.seekp(32);
+        os.write(reinterpret_cast<const char*>(&count), sizeof count);
+    }
+
+    BOOST_CHECK(! ::Opm::EclIO::readArrayIndex(fname, fileSize, false).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(No_Index_Unless_Requested)
+{
+    const auto rset = RSet("NOINDEX");
+
+    writeRestartSteps(rset, false, { 1, 2 }, {}, /* indexed = */ false);
+
+    const auto fname = ::Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+    BOOST_CHECK(! std::filesystem::exists(::Opm::EclIO::arrayIndexFilename(fname)));
+
+    // Reading the file does not create an index either
+    auto rst = ::Opm::EclIO::ERst{ fname, 2 };
+    BOOST_CHECK(rst.hasReportStepNumber(2));
+    BOOST_CHECK(! std::filesystem::exists(::Opm::EclIO::arrayIndexFilename(fname)));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Array_Index
@@ -22,6 +22,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/input/eclipse/Schedule/Well/PAvgCalculator.hpp>
+#include <opm/input/eclipse/Schedule/Well/PAvgCalculatorCollection.hpp>
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
@@ -35,6 +36,8 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <memory>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -2026,3 +2029,144 @@ BOOST_AUTO_TEST_CASE(BottomOfFormation)
 }
 
 BOOST_AUTO_TEST_SUITE_END() // DepthCorrection_Horizontal_Well
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Collection)
+
+namespace {
+    struct WellSetup
+    {
+        explicit WellSetup(const Opm::PAvgCalculator<double>& calc)
+            : wbpConns   { sort(calc.allWellConnections()) }
+            , connSource { wbpConns }
+        {
+            using Span = std::remove_cv_t<
+                std::remove_reference_t<decltype(this->connSource[0])>>;
+            using Item = typename Span::Item;
+
+            for (auto conn = 0*this->wbpConns.size(); conn < this->wbpConns.size(); ++conn) {
+                this->connSource[conn]
+                    .set(Item::Pressure, 1222.0)
+                    .set(Item::PoreVol, 1.25)
+                    .set(Item::MixtureDensity, 0.1 + 0.02*conn)
+                    .set(Item::Depth, 0.0) // Unused
+                    ;
+            }
+        }
+
+        std::vector<std::size_t> wbpConns{};
+        Opm::PAvgDynamicSourceData<double> connSource;
+    };
+
+    void assignBlockSource(const std::vector<std::size_t>&     wbpCells,
+                           Opm::PAvgDynamicSourceData<double>& blockSource)
+    {
+        using Span = std::remove_cv_t<
+            std::remove_reference_t<decltype(blockSource[0])>>;
+        using Item = typename Span::Item;
+
+        for (const auto& cell : wbpCells) {
+            const auto k = cell / 25;
+
+            blockSource[cell]
+                .set(Item::Pressure, 1200.0 + 3.0*(cell % 17) + 0.25*k)
+                .set(Item::PoreVol, 0.25 + 0.01*(cell % 7))
+                .set(Item::MixtureDensity, 0.1 + 0.01*(cell % 5))
+                .set(Item::Depth, 2000.0 + k + 0.5)
+                ;
+        }
+    }
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Batched_Same_As_Serial)
+{
+    const auto grid = shoeBox({5, 5, 10});
+    const auto wellConns = std::array {
+        centreProducer(10, 2, 6),
+        qfsProducer({5, 5, 10}),
+        centreProducer(10, 0, 4),
+    };
+
+    const auto controls = std::array {
+        AveragingControls::defaults(),
+        Opm::PAvg { 0.875, 0.123, Opm::PAvg::DepthCorrection::RES, false },
+        Opm::PAvg { -1.0, 0.5, Opm::PAvg::DepthCorrection::WELL, true },
+    };
+
+    const auto refDepth = std::array { 2002.5, 2000.0, 2001.0 };
+    const auto gravity = standardGravity();
+
+    auto collection = Opm::PAvgCalculatorCollection<double>{};
+    auto wells = std::vector<WellSetup>{};
+    for (auto w = 0*wellConns.size(); w < wellConns.size(); ++w) {
+        const auto ix = collection
+            .setCalculator(w, std::make_unique<Opm::PAvgCalculator<double>>(grid, wellConns[w]));
+
+        wells.emplace_back(collection[ix]);
+    }
+
+    const auto wbpCells = collection.allWBPCells();
+    auto blockSource = Opm::PAvgDynamicSourceData<double> { wbpCells };
+    assignBlockSource(wbpCells, blockSource);
+
+    auto requests = std::vector<Opm::PAvgCalculatorCollection<double>::Request>{};
+    for (auto w = 0*wellConns.size(); w < wellConns.size(); ++w) {
+        auto& req = requests.emplace_back();
+
+        req.calcIndex = w;
+        req.sources.wellBlocks(blockSource).wellConns(wells[w].connSource);
+        req.controls = &controls[w];
+        req.refDepth = refDepth[w];
+    }
+
+    // Evaluate twice to verify that reused internal buffers do not affect
+    // the results.
+    for (auto step = 0; step < 2; ++step) {
+        collection.inferBlockAveragePressures(requests, gravity);
+
+        for (auto w = 0*wellConns.size(); w < wellConns.size(); ++w) {
+            auto serial = Opm::PAvgCalculator<double> { grid, wellConns[w] };
+            serial.inferBlockAveragePressures(requests[w].sources, controls[w],
+                                              gravity, refDepth[w]);
+
+            const auto& expect = serial.averagePressures();
+            const auto& batched = collection[w].averagePressures();
+
+            using WBPMode = Opm::PAvgCalculatorResult<double>::WBPMode;
+            for (const auto mode : { WBPMode::WBP, WBPMode::WBP4,
+                                     WBPMode::WBP5, WBPMode::WBP9 })
+            {
+                // Bit-for-bit identical results expected.
+                BOOST_CHECK_EQUAL(batched.value(mode), expect.value(mode));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Batched_Duplicate_Request)
+{
+    const auto grid = shoeBox({5, 5, 10});
+    const auto controls = AveragingControls::defaults();
+
+    auto collection = Opm::PAvgCalculatorCollection<double>{};
+    const auto ix = collection
+        .setCalculator(0, std::make_unique<Opm::PAvgCalculator<double>>(grid, centreProducer(10, 2, 6)));
+
+    auto requests = std::vector<Opm::PAvgCalculatorCollection<double>::Request>(2);
+    for (auto& req : requests) {
+        req.calcIndex = ix;
+        req.controls = &controls;
+    }
+
+    BOOST_CHECK_THROW(collection.inferBlockAveragePressures(requests, standardGravity()),
+                      std::invalid_argument);
+
+    requests.resize(1);
+    requests.front().calcIndex = ix + 1;
+
+    BOOST_CHECK_THROW(collection.inferBlockAveragePressures(requests, standardGravity()),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Collection
@@ -0,0 +1,108 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE Parallel_For
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/ParallelFor.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(All_Indices)
+{
+    for (const auto chunkSize : { 1, 16 }) {
+        auto visited = std::vector<int>(1000, 0);
+
+        Opm::utility::parallelFor(visited.size(), [&visited](const std::size_t i)
+        {
+            visited[i] += static_cast<int>(i) + 1;
+        }, chunkSize);
+
+        for (auto i = 0*visited.size(); i < visited.size(); ++i) {
+            BOOST_CHECK_EQUAL(visited[i], static_cast<int>(i) + 1);
+        }
+    }
+
+    // Empty range
+    Opm::utility::parallelFor(0, [](const int) { throw std::logic_error { "Not called" }; });
+}
+
+BOOST_AUTO_TEST_CASE(Lowest_Failing_Index_Rethrown)
+{
+    auto visited = std::vector<int>(100, 0);
+
+    BOOST_CHECK_EXCEPTION(Opm::utility::parallelFor(100, [&visited](const int i)
+    {
+        visited[i] = 1;
+
+        if ((i == 17) || (i == 63)) {
+            throw std::runtime_error { std::to_string(i) };
+        }
+    }), std::runtime_error, [](const std::runtime_error& e)
+    {
+        return std::string { e.what() } == "17";
+    });
+
+    // Iterations after a failure are not skipped
+    BOOST_CHECK_EQUAL(visited.back(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Thread_Private_State)
+{
+    auto sums = std::vector<int>(500, 0);
+
+    Opm::utility::parallelForWithState(sums.size(),
+        []() { return std::vector<int>(10, 1); },
+        [&sums](std::vector<int>& scratch, const std::size_t i)
+    {
+        // Scratch space is reused by all iterations of a thread
+        scratch.assign(10, static_cast<int>(i));
+
+        auto sum = 0;
+        for (const auto& x : scratch) {
+            sum += x;
+        }
+
+        sums[i] = sum;
+    });
+
+    for (auto i = 0*sums.size(); i < sums.size(); ++i) {
+        BOOST_CHECK_EQUAL(sums[i], 10 * static_cast<int>(i));
+    }
+
+    BOOST_CHECK_EXCEPTION(Opm::utility::parallelForWithState(50,
+        []() { return 0; },
+        [](int& count, const int i)
+    {
+        ++count;
+
+        if ((i % 7) == 6) {
+            throw std::runtime_error { std::to_string(i) };
+        }
+    }), std::runtime_error, [](const std::runtime_error& e)
+    {
+        return std::string { e.what() } == "6";
+    });
+}
@@ -0,0 +1,249 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE Persistent_Hash_Map
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/PersistentHashMap.hpp>
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+    // Hash function with many collisions to exercise the leaf buckets.
+    struct PoorHash
+    {
+        std::size_t operator()(const int i) const
+        {
+            return static_cast<std::size_t>(i % 3);
+        }
+    };
+
+    template <typename Map>
+    std::map<typename Map::key_type, typename Map::mapped_type>
+    asOrderedMap(const Map& m)
+    {
+        auto ordered = std::map<typename Map::key_type, typename Map::mapped_type>{};
+        for (const auto& [key, value] : m) {
+            ordered.emplace(key, value);
+        }
+
+        return ordered;
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Basic_Operations)
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+    const auto m = Opm::utility::PersistentHashMap<std::string, int>{};
+
+    BOOST_CHECK_MESSAGE(m.empty(), "Default constructed map must be empty");
+    BOOST_CHECK_EQUAL(m.size(), std::size_t{0});
+    BOOST_CHECK_MESSAGE(m.begin() == m.end(), "Empty map must have empty range");
+    BOOST_CHECK_MESSAGE(m.find("PROD") == nullptr, "Empty map must not have entries");
+    BOOST_CHECK_THROW(m.at("PROD"), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(Insert_And_Assign)
+{
+    auto m = Opm::utility::PersistentHashMap<std::string, int>{};
+
+    BOOST_CHECK_MESSAGE(m.insert_or_assign("PROD", 1), "New key must be inserted");
+    BOOST_CHECK_MESSAGE(m.insert_or_assign("INJ", 2), "New key must be inserted");
+    BOOST_CHECK_MESSAGE(! m.insert_or_assign("PROD", 3), "Existing key must be assigned");
+
+    BOOST_CHECK_EQUAL(m.size(), std::size_t{2});
+    BOOST_CHECK_EQUAL(m.at("PROD"), 3);
+    BOOST_CHECK_EQUAL(m.at("INJ"), 2);
+    BOOST_CHECK_MESSAGE(m.contains("INJ"), "Map must contain key 'INJ'");
+    BOOST_CHECK_MESSAGE(! m.contains("OBS"), "Map must not contain key 'OBS'");
+
+    m.clear();
+    BOOST_CHECK_MESSAGE(m.empty(), "Cleared map must be empty");
+}
+
+BOOST_AUTO_TEST_CASE(Many_Keys)
+{
+    auto m = Opm::utility::PersistentHashMap<int, int>{};
+    auto expect = std::map<int, int>{};
+
+    for (auto i = 0; i < 10'000; ++i) {
+        const auto key = (i * 7919) % 100'003;
+        m.insert_or_assign(key, i);
+        expect[key] = i;
+    }
+
+    BOOST_CHECK_EQUAL(m.size(), expect.size());
+    BOOST_CHECK_MESSAGE(asOrderedMap(m) == expect,
+                        "Iterating the map must visit every entry exactly once");
+
+    auto count = std::size_t{0};
+    for (auto it = m.begin(); it != m.end(); ++it) {
+        BOOST_CHECK_EQUAL(it->second, expect.at(it->first));
+        ++count;
+    }
+
+    BOOST_CHECK_EQUAL(count, m.size());
+}
+
+BOOST_AUTO_TEST_CASE(Hash_Collisions)
+{
+    auto m = Opm::utility::PersistentHashMap<int, std::string, PoorHash>{};
+
+    for (auto i = 0; i < 20; ++i) {
+        m.insert_or_assign(i, std::to_string(i));
+    }
+    m.insert_or_assign(4, "four");
+
+    BOOST_CHECK_EQUAL(m.size(), std::size_t{20});
+    BOOST_CHECK_EQUAL(m.at(4), std::string { "four" });
+    BOOST_CHECK_EQUAL(m.at(19), std::string { "19" });
+    BOOST_CHECK_MESSAGE(m.find(20) == nullptr, "Key 20 must not be in map");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Basic_Operations
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Structural_Sharing)
+
+BOOST_AUTO_TEST_CASE(Copy_Is_Independent)
+{
+    auto m1 = Opm::utility::PersistentHashMap<std::string, int>{};
+    m1.insert_or_assign("P1", 1);
+    m1.insert_or_assign("P2", 2);
+
+    auto m2 = m1;
+    m2.insert_or_assign("P1", 10);
+    m2.insert_or_assign("P3", 3);
+
+    BOOST_CHECK_EQUAL(m1.size(), std::size_t{2});
+    BOOST_CHECK_EQUAL(m1.at("P1"), 1);
+    BOOST_CHECK_MESSAGE(! m1.contains("P3"), "Original must not see insertions in copy");
+
+    BOOST_CHECK_EQUAL(m2.size(), std::size_t{3});
+    BOOST_CHECK_EQUAL(m2.at("P1"), 10);
+    BOOST_CHECK_EQUAL(m2.at("P2"), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Update_Copies_Path_Only)
+{
+    auto m1 = Opm::utility::PersistentHashMap<int, std::shared_ptr<int>>{};
+    for (auto i = 0; i < 3000; ++i) {
+        m1.insert_or_assign(i, std::make_shared<int>(i));
+    }
+
+    const auto all_nodes = m1.uniqueNodeCount();
+
+    auto m2 = m1;
+    BOOST_CHECK_EQUAL(m2.uniqueNodeCount(), std::size_t{0});
+
+    m2.insert_or_assign(1234, std::make_shared<int>(-1));
+
+    // Only the root-to-leaf path, at most one node per trie level, is
+    // duplicated.  The remaining nodes are shared with 'm1'.
+    BOOST_CHECK_LE(m2.uniqueNodeCount(), std::size_t{4});
+    BOOST_CHECK_LT(m2.uniqueNodeCount(), all_nodes / 100);
+
+    BOOST_CHECK_EQUAL(*m1.at(1234), 1234);
+    BOOST_CHECK_EQUAL(*m2.at(1234), -1);
+    BOOST_CHECK_MESSAGE(m1.at(17) == m2.at(17), "Unchanged values must be shared");
+}
+
+BOOST_AUTO_TEST_CASE(Changed_Entries)
+{
+    auto m1 = Opm::utility::PersistentHashMap<int, std::shared_ptr<int>, PoorHash>{};
+    for (auto i = 0; i < 100; ++i) {
+        m1.insert_or_assign(i, std::make_shared<int>(i));
+    }
+
+    auto m2 = m1;
+    m2.insert_or_assign(7, std::make_shared<int>(-7));
+    m2.insert_or_assign(8, m1.at(8));   // Same value
+    m2.insert_or_assign(1000, std::make_shared<int>(1000));
+
+    auto changed = std::map<int, bool>{};
+    m2.forEachChanged(m1, [&changed](const auto& entry, const auto* baseValue)
+    {
+        changed.emplace(entry.first, baseValue != nullptr);
+    });
+
+    const auto expect = std::map<int, bool> { { 7, true }, { 1000, false } };
+    BOOST_CHECK_MESSAGE(changed == expect, "Only modified and new entries must be visited");
+
+    changed.clear();
+    m1.forEachChanged(m1, [&changed](const auto& entry, const auto*)
+    {
+        changed.emplace(entry.first, true);
+    });
+    BOOST_CHECK_MESSAGE(changed.empty(), "Map must not differ from itself");
+
+    // Unrelated map with equal values
+    auto m3 = Opm::utility::PersistentHashMap<int, int>{};
+    auto m4 = Opm::utility::PersistentHashMap<int, int>{};
+    for (auto i = 0; i < 50; ++i) {
+        m3.insert_or_assign(i, i);
+        m4.insert_or_assign(49 - i, (i == 10) ? -1 : 49 - i);
+    }
+
+    auto keys = std::vector<int>{};
+    m4.forEachChanged(m3, [&keys](const auto& entry, const auto*)
+    {
+        keys.push_back(entry.first);
+    });
+    BOOST_CHECK(keys == std::vector<int> { 39 });
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Structural_Sharing
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_CASE(Serialize)
+{
+    auto m1 = Opm::utility::PersistentHashMap<std::string, std::vector<double>>{};
+    m1.insert_or_assign("P1", { 1.0, 2.0 });
+    m1.insert_or_assign("P2", { 3.0 });
+    m1.insert_or_assign("I1", {});
+
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer ser(packer);
+    ser.pack(m1);
+    const auto pos1 = ser.position();
+
+    auto m2 = Opm::utility::PersistentHashMap<std::string, std::vector<double>>{};
+    m2.insert_or_assign("X", { 42.0 });
+    ser.unpack(m2);
+    const auto pos2 = ser.position();
+
+    BOOST_CHECK_EQUAL(pos1, pos2);
+    BOOST_CHECK_MESSAGE(asOrderedMap(m1) == asOrderedMap(m2),
+                        "Deserialized map must match original");
+}
@@ -0,0 +1,229 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE Profiler
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/Profiler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    // The sites are used directly rather than through the macros of
+    // TimingMacros.hpp, which only expand to them in builds with
+    // HAVE_NATIVE_PROFILING.
+    const Opm::Profiler::Site outerSite { "outer", __FILE__, __LINE__, false };
+    const Opm::Profiler::Site innerSite { "inner", __FILE__, __LINE__, false };
+    const Opm::Profiler::Site localSite { "local", __FILE__, __LINE__, true };
+
+    void spin(const std::chrono::microseconds duration)
+    {
+        const auto stop = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < stop) {}
+    }
+
+    void outer()
+    {
+        const Opm::Profiler::ScopedTimer timer { outerSite };
+        spin(std::chrono::microseconds { 200 });
+
+        for (int i = 0; i < 2; ++i) {
+            const Opm::Profiler::ScopedTimer innerTimer { innerSite };
+            spin(std::chrono::microseconds { 100 });
+        }
+    }
+
+    Opm::Profiler::SiteSummary find(const std::string& name)
+    {
+        const auto sites = Opm::Profiler::summary();
+        auto pos = std::find_if(sites.begin(), sites.end(),
+                                [&name](const auto& s) { return s.name == name; });
+
+        BOOST_REQUIRE_MESSAGE(pos != sites.end(), "Site " << name << " must be timed");
+
+        return *pos;
+    }
+
+    struct ProfilerFixture
+    {
+        ProfilerFixture()
+        {
+            Opm::Profiler::disable();
+            Opm::Profiler::reset();
+        }
+
+        ~ProfilerFixture()
+        {
+            Opm::Profiler::disable();
+            Opm::Profiler::reset();
+        }
+    };
+
+} // Anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Profiler, ProfilerFixture)
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+    outer();
+
+    const auto sites = Opm::Profiler::summary();
+    for (const auto& s : sites) {
+        BOOST_CHECK_EQUAL(s.calls, 0u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Inclusive_And_Exclusive)
+{
+    Opm::Profiler::enable();
+    outer();
+    outer();
+    Opm::Profiler::disable();
+
+    const auto o = find("outer");
+    const auto i = find("inner");
+
+    BOOST_CHECK_EQUAL(o.calls, 2u);
+    BOOST_CHECK_EQUAL(o.timedCalls, 2u);
+    BOOST_CHECK_EQUAL(i.calls, 4u);
+
+    BOOST_CHECK_GE(i.inclusiveTime, 4*100.0e-6);
+    BOOST_CHECK_CLOSE(i.inclusiveTime, i.exclusiveTime, 1.0e-8);
+
+    // The outer exclusive time does not include the inner regions
+    BOOST_CHECK_GE(o.exclusiveTime, 2*200.0e-6);
+    BOOST_CHECK_CLOSE(o.inclusiveTime, o.exclusiveTime + i.inclusiveTime, 1.0e-8);
+
+    // Summary is sorted by decreasing inclusive time
+    const auto sites = Opm::Profiler::summary();
+    BOOST_CHECK_EQUAL(sites.front().name, "outer");
+}
+
+BOOST_AUTO_TEST_CASE(Sampled_Local_Sites)
+{
+    Opm::Profiler::Options options;
+    options.localSamplingInterval = 4;
+    Opm::Profiler::enable(options);
+
+    for (int i = 0; i < 40; ++i) {
+        const Opm::Profiler::ScopedTimer timer { localSite };
+        spin(std::chrono::microseconds { 10 });
+    }
+    Opm::Profiler::disable();
+
+    const auto l = find("local");
+    BOOST_CHECK_EQUAL(l.calls, 40u);
+    BOOST_CHECK_EQUAL(l.timedCalls, 10u);
+
+    // Extrapolated to all calls
+    BOOST_CHECK_GE(l.inclusiveTime, 40*10.0e-6);
+}
+
+BOOST_AUTO_TEST_CASE(Multiple_Threads)
+{
+    Opm::Profiler::enable();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() { outer(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    Opm::Profiler::disable();
+
+    BOOST_CHECK_EQUAL(find("outer").calls, 4u);
+    BOOST_CHECK_EQUAL(find("inner").calls, 8u);
+}
+
+BOOST_AUTO_TEST_CASE(Exited_Threads)
+{
+    Opm::Profiler::Options options;
+    options.traceEventsPerThread = 1;
+    Opm::Profiler::enable(options);
+    Opm::Profiler::reset();
+
+    // Threads which have exited keep contributing to the reports.
+    for (int t = 0; t < 50; ++t) {
+        std::thread { []() { outer(); } }.join();
+    }
+    Opm::Profiler::disable();
+
+    BOOST_CHECK_EQUAL(find("outer").calls, 50u);
+    BOOST_CHECK_EQUAL(find("inner").calls, 100u);
+
+    std::ostringstream trace;
+    Opm::Profiler::writeChromeTrace(trace);
+    const auto& t = trace.str();
+
+    // One event, the first inner region, from each thread
+    auto numEvents = 0;
+    for (auto pos = t.find(R"("name": "inner")"); pos != std::string::npos;
+         pos = t.find(R"("name": "inner")", pos + 1))
+    {
+        ++numEvents;
+    }
+    BOOST_CHECK_EQUAL(numEvents, 50);
+
+    // Reset drops the counters of exited threads as well.
+    Opm::Profiler::reset();
+    for (const auto& s : Opm::Profiler::summary()) {
+        BOOST_CHECK_EQUAL(s.calls, 0u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Reports)
+{
+    Opm::Profiler::Options options;
+    options.traceEventsPerThread = 2;
+    Opm::Profiler::enable(options);
+    Opm::Profiler::reset();
+
+    outer();
+    Opm::Profiler::disable();
+
+    std::ostringstream json;
+    Opm::Profiler::writeJson(json);
+    BOOST_CHECK(json.str().find(R"("name": "outer")") != std::string::npos);
+    BOOST_CHECK(json.str().find(R"("calls": 2)") != std::string::npos);
+
+    // Only the first two regions to complete are recorded, i.e. the inner
+    // ones.
+    std::ostringstream trace;
+    Opm::Profiler::writeChromeTrace(trace);
+    const auto& t = trace.str();
+    BOOST_CHECK(t.find(R"("traceEvents")") != std::string::npos);
+    BOOST_CHECK(t.find(R"("name": "inner")") != std::string::npos);
+    BOOST_CHECK(t.find(R"("name": "outer")") == std::string::npos);
+
+    const auto report = Opm::Profiler::formatReport();
+    BOOST_CHECK(report.find("outer") != std::string::npos);
+    BOOST_CHECK(report.find("inner") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
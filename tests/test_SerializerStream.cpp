@@ -0,0 +1,285 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE Serializer_Stream
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/SerializerStream.hpp>
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Table
+    {
+        std::string name{};
+        std::vector<double> values{};
+
+        bool operator==(const Table& that) const
+        {
+            return (this->name == that.name) && (this->values == that.values);
+        }
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(name);
+            serializer(values);
+        }
+    };
+
+    struct Model
+    {
+        std::map<std::string, int> regions{};
+        std::vector<Table> tables{};
+        std::shared_ptr<Table> first{};
+        std::shared_ptr<Table> second{};
+        std::optional<std::vector<int>> cells{};
+        std::vector<bool> active{};
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(regions);
+            serializer(tables);
+            serializer(first);
+            serializer(second);
+            serializer(cells);
+            serializer(active);
+        }
+    };
+
+    Model makeModel()
+    {
+        auto model = Model{};
+
+        for (int i = 0; i < 50; ++i) {
+            model.regions.emplace("FIPNUM_" + std::to_string(i), i);
+
+            auto& table = model.tables.emplace_back();
+            table.name = "PVT" + std::to_string(i);
+            for (int j = 0; j < 100 + i; ++j) {
+                table.values.push_back(1.0 + 0.01*j);
+            }
+        }
+
+        model.first = std::make_shared<Table>(model.tables[3]);
+        model.second = model.first;
+        model.cells.emplace(10000, 7);
+        model.active.assign(33, true);
+        model.active[5] = false;
+
+        return model;
+    }
+
+    void checkEqual(const Model& a, const Model& b)
+    {
+        BOOST_CHECK(a.regions == b.regions);
+        BOOST_CHECK(a.tables == b.tables);
+        BOOST_REQUIRE(b.first != nullptr);
+        BOOST_CHECK(*a.first == *b.first);
+        BOOST_CHECK_MESSAGE(b.first == b.second, "Shared pointers must be restored as shared");
+        BOOST_CHECK(a.cells == b.cells);
+        BOOST_CHECK(a.active == b.active);
+    }
+
+    std::vector<char> compressRoundTrip(const std::vector<char>& data)
+    {
+        std::vector<char> compressed(Opm::Serialization::compressBound(data.size()));
+        compressed.resize(Opm::Serialization::compress(data.data(), data.size(), compressed.data()));
+
+        std::vector<char> restored(data.size());
+        Opm::Serialization::decompress(compressed.data(), compressed.size(),
+                                       restored.data(), restored.size());
+
+        return restored;
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Compression)
+
+BOOST_AUTO_TEST_CASE(Round_Trip)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> byte(0, 255);
+
+    std::vector<std::vector<char>> inputs;
+    inputs.emplace_back();
+    inputs.emplace_back(std::vector<char> { 'a', 'b', 'c' });
+    inputs.emplace_back(100000, 'x');
+
+    auto& random = inputs.emplace_back(70000);
+    for (auto& c : random) {
+        c = static_cast<char>(byte(gen));
+    }
+
+    auto& text = inputs.emplace_back();
+    for (int i = 0; i < 5000; ++i) {
+        const auto word = "WELL" + std::to_string(i % 37) + " ";
+        text.insert(text.end(), word.begin(), word.end());
+    }
+
+    for (const auto& input : inputs) {
+        BOOST_CHECK(compressRoundTrip(input) == input);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Repetitive_Data_Shrinks)
+{
+    const std::vector<char> data(100000, 'x');
+    std::vector<char> compressed(Opm::Serialization::compressBound(data.size()));
+
+    BOOST_CHECK_LT(Opm::Serialization::compress(data.data(), data.size(), compressed.data()),
+                   data.size() / 100);
+}
+
+BOOST_AUTO_TEST_CASE(Corrupt_Data)
+{
+    const std::vector<char> data(1000, 'x');
+    std::vector<char> compressed(Opm::Serialization::compressBound(data.size()));
+    compressed.resize(Opm::Serialization::compress(data.data(), data.size(), compressed.data()));
+
+    std::vector<char> restored(data.size());
+    BOOST_CHECK_THROW(Opm::Serialization::decompress(compressed.data(), compressed.size() - 1,
+                                                     restored.data(), restored.size()),
+                      std::runtime_error);
+
+    restored.resize(data.size() - 1);
+    BOOST_CHECK_THROW(Opm::Serialization::decompress(compressed.data(), compressed.size(),
+                                                     restored.data(), restored.size()),
+                      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Compression
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Streaming)
+
+BOOST_AUTO_TEST_CASE(Round_Trip)
+{
+    const auto model = makeModel();
+    const auto checksum = 17;
+
+    for (const auto chunkSize : { std::size_t{1}, std::size_t{64}, std::size_t{1} << 20 }) {
+        for (const auto compress : { false, true }) {
+            BOOST_TEST_CONTEXT("Chunk size " << chunkSize << ", compress " << compress) {
+                Opm::Serialization::MemPacker packer;
+                Opm::Serializer ser(packer);
+
+                std::vector<char> stream;
+                const auto size = ser.packStream(Opm::Serialization::bufferSink(stream),
+                                                 { chunkSize, compress }, model, checksum);
+                BOOST_CHECK_EQUAL(size, stream.size());
+
+                auto restored = Model{};
+                auto restoredChecksum = 0;
+                ser.unpackStream(Opm::Serialization::bufferSource(stream),
+                                 restored, restoredChecksum);
+
+                checkEqual(model, restored);
+                BOOST_CHECK_EQUAL(restoredChecksum, checksum);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Same_Payload_As_Pack)
+{
+    const auto model = makeModel();
+
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer ser(packer);
+
+    ser.pack(model);
+    const auto packSize = ser.position();
+
+    // Single uncompressed chunk
+    std::vector<char> stream;
+    ser.packStream(Opm::Serialization::bufferSink(stream), { packSize + 1, false }, model);
+
+    BOOST_CHECK_EQUAL(stream.size(), 24 + packSize);
+}
+
+BOOST_AUTO_TEST_CASE(File_Stream)
+{
+    const auto model = makeModel();
+
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer ser(packer);
+
+    std::stringstream file;
+    const auto size = ser.packStream(Opm::Serialization::streamSink(file), { 4096, true }, model);
+    BOOST_CHECK_EQUAL(size, file.str().size());
+
+    auto restored = Model{};
+    ser.unpackStream(Opm::Serialization::streamSource(file), restored);
+    checkEqual(model, restored);
+}
+
+BOOST_AUTO_TEST_CASE(Invalid_Streams)
+{
+    const auto model = makeModel();
+
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer ser(packer);
+
+    std::vector<char> stream;
+    ser.packStream(Opm::Serialization::bufferSink(stream), { 256, true }, model);
+
+    auto restored = Model{};
+
+    {
+        auto truncated = stream;
+        truncated.resize(stream.size() / 2);
+        BOOST_CHECK_THROW(ser.unpackStream(Opm::Serialization::bufferSource(truncated), restored),
+                          std::runtime_error);
+    }
+
+    {
+        auto wrongVersion = stream;
+        ++wrongVersion[4];
+        BOOST_CHECK_THROW(ser.unpackStream(Opm::Serialization::bufferSource(wrongVersion), restored),
+                          std::runtime_error);
+    }
+
+    {
+        // Stream holds more than a single integer
+        auto i = 0;
+        BOOST_CHECK_THROW(ser.unpackStream(Opm::Serialization::bufferSource(stream), i),
+                          std::runtime_error);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Streaming
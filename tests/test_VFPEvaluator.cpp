@@ -0,0 +1,184 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE VFPEvaluator
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Schedule/VFPEvaluator.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+    // Multilinear, hence reproduced exactly by the interpolation, also
+    // when extrapolating.
+    double bhpFunction(const double flo, const double thp, const double wfr,
+                       const double gfr, const double alq)
+    {
+        return 1.0e5 + 2.0*thp + 3.0e4*wfr + 5.0e2*gfr + 4.0*alq + 5.0e6*flo
+            + 10.0*thp*flo - 2.0e3*wfr*gfr;
+    }
+
+    Opm::VFPProdTable makeTable()
+    {
+        const std::vector<double> flo { 0.001, 0.01, 0.02, 0.05 };
+        const std::vector<double> thp { 1.0e5, 2.0e5, 5.0e5 };
+        const std::vector<double> wfr { 0.0, 0.5, 0.9 };
+        const std::vector<double> gfr { 50.0, 100.0 };
+        const std::vector<double> alq { 0.0 };
+
+        std::vector<double> data;
+        for (const auto t : thp) {
+            for (const auto w : wfr) {
+                for (const auto g : gfr) {
+                    for (const auto a : alq) {
+                        for (const auto f : flo) {
+                            data.push_back(bhpFunction(f, t, w, g, a));
+                        }
+                    }
+                }
+            }
+        }
+
+        return { 1, 1000.0,
+                 Opm::VFPProdTable::FLO_TYPE::FLO_LIQ,
+                 Opm::VFPProdTable::WFR_TYPE::WFR_WCT,
+                 Opm::VFPProdTable::GFR_TYPE::GFR_GOR,
+                 Opm::VFPProdTable::ALQ_TYPE::ALQ_UNDEF,
+                 flo, thp, wfr, gfr, alq, data };
+    }
+
+    void checkEvaluation(const Opm::VFPEvaluation& e,
+                         const Opm::VFPProdEvaluator::Input& x)
+    {
+        // Single ALQ node, hence constant in ALQ
+        BOOST_CHECK_CLOSE(e.value, bhpFunction(x.flo, x.thp, x.wfr, x.gfr, 0.0), 1.0e-10);
+        BOOST_CHECK_EQUAL(e.dalq, 0.0);
+
+        BOOST_CHECK_CLOSE(e.dthp, 2.0 + 10.0*x.flo, 1.0e-8);
+        BOOST_CHECK_CLOSE(e.dwfr, 3.0e4 - 2.0e3*x.gfr, 1.0e-8);
+        BOOST_CHECK_CLOSE(e.dgfr, 5.0e2 - 2.0e3*x.wfr, 1.0e-8);
+        BOOST_CHECK_CLOSE(e.dflo, 5.0e6 + 10.0*x.thp, 1.0e-8);
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Multilinear_Production_Table)
+{
+    const auto evaluator = Opm::VFPProdEvaluator { makeTable() };
+
+    const std::vector<Opm::VFPProdEvaluator::Input> inputs {
+        { 0.015, 3.0e5, 0.7, 75.0, 0.0 },   // interior
+        { 0.01, 2.0e5, 0.5, 50.0, 0.0 },    // node
+        { 0.05, 5.0e5, 0.9, 100.0, 0.0 },   // last node
+        { 0.08, 8.0e5, 1.0, 120.0, 10.0 },  // above range
+        { 0.0, 0.5e5, -0.1, 20.0, -1.0 },   // below range
+    };
+
+    std::vector<Opm::VFPProdEvaluator::Cell> cells;
+    std::vector<Opm::VFPEvaluation> results;
+    evaluator.bhp(inputs, cells, results);
+
+    BOOST_REQUIRE_EQUAL(cells.size(), inputs.size());
+    BOOST_REQUIRE_EQUAL(results.size(), inputs.size());
+    for (auto i = 0*inputs.size(); i < inputs.size(); ++i) {
+        BOOST_TEST_CONTEXT("Input " << i) {
+            checkEvaluation(results[i], inputs[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Cell_Reuse)
+{
+    const auto evaluator = Opm::VFPProdEvaluator { makeTable() };
+
+    auto input = Opm::VFPProdEvaluator::Input { 0.015, 3.0e5, 0.7, 75.0, 0.0 };
+    auto cell = Opm::VFPProdEvaluator::Cell {};
+    checkEvaluation(evaluator.bhp(input, cell), input);
+
+    BOOST_CHECK(cell.valid);
+    const auto index = cell.index;
+    BOOST_CHECK_EQUAL(index[0], 1u);
+    BOOST_CHECK_EQUAL(index[4], 1u);
+
+    // Inside the same cell, the cached corners are reused
+    input.flo = 0.019;
+    input.thp = 4.5e5;
+    checkEvaluation(evaluator.bhp(input, cell), input);
+    BOOST_CHECK(cell.index == index);
+
+    // A new cell is located when the point leaves the cell
+    input.flo = 0.03;
+    checkEvaluation(evaluator.bhp(input, cell), input);
+    BOOST_CHECK_EQUAL(cell.index[4], 2u);
+
+    // The outermost cells are also used for extrapolation
+    input.flo = 1.0;
+    checkEvaluation(evaluator.bhp(input, cell), input);
+    BOOST_CHECK_EQUAL(cell.index[4], 2u);
+}
+
+BOOST_AUTO_TEST_CASE(THP_From_BHP)
+{
+    const auto evaluator = Opm::VFPProdEvaluator { makeTable() };
+    auto cell = Opm::VFPProdEvaluator::Cell {};
+
+    for (const auto thp : { 1.0e5, 1.5e5, 4.0e5, 5.0e5, 7.0e5 }) {
+        auto input = Opm::VFPProdEvaluator::Input { 0.02, thp, 0.3, 60.0, 0.0 };
+        const auto bhp = evaluator.bhp(input, cell).value;
+
+        input.thp = 0.0;
+        BOOST_CHECK_CLOSE(evaluator.thp(input, bhp), thp, 1.0e-8);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Two_Dimensional_Interpolator)
+{
+    using Interpolator = Opm::VFPInterpolator<2>;
+
+    // 2x3 values, second axis varying fastest
+    const auto interp = Interpolator {
+        { std::vector<double> { 0.0, 1.0 }, std::vector<double> { 0.0, 1.0, 3.0 } },
+        { 0.0, 1.0, 5.0,
+          2.0, 4.0, 6.0 }
+    };
+
+    auto cell = Interpolator::Cell {};
+    std::array<double, 2> d {};
+
+    BOOST_CHECK_CLOSE(interp.evaluate({ 0.5, 0.5 }, cell, d), 1.75, 1.0e-12);
+    BOOST_CHECK_CLOSE(d[0], 2.5, 1.0e-12);
+    BOOST_CHECK_CLOSE(d[1], 1.5, 1.0e-12);
+
+    BOOST_CHECK_CLOSE(interp.evaluate({ 1.0, 2.0 }, cell, d), 5.0, 1.0e-12);
+    BOOST_CHECK_CLOSE(d[0], 2.0, 1.0e-12);
+    BOOST_CHECK_CLOSE(d[1], 1.0, 1.0e-12);
+
+    BOOST_CHECK_THROW((Interpolator { { std::vector<double> { 0.0, 1.0 },
+                                        std::vector<double> { 0.0 } },
+                                      { 1.0 } }),
+                      std::invalid_argument);
+}
@@ -156,3 +156,62 @@ BOOST_AUTO_TEST_CASE(Matrix)
 }
 
 BOOST_AUTO_TEST_SUITE_END ()
+
+// ====================================================================
+
+BOOST_AUTO_TEST_SUITE(Reuse)
+
+BOOST_AUTO_TEST_CASE(Array_Reset)
+{
+    using Wa = Opm::RestartIO::Helpers::WindowedArray<int>;
+
+    auto wa = Wa{ Wa::NumWindows{ 4 }, Wa::WindowSize{ 3 } };
+    for (auto n = wa.numWindows(), i = 0*n; i < n; ++i) {
+        auto w = wa[i];
+        std::fill(std::begin(w), std::end(w), static_cast<int>(i + 1));
+    }
+
+    const auto* storage = wa.data().data();
+
+    wa.reset(Wa::NumWindows{ 3 }, Wa::WindowSize{ 2 }, -1);
+
+    BOOST_CHECK_EQUAL(wa.numWindows(), Wa::Idx{3});
+    BOOST_CHECK_EQUAL(wa.windowSize(), Wa::Idx{2});
+    BOOST_CHECK_MESSAGE(wa.data().data() == storage,
+                        "Smaller array must reuse existing storage");
+
+    const auto expect = std::vector<int>(6, -1);
+    const auto& actual = wa.data();
+    BOOST_CHECK_EQUAL_COLLECTIONS(std::begin(actual), std::end(actual),
+                                  std::begin(expect), std::end(expect));
+
+    BOOST_CHECK_THROW(wa.reset(Wa::NumWindows{ 3 }, Wa::WindowSize{ 0 }),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Matrix_Reset)
+{
+    using Wm = Opm::RestartIO::Helpers::WindowedMatrix<int>;
+
+    auto wm = Wm{ Wm::NumRows{ 3 }, Wm::NumCols{ 2 }, Wm::WindowSize{ 4 } };
+    {
+        auto w = wm(2, 1);
+        std::fill(std::begin(w), std::end(w), 42);
+    }
+
+    wm.reset(Wm::NumRows{ 2 }, Wm::NumCols{ 3 }, Wm::WindowSize{ 2 });
+
+    BOOST_CHECK_EQUAL(wm.numRows(), Wm::Idx{2});
+    BOOST_CHECK_EQUAL(wm.numCols(), Wm::Idx{3});
+    BOOST_CHECK_EQUAL(wm.windowSize(), Wm::Idx{2});
+
+    const auto expect = std::vector<int>(12, 0);
+    const auto& actual = wm.data();
+    BOOST_CHECK_EQUAL_COLLECTIONS(std::begin(actual), std::end(actual),
+                                  std::begin(expect), std::end(expect));
+
+    BOOST_CHECK_THROW(wm.reset(Wm::NumRows{ 2 }, Wm::NumCols{ 0 }, Wm::WindowSize{ 2 }),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END ()
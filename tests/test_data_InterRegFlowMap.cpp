@@ -23,10 +23,12 @@
 
 #include <opm/output/data/InterRegFlowMap.hpp>
 
+#include <cstddef>
 #include <optional>
 #include <stdexcept>
 #include <utility>
 #include <tuple>
+#include <vector>
 
 #include "tests/MessageBuffer.cpp"
 
@@ -75,6 +77,58 @@ namespace {
 
         return rate;
     }
+
+    std::tuple<int, int, Opm::data::InterRegFlowMap::FlowRates>
+    manyConn(const std::size_t i)
+    {
+        using Component = Opm::data::InterRegFlowMap::Component;
+
+        auto rate = Opm::data::InterRegFlowMap::FlowRates{};
+
+        rate[Component::Oil] = static_cast<float>(i % 7) - 3.0f;
+        rate[Component::Gas] = 0.5f;
+        rate[Component::Water] = static_cast<float>(i % 3);
+        rate[Component::Disgas] = -0.25f;
+        rate[Component::Vapoil] = 1.0f;
+
+        return { static_cast<int>(i % 5), static_cast<int>((i / 5) % 4), rate };
+    }
+
+    void checkSameFlows(const Opm::data::InterRegFlowMap& flowMap,
+                        const Opm::data::InterRegFlowMap& expect,
+                        const int                         numRegions)
+    {
+        using Component = Opm::data::InterRegFlowMap::ReadOnlyWindow::Component;
+        using Direction = Opm::data::InterRegFlowMap::ReadOnlyWindow::Direction;
+
+        BOOST_REQUIRE_EQUAL(flowMap.numRegions(), expect.numRegions());
+
+        for (auto r1 = 0; r1 < numRegions; ++r1) {
+            for (auto r2 = 0; r2 < numRegions; ++r2) {
+                if (r1 == r2) { continue; }
+
+                const auto flows = flowMap.getInterRegFlows(r1, r2);
+                const auto expectFlows = expect.getInterRegFlows(r1, r2);
+
+                BOOST_REQUIRE_EQUAL(flows.has_value(), expectFlows.has_value());
+                if (! flows.has_value()) { continue; }
+
+                const auto& [ iregFlow, sign ] = flows.value();
+                const auto& [ expectFlow, expectSign ] = expectFlows.value();
+
+                BOOST_CHECK_EQUAL(sign, expectSign);
+
+                for (const auto comp : { Component::Oil, Component::Gas, Component::Water,
+                                         Component::Disgas, Component::Vapoil })
+                {
+                    for (const auto dir : { Direction::Positive, Direction::Negative }) {
+                        BOOST_CHECK_CLOSE(iregFlow.flow(comp, dir),
+                                          expectFlow.flow(comp, dir), 1.0e-4);
+                    }
+                }
+            }
+        }
+    }
 }
 
 BOOST_AUTO_TEST_SUITE(InterRegMap)
@@ -975,4 +1029,120 @@ BOOST_AUTO_TEST_CASE(LinearBuffer_ManyReadWrite)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Reset_Rates)
+{
+    using Component = Opm::data::InterRegFlowMap::ReadOnlyWindow::Component;
+    using Direction = Opm::data::InterRegFlowMap::ReadOnlyWindow::Direction;
+
+    auto flowMap = Opm::data::InterRegFlowMap{};
+    flowMap.addConnection(0, 1, conn_1());
+    flowMap.addConnection(2, 1, conn_2());
+
+    // Cannot reset rates of uncompressed connections.
+    BOOST_CHECK_THROW(flowMap.resetRates(), std::logic_error);
+
+    flowMap.compress(3);
+    flowMap.resetRates();
+
+    {
+        auto flows = flowMap.getInterRegFlows(0, 1);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "Registered region pair must have a value after reset");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_EQUAL(sign, 1.0);
+        BOOST_CHECK_EQUAL(iregFlow.flow(Component::Oil), 0.0);
+        BOOST_CHECK_EQUAL(iregFlow.flow(Component::Vapoil), 0.0);
+    }
+
+    // Existing pairs accumulate into compressed structure, new pair (0,2)
+    // extends it.
+    flowMap.addConnection(1, 0, conn_1());
+    flowMap.addConnection(0, 1, conn_3());
+    flowMap.addConnection(0, 2, conn_2());
+    flowMap.compress(3);
+
+    // Region pair (1,2) remains in structure, with zero rates.
+    auto expect = Opm::data::InterRegFlowMap{};
+    expect.addConnection(2, 1, Opm::data::InterRegFlowMap::FlowRates{});
+    expect.addConnection(1, 0, conn_1());
+    expect.addConnection(0, 1, conn_3());
+    expect.addConnection(0, 2, conn_2());
+    expect.compress(3);
+
+    checkSameFlows(flowMap, expect, 3);
+
+    {
+        auto flows = flowMap.getInterRegFlows(1, 2);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "Region pair from previous step must have a value");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_EQUAL(sign, 1.0);
+        BOOST_CHECK_EQUAL(iregFlow.flow(Component::Gas, Direction::Positive), 0.0);
+        BOOST_CHECK_EQUAL(iregFlow.flow(Component::Gas, Direction::Negative), 0.0);
+    }
+
+    // Same structure at next step.  Message buffer must be readable as
+    // before.
+    flowMap.resetRates();
+    flowMap.addConnection(2, 1, conn_1());
+    flowMap.addConnection(2, 0, conn_3());
+    flowMap.compress(3);
+
+    auto buffer = MessageBuffer{};
+    flowMap.write(buffer);
+
+    auto flowMap2 = Opm::data::InterRegFlowMap{};
+    flowMap2.read(buffer);
+    flowMap2.compress(3);
+
+    checkSameFlows(flowMap2, flowMap, 3);
+
+    {
+        auto flows = flowMap2.getInterRegFlows(1, 2);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "Registered region pair must have a value");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_EQUAL(sign, 1.0);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil, Direction::Negative), -1.0, 1.0e-6);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Water, Direction::Negative), -3.0, 1.0e-6);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Parallel_Add)
+{
+    const auto numConnections = std::size_t{100'000};
+
+    auto expect = Opm::data::InterRegFlowMap{};
+    for (auto i = 0*numConnections; i < numConnections; ++i) {
+        const auto& [r1, r2, rates] = manyConn(i);
+        expect.addConnection(r1, r2, rates);
+    }
+    expect.compress(5);
+
+    // Empty structure.  All connections are new.
+    auto flowMap = Opm::data::InterRegFlowMap{};
+    flowMap.addConnections(numConnections, manyConn);
+    flowMap.compress(5);
+
+    checkSameFlows(flowMap, expect, 5);
+
+    // Existing structure.
+    flowMap.resetRates();
+    flowMap.addConnections(numConnections, manyConn);
+    flowMap.compress(5);
+
+    checkSameFlows(flowMap, expect, 5);
+
+    // Invalid region index in range.
+    BOOST_CHECK_THROW(flowMap.addConnections(10, [](const std::size_t i)
+    {
+        auto conn = manyConn(i);
+        if (i == 7) { std::get<0>(conn) = -1; }
+        return conn;
+    }), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // InterRegMap
@@ -42,7 +42,9 @@
 #include <algorithm>
 #include <cassert>
 #include <stdexcept>
+#include <string>
 #include <tuple>
+#include <type_traits>
 
 template <class Eval, int numVars, int staticSize, class Scalar, class Implementation>
 struct TestEnvBase
@@ -253,6 +255,40 @@ struct TestEnvBase
         }
     }
 
+    void testProductQuotientRule(const Scalar tolerance)
+    {
+        // all derivatives are nonzero, so that every element of the
+        // (possibly vectorized) derivative loops is checked
+        const Scalar u = 1.5;
+        const Scalar v = 2.5;
+        Eval uEval = asImp_().createConstant(u);
+        Eval vEval = asImp_().createConstant(v);
+        for (int i = 0; i < uEval.size(); ++i) {
+            uEval.setDerivative(i, 1.0 + i);
+            vEval.setDerivative(i, 0.5 - i);
+        }
+
+        Eval a = uEval;
+        a *= vEval;
+        Eval b = uEval;
+        b /= vEval;
+        for (int i = 0; i < uEval.size(); ++i) {
+            const Scalar uPrime = 1.0 + i;
+            const Scalar vPrime = 0.5 - i;
+
+            const Scalar productPrime = uPrime*v + u*vPrime;
+            if (std::abs(a.derivative(i) - productPrime) > tolerance*std::max(Scalar{1}, std::abs(productPrime)))
+                throw std::logic_error("oops: operator*=");
+
+            const Scalar quotientPrime = (uPrime*v - u*vPrime)/(v*v);
+            if (std::abs(b.derivative(i) - quotientPrime) > tolerance*std::max(Scalar{1}, std::abs(quotientPrime)))
+                throw std::logic_error("oops: operator/=");
+        }
+
+        if (std::abs(a.value() - u*v) > tolerance || std::abs(b.value() - u/v) > tolerance)
+            throw std::logic_error("oops: operator*= or operator/=");
+    }
+
     template <class AdFn, class ClassicFn>
     void test1DFunction(AdFn* adFn, ClassicFn* classicFn, Scalar xMin = 1e-6, Scalar xMax = 1000)
     {
@@ -490,6 +526,7 @@ struct TestEnvBase
         std::cout << "  Testing operators and constructors\n";
         const Scalar eps = std::numeric_limits<Scalar>::epsilon()*1e3;
         testOperators(eps);
+        testProductQuotientRule(eps);
 
         std::cout << "  Testing min()\n";
         test2DFunction1(Opm::DenseAd::min<Scalar, numVars, staticSize>,
@@ -674,8 +711,56 @@ struct StaticTestEnv : public TestEnvBase<Opm::DenseAd::Evaluation<Scalar, numDe
     { return Opm::variable<Eval, Scalar>(v, varIdx); }
 };
 
+// the specializations with 8 or more derivatives may use SIMD kernels, cover
+// full registers as well as remainders
+template <class Scalar>
+void testStaticSizes()
+{
+    std::cout << " -> Scalar == " << (std::is_same_v<Scalar, double> ? "double" : "float")
+              << ", n = 3, 5, 8, 9, 12\n";
+    StaticTestEnv<Scalar, 3>().testAll();
+    StaticTestEnv<Scalar, 5>().testAll();
+    StaticTestEnv<Scalar, 8>().testAll();
+    StaticTestEnv<Scalar, 9>().testAll();
+    StaticTestEnv<Scalar, 12>().testAll();
+}
+
+// the approximations which are used with OPM_DENSEAD_FAST_MATH must stay within
+// their documented error bounds, regardless of the setting of the macro
+void testFastMath()
+{
+    std::cout << "Testing fastExp() and fastLog()\n";
+
+    for (double x = -700.0; x < 700.0; x += 3.17e-3) {
+        const double y = std::exp(x);
+        if (std::abs(Opm::DenseAd::fastExp(x) - y) > Opm::DenseAd::fastExpMaxRelativeError*y)
+            throw std::logic_error("oops: fastExp("+std::to_string(x)+")");
+    }
+
+    for (double x = 1e-300; x < 1e300; x *= 1.00317) {
+        const double y = std::log(x);
+        if (std::abs(Opm::DenseAd::fastLog(x) - y) > Opm::DenseAd::fastLogMaxRelativeError*std::abs(y))
+            throw std::logic_error("oops: fastLog("+std::to_string(x)+")");
+    }
+
+    // cancellation close to one
+    for (double x = 0.5; x < 2.0; x += 3.17e-5) {
+        const double y = std::log(x);
+        if (std::abs(Opm::DenseAd::fastLog(x) - y) > Opm::DenseAd::fastLogMaxRelativeError*std::abs(y))
+            throw std::logic_error("oops: fastLog("+std::to_string(x)+")");
+    }
+
+    // special values are passed on to the library functions
+    if (Opm::DenseAd::fastExp(0.0) != 1.0 || Opm::DenseAd::fastLog(1.0) != 0.0
+        || !std::isinf(Opm::DenseAd::fastExp(1000.0)) || Opm::DenseAd::fastExp(-1000.0) != 0.0
+        || !std::isinf(Opm::DenseAd::fastLog(0.0)) || !std::isnan(Opm::DenseAd::fastLog(-1.0)))
+        throw std::logic_error("oops: special values of fastExp() or fastLog()");
+}
+
 int main()
 {
+    testFastMath();
+
     std::cout << "Testing statically sized evaluations\n";
     std::cout << " -> Scalar == double, n = 15\n";
     StaticTestEnv<double, 15>().testAll();
@@ -685,6 +770,8 @@ int main()
     StaticTestEnv<float, 15>().testAll();
     std::cout << " -> Scalar == float, n = 2\n";
     StaticTestEnv<float, 2>().testAll();
+    testStaticSizes<double>();
+    testStaticSizes<float>();
 
     std::cout << "Testing dynamically sized evaluations\n";
     std::cout << " -> Scalar == double\n";
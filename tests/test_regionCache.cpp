@@ -39,7 +39,9 @@
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <stdexcept>
 #include <string>
 #include <unordered_set>
@@ -332,3 +334,56 @@ END
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(RegionSums)
+{
+    const auto  deck     = summaryDeck();
+    const auto  es       = Opm::EclipseState { deck };
+    const auto  schedule = Opm::Schedule { deck, es, std::make_shared<Opm::Python>() };
+    const auto& fipnum   = es.fieldProps().get_int("FIPNUM");
+
+    const auto regCache = Opm::out::RegionCache {
+        {"FIPNUM"}, es.fieldProps(), es.getInputGrid(), schedule
+    };
+
+    BOOST_CHECK_EQUAL(regCache.regionSets().size(), std::size_t{1});
+    BOOST_CHECK_EQUAL(regCache.maxRegion("FIPNUM"), std::size_t{20});
+    BOOST_CHECK_EQUAL(regCache.maxRegion("FIPXYZ"), std::size_t{0});
+
+    const auto ones = std::vector<double>(fipnum.size(), 1.0);
+    auto cellIx = std::vector<double>(fipnum.size());
+    std::iota(cellIx.begin(), cellIx.end(), 0.0);
+
+    auto expect_count = std::vector<double>(20, 0.0);
+    auto expect_cellIx = std::vector<double>(20, 0.0);
+    for (auto cell = 0*fipnum.size(); cell < fipnum.size(); ++cell) {
+        expect_count[fipnum[cell] - 1] += 1.0;
+        expect_cellIx[fipnum[cell] - 1] += cellIx[cell];
+    }
+
+    const auto sums = regCache.regionSums({ std::cref(ones), std::cref(cellIx) });
+    BOOST_REQUIRE_EQUAL(sums.size(), std::size_t{1});
+    BOOST_REQUIRE_EQUAL(sums[0].size(), std::size_t{40});
+
+    for (auto region = 0; region < 20; ++region) {
+        BOOST_CHECK_EQUAL(sums[0][region], expect_count[region]);
+        BOOST_CHECK_EQUAL(sums[0][20 + region], expect_cellIx[region]);
+    }
+
+    auto inplace = Opm::Inplace{};
+    regCache.addInplace({ Opm::Inplace::Phase::PoreVolume }, { std::cref(ones) }, inplace);
+
+    BOOST_CHECK_EQUAL(inplace.max_region("FIPNUM"), std::size_t{20});
+    BOOST_CHECK(inplace.get_vector("FIPNUM", Opm::Inplace::Phase::PoreVolume) == expect_count);
+
+    BOOST_CHECK_THROW(regCache.addInplace({ Opm::Inplace::Phase::OIL }, {}, inplace),
+                      std::invalid_argument);
+
+    const auto short_values = std::vector<double>(fipnum.size() - 1, 1.0);
+    BOOST_CHECK_THROW(regCache.regionSums({ std::cref(ones), std::cref(short_values) }),
+                      std::invalid_argument);
+
+    BOOST_CHECK_THROW(regCache.addInplace({ Opm::Inplace::Phase::PoreVolume },
+                                          { std::cref(short_values) }, inplace),
+                      std::invalid_argument);
+}